@@ -1546,6 +1546,14 @@ class InferRequest:
                     :return: list of profiling information for operations in model.
                     :rtype: list[openvino.ProfilingInfo]
         """
+    def get_property(self, property: str) -> typing.Any:
+        """
+                    Gets properties for current infer request, e.g. openvino.properties.request_queue_wait.
+        
+                    :param name: Property name.
+                    :type name: str
+                    :rtype: Any
+        """
     @typing.overload
     def get_tensor(self, name: str) -> Tensor:
         """
@@ -1738,6 +1746,24 @@ class InferRequest:
                     :type outputs: dict[int, openvino.Tensor]
         """
     @typing.overload
+    def set_property(self, properties: collections.abc.Mapping[str, typing.Any]) -> None:
+        """
+                    Sets properties for current infer request, e.g. openvino.properties.hint.request_priority.
+                    The properties are applied starting from the next inference.
+        
+                    :param properties: dict of pairs: (property name, property value)
+                    :type properties: dict
+                    :rtype: None
+        """
+    @typing.overload
+    def set_property(self, property: tuple[str, typing.Any]) -> None:
+        """
+                    Sets properties for current infer request.
+        
+                    :param property: tuple of (property name, matching property value).
+                    :type property: tuple
+        """
+    @typing.overload
     def set_tensor(self, name: str, tensor: RemoteTensor) -> None:
         """
                     Sets input/output tensor of InferRequest.
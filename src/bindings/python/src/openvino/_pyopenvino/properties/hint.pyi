@@ -6,7 +6,7 @@ import typing
 """
 openvino.properties.hint submodule that simulates ov::hint
 """
-__all__: list[str] = ['ExecutionMode', 'ModelDistributionPolicy', 'PerformanceMode', 'Priority', 'SchedulingCoreType', 'activations_scale_factor', 'allow_auto_batching', 'compiled_blob', 'dynamic_quantization_group_size', 'enable_cpu_pinning', 'enable_cpu_reservation', 'enable_hyper_threading', 'execution_mode', 'inference_precision', 'kv_cache_precision', 'model', 'model_distribution_policy', 'model_priority', 'num_requests', 'performance_mode', 'scheduling_core_type']
+__all__: list[str] = ['ExecutionMode', 'ModelDistributionPolicy', 'PerformanceMode', 'Priority', 'SchedulingCoreType', 'activations_scale_factor', 'allow_auto_batching', 'compiled_blob', 'dynamic_quantization_group_size', 'enable_cpu_pinning', 'enable_cpu_reservation', 'enable_hyper_threading', 'execution_mode', 'inference_precision', 'kv_cache_precision', 'model', 'model_distribution_policy', 'model_priority', 'num_requests', 'performance_mode', 'request_deadline', 'request_priority', 'scheduling_core_type']
 class ExecutionMode:
     """
     Members:
@@ -335,6 +335,18 @@ def performance_mode() -> str:
 def performance_mode(arg0: PerformanceMode) -> tuple[str, openvino._pyopenvino.OVAny]:
     ...
 @typing.overload
+def request_deadline() -> str:
+    ...
+@typing.overload
+def request_deadline(arg0: typing.SupportsInt | typing.SupportsIndex) -> tuple[str, openvino._pyopenvino.OVAny]:
+    ...
+@typing.overload
+def request_priority() -> str:
+    ...
+@typing.overload
+def request_priority(arg0: Priority) -> tuple[str, openvino._pyopenvino.OVAny]:
+    ...
+@typing.overload
 def scheduling_core_type() -> str:
     ...
 @typing.overload
@@ -6,7 +6,7 @@ import typing
 """
 openvino.properties.intel_auto submodule that simulates ov::intel_auto
 """
-__all__: list[str] = ['SchedulePolicy', 'device_bind_buffer', 'devices_utilization_threshold', 'enable_runtime_fallback', 'enable_startup_fallback', 'schedule_policy']
+__all__: list[str] = ['SchedulePolicy', 'device_bind_buffer', 'devices_load_statistics', 'devices_utilization_threshold', 'enable_cpu_hot_swap', 'enable_runtime_fallback', 'enable_startup_fallback', 'schedule_policy']
 class SchedulePolicy:
     """
     Members:
@@ -15,12 +15,15 @@ class SchedulePolicy:
     
       DEVICE_PRIORITY
     
+      SHORTEST_EXPECTED_DELAY
+    
       DEFAULT
     """
     DEFAULT: typing.ClassVar[SchedulePolicy]  # value = <SchedulePolicy.DEVICE_PRIORITY: 1>
     DEVICE_PRIORITY: typing.ClassVar[SchedulePolicy]  # value = <SchedulePolicy.DEVICE_PRIORITY: 1>
     ROUND_ROBIN: typing.ClassVar[SchedulePolicy]  # value = <SchedulePolicy.ROUND_ROBIN: 0>
-    __members__: typing.ClassVar[dict[str, SchedulePolicy]]  # value = {'ROUND_ROBIN': <SchedulePolicy.ROUND_ROBIN: 0>, 'DEVICE_PRIORITY': <SchedulePolicy.DEVICE_PRIORITY: 1>, 'DEFAULT': <SchedulePolicy.DEVICE_PRIORITY: 1>}
+    SHORTEST_EXPECTED_DELAY: typing.ClassVar[SchedulePolicy]  # value = <SchedulePolicy.SHORTEST_EXPECTED_DELAY: 2>
+    __members__: typing.ClassVar[dict[str, SchedulePolicy]]  # value = {'ROUND_ROBIN': <SchedulePolicy.ROUND_ROBIN: 0>, 'DEVICE_PRIORITY': <SchedulePolicy.DEVICE_PRIORITY: 1>, 'SHORTEST_EXPECTED_DELAY': <SchedulePolicy.SHORTEST_EXPECTED_DELAY: 2>, 'DEFAULT': <SchedulePolicy.DEVICE_PRIORITY: 1>}
     def __eq__(self, other: typing.Any) -> bool:
         ...
     def __ge__(self, other: typing.Any) -> bool:
@@ -61,6 +64,8 @@ def device_bind_buffer() -> str:
 @typing.overload
 def device_bind_buffer(arg0: bool) -> tuple[str, openvino._pyopenvino.OVAny]:
     ...
+def devices_load_statistics() -> str:
+    ...
 @typing.overload
 def devices_utilization_threshold() -> str:
     ...
@@ -68,6 +73,12 @@ def devices_utilization_threshold() -> str:
 def devices_utilization_threshold(arg0: collections.abc.Mapping[str, typing.SupportsInt | typing.SupportsIndex]) -> tuple[str, openvino._pyopenvino.OVAny]:
     ...
 @typing.overload
+def enable_cpu_hot_swap() -> str:
+    ...
+@typing.overload
+def enable_cpu_hot_swap(arg0: bool) -> tuple[str, openvino._pyopenvino.OVAny]:
+    ...
+@typing.overload
 def enable_runtime_fallback() -> str:
     ...
 @typing.overload
@@ -37,6 +37,7 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::workload_type, "workload_type");
     wrap_property_RW(m_properties, ov::cache_mode, "cache_mode");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
+    wrap_property_RW(m_properties, ov::auto_batch_partial_batches, "auto_batch_partial_batches");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
@@ -59,6 +60,7 @@ void regmodule_properties(py::module m) {
     wrap_property_RO(m_properties, ov::range_for_async_infer_requests, "range_for_async_infer_requests");
     wrap_property_RO(m_properties, ov::execution_devices, "execution_devices");
     wrap_property_RO(m_properties, ov::loaded_from_cache, "loaded_from_cache");
+    wrap_property_RO(m_properties, ov::request_queue_wait, "request_queue_wait");
     wrap_property_RO(m_properties, ov::compatibility_check, "compatibility_check");
     wrap_property_RO(m_properties, ov::runtime_requirements, "runtime_requirements");
 
@@ -96,6 +98,8 @@ void regmodule_properties(py::module m) {
     // Submodule hint - properties
     wrap_property_RW(m_hint, ov::hint::inference_precision, "inference_precision");
     wrap_property_RW(m_hint, ov::hint::model_priority, "model_priority");
+    wrap_property_RW(m_hint, ov::hint::request_priority, "request_priority");
+    wrap_property_RW(m_hint, ov::hint::request_deadline, "request_deadline");
     wrap_property_RW(m_hint, ov::hint::performance_mode, "performance_mode");
     wrap_property_RW(m_hint, ov::hint::enable_cpu_pinning, "enable_cpu_pinning");
     wrap_property_RW(m_hint, ov::hint::enable_cpu_reservation, "enable_cpu_reservation");
@@ -333,13 +337,16 @@ void regmodule_properties(py::module m) {
     py::enum_<ov::intel_auto::SchedulePolicy>(m_intel_auto, "SchedulePolicy", py::arithmetic())
         .value("ROUND_ROBIN", ov::intel_auto::SchedulePolicy::ROUND_ROBIN)
         .value("DEVICE_PRIORITY", ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY)
+        .value("SHORTEST_EXPECTED_DELAY", ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY)
         .value("DEFAULT", ov::intel_auto::SchedulePolicy::DEFAULT);
 
     wrap_property_RW(m_intel_auto, ov::intel_auto::device_bind_buffer, "device_bind_buffer");
     wrap_property_RW(m_intel_auto, ov::intel_auto::enable_startup_fallback, "enable_startup_fallback");
     wrap_property_RW(m_intel_auto, ov::intel_auto::enable_runtime_fallback, "enable_runtime_fallback");
+    wrap_property_RW(m_intel_auto, ov::intel_auto::enable_cpu_hot_swap, "enable_cpu_hot_swap");
     wrap_property_RW(m_intel_auto, ov::intel_auto::schedule_policy, "schedule_policy");
     wrap_property_RW(m_intel_auto, ov::intel_auto::devices_utilization_threshold, "devices_utilization_threshold");
+    wrap_property_RO(m_intel_auto, ov::intel_auto::devices_load_statistics, "devices_load_statistics");
 
     // Submodule npu
     py::module m_intel_npu =
@@ -135,6 +135,7 @@ def test_properties_rw_base():
             (
                 (intel_auto.SchedulePolicy.ROUND_ROBIN, "SchedulePolicy.ROUND_ROBIN", 0),
                 (intel_auto.SchedulePolicy.DEVICE_PRIORITY, "SchedulePolicy.DEVICE_PRIORITY", 1),
+                (intel_auto.SchedulePolicy.SHORTEST_EXPECTED_DELAY, "SchedulePolicy.SHORTEST_EXPECTED_DELAY", 2),
                 (intel_auto.SchedulePolicy.DEFAULT, "SchedulePolicy.DEVICE_PRIORITY", 1),
             ),
         ),
@@ -193,6 +194,7 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (props.range_for_async_infer_requests, "RANGE_FOR_ASYNC_INFER_REQUESTS"),
         (props.execution_devices, "EXECUTION_DEVICES"),
         (props.loaded_from_cache, "LOADED_FROM_CACHE"),
+        (props.request_queue_wait, "REQUEST_QUEUE_WAIT"),
         (props.runtime_requirements, "RUNTIME_REQUIREMENTS"),
         (props.compatibility_check, "COMPATIBILITY_CHECK"),
         (device.full_name, "FULL_DEVICE_NAME"),
@@ -208,6 +210,7 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (intel_gpu.uarch_version, "GPU_UARCH_VERSION"),
         (intel_gpu.execution_units_count, "GPU_EXECUTION_UNITS_COUNT"),
         (intel_gpu.memory_statistics, "GPU_MEMORY_STATISTICS"),
+        (intel_auto.devices_load_statistics, "DEVICES_LOAD_STATISTICS"),
         (intel_npu.device_alloc_mem_size, "NPU_DEVICE_ALLOC_MEM_SIZE"),
         (intel_npu.device_total_mem_size, "NPU_DEVICE_TOTAL_MEM_SIZE"),
         (intel_npu.driver_version, "NPU_DRIVER_VERSION"),
@@ -250,6 +253,16 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (props.CacheMode.OPTIMIZE_SPEED, props.CacheMode.OPTIMIZE_SPEED),
             ),
         ),
+        (
+            props.auto_batch_partial_batches,
+            "AUTO_BATCH_PARTIAL_BATCHES",
+            (
+                (True, True),
+                (False, False),
+                (1, True),
+                (0, False),
+            ),
+        ),
         (
             props.auto_batch_timeout,
             "AUTO_BATCH_TIMEOUT",
@@ -298,6 +311,16 @@ def test_properties_ro(ov_property_ro, expected_value):
             "MODEL_PRIORITY",
             ((hints.Priority.LOW, hints.Priority.LOW),),
         ),
+        (
+            hints.request_priority,
+            "REQUEST_PRIORITY",
+            ((hints.Priority.HIGH, hints.Priority.HIGH),),
+        ),
+        (
+            hints.request_deadline,
+            "REQUEST_DEADLINE",
+            ((500, 500), (np.uint64(500), 500)),
+        ),
         (
             hints.performance_mode,
             "PERFORMANCE_HINT",
@@ -420,6 +443,16 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (0, False),
             ),
         ),
+        (
+            intel_auto.enable_cpu_hot_swap,
+            "ENABLE_CPU_HOT_SWAP",
+            (
+                (True, True),
+                (False, False),
+                (1, True),
+                (0, False),
+            ),
+        ),
         (device.id, "DEVICE_ID", (("0", "0"),)),
         (
             log.level,
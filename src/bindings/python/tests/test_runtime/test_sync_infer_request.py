@@ -9,6 +9,7 @@ import os
 import pytest
 import datetime
 import openvino.properties as props
+import openvino.properties.hint as hints
 
 import openvino.opset13 as ops
 from openvino import (
@@ -359,6 +360,23 @@ def test_get_compiled_model(device):
     assert np.allclose(ref[0], test[0])
 
 
+def test_infer_request_properties(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    request.set_property({hints.request_priority: hints.Priority.HIGH, hints.request_deadline: 1000})
+    assert request.get_property(hints.request_priority) == hints.Priority.HIGH
+    assert request.get_property(hints.request_deadline) == 1000
+    request.set_property(hints.request_priority(hints.Priority.LOW))
+    assert request.get_property(hints.request_priority) == hints.Priority.LOW
+
+    request.start_async({0: arr_1, 1: arr_2})
+    request.wait()
+    assert request.get_property(props.request_queue_wait) >= 0
+
+    with pytest.raises(RuntimeError, match="Unsupported property"):
+        request.set_property({props.enable_profiling: True})
+
+
 @pytest.mark.parametrize("share_inputs", [True, False])
 def test_get_results(device, share_inputs):
     core = Core()
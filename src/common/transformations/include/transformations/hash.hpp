@@ -28,12 +28,16 @@ public:
      * @param output_hash_value Reference to output value. By applying hash pass on function, resulting hash value
      * will be set to this variable
      * @param skip_weights If set to true, simplifies the hashing process by excluding weights values.
+     * @param hash_weights_by_source If set to true, the weights backed by a weights file are hashed by the file identity
+     * (path or file id, last write time) and the offset in the file instead of the values. Other weights are hashed by
+     * values.
      */
-    Hash(uint64_t& output_hash_value, bool skip_weights = false);
+    Hash(uint64_t& output_hash_value, bool skip_weights = false, bool hash_weights_by_source = false);
 
 private:
     uint64_t& m_hash;
     bool m_skip_weights;
+    bool m_hash_weights_by_source;
 };
 
 }  // namespace pass
@@ -8,6 +8,7 @@
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/container_util.hpp"
 #include "transformations/hash.hpp"
 
@@ -96,4 +97,44 @@ TEST(HashTest, same_model_struct_different_weigth_by_offset) {
     EXPECT_NE(hash1, hash2);
 }
 
+namespace {
+// model with the weights in a buffer which pretends to be read from a weights file
+std::shared_ptr<Model> make_model_with_source(int data_value, size_t source_id) {
+    auto buffer = std::make_shared<AlignedBuffer>(sizeof(int));
+    *buffer->get_ptr<int>() = data_value;
+    using WeightsBuffer = SharedBuffer<std::shared_ptr<AlignedBuffer>>;
+    auto weights = std::make_shared<WeightsBuffer>(buffer->get_ptr<char>(),
+                                                   buffer->size(),
+                                                   buffer,
+                                                   create_base_descriptor(source_id, 0, buffer));
+    auto out = std::make_shared<Add>(std::make_shared<Parameter>(element::i32, Shape{1}),
+                                     std::make_shared<Constant>(element::i32, Shape{1}, weights));
+    return std::make_shared<Model>(OutputVector{out}, "TestModel");
+}
+
+uint64_t hash_by_source(const std::shared_ptr<Model>& model) {
+    uint64_t hash = 0;
+    ov::pass::Hash hasher(hash, false, true);
+    hasher.run_on_model(model);
+    return hash;
+}
+}  // namespace
+
+TEST(HashTest, weights_hashed_by_source) {
+    // the values are not read, the weights are identified by the source and the offset in it
+    EXPECT_EQ(hash_by_source(make_model_with_source(121, 1)), hash_by_source(make_model_with_source(13, 1)));
+    EXPECT_NE(hash_by_source(make_model_with_source(121, 1)), hash_by_source(make_model_with_source(121, 2)));
+}
+
+TEST(HashTest, in_memory_weights_hashed_by_values_with_source) {
+    auto make_model = [](int data_value) {
+        auto out = std::make_shared<Add>(std::make_shared<Parameter>(element::i32, Shape{1}),
+                                         std::make_shared<Constant>(element::i32, Shape{1}, &data_value));
+        return std::make_shared<Model>(OutputVector{out}, "TestModel");
+    };
+
+    EXPECT_EQ(hash_by_source(make_model(121)), hash_by_source(make_model(121)));
+    EXPECT_NE(hash_by_source(make_model(121)), hash_by_source(make_model(13)));
+}
+
 }  // namespace ov::test
@@ -302,7 +302,11 @@ inline uint64_t get_id_for_file(const std::filesystem::path& path, size_t offset
     for (const auto* value = path.c_str(); *value != 0; ++value) {
         path_hash = util::u64_hash_combine(path_hash, static_cast<uint64_t>(static_cast<unsigned_value_type>(*value)));
     }
-    return util::u64_hash_combine(path_hash, {offset, size});
+    // The last write time makes the id change when the file is rewritten, so the id identifies the file content
+    std::error_code ec;
+    const auto write_time = std::filesystem::last_write_time(path, ec);
+    const auto version = ec ? uint64_t{0} : static_cast<uint64_t>(write_time.time_since_epoch().count());
+    return util::u64_hash_combine(path_hash, {offset, size, version});
 }
 
 /**
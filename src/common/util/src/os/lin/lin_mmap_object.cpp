@@ -175,8 +175,13 @@ public:
             }
             m_data = static_cast<char*>(m_mapped_view) + gap;
         }
-        m_id =
-            util::u64_hash_combine(static_cast<uint64_t>(sb.st_ino), {static_cast<uint64_t>(sb.st_dev), offset, size});
+        m_id = util::u64_hash_combine(static_cast<uint64_t>(sb.st_ino),
+                                      {static_cast<uint64_t>(sb.st_dev),
+                                       offset,
+                                       size,
+                                       static_cast<uint64_t>(sb.st_mtim.tv_sec),
+                                       static_cast<uint64_t>(sb.st_mtim.tv_nsec),
+                                       static_cast<uint64_t>(sb.st_size)});
     }
 
     uint64_t get_id() const noexcept override {
@@ -462,17 +462,22 @@ MapHolder::~MapHolder() {
 }
 
 void MapHolder::set_id(HANDLE h, size_t offset, size_t size) {
+    // The last write time makes the id change when the file is rewritten in place
+    uint64_t write_time = 0;
+    if (FILETIME time; ::GetFileTime(h, nullptr, nullptr, &time)) {
+        write_time = (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    }
     if (FILE_ID_INFO info; GetFileInformationByHandleEx(h, FileIdInfo, &info, sizeof(info))) {
         static_assert(sizeof(info.FileId) == sizeof(uint64_t[2]));
         uint64_t fid[2];
         std::memcpy(fid, &info.FileId, sizeof(fid));
-        m_id = util::u64_hash_combine(offset, {size, info.VolumeSerialNumber, fid[0], fid[1]});
+        m_id = util::u64_hash_combine(offset, {size, info.VolumeSerialNumber, fid[0], fid[1], write_time});
     } else if (BY_HANDLE_FILE_INFORMATION info; ::GetFileInformationByHandle(h, &info)) {
         // GetFileInformationByHandleEx/FileIdInfo is unavailable (network FS, ReFS, older FS).
         // Fall back to the legacy NTFS/FAT file index + volume serial, which are stable across separate opens of the
         // same file (unlike a raw HANDLE value).
         const uint64_t file_index = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
-        m_id = util::u64_hash_combine(offset, {size, info.dwVolumeSerialNumber, file_index});
+        m_id = util::u64_hash_combine(offset, {size, info.dwVolumeSerialNumber, file_index, write_time});
     } else {
         // Last-resort fallback when no stable file identity metadata is available (e.g. exotic virtual filesystems).
         // HANDLE values are process-local and change across opens, so weight sharing may not work in this case.
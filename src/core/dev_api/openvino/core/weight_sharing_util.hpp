@@ -101,6 +101,13 @@ struct OPENVINO_API Extension {
      */
     static std::shared_ptr<ov::AlignedBuffer> get_constant_source_buffer(const ov::op::v0::Constant& constant);
 
+    /** @brief Get the buffer which holds the data of constant node.
+     *
+     * @param constant Constant node to get buffer for.
+     * @return Return shared pointer to AlignedBuffer if constant has data, nullptr otherwise.
+     */
+    static std::shared_ptr<ov::AlignedBuffer> get_constant_buffer(const ov::op::v0::Constant& constant);
+
     /**
      * @brief Set constant metadata in weight registry for given constant node.
      *
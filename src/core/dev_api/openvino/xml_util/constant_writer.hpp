@@ -37,6 +37,10 @@ public:
         return m_data_hash;
     }
 
+protected:
+    // Computes the hash of the constant data. The derived writers may reuse the hashes computed before.
+    virtual HashValue compute_hash(const char* ptr, size_t size);
+
 private:
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
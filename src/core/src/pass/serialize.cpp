@@ -7,6 +7,8 @@
 #include <array>
 #include <cstdint>
 #include <fstream>
+#include <mutex>
+#include <typeinfo>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -17,6 +19,9 @@
 #include "openvino/core/model_util.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/core/weight_sharing_util.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/compute_hash.hpp"
@@ -303,6 +308,124 @@ public:
         return n;
     }
 };
+
+// The content hashes of the constant buffers, so the constants shared by the models compiled several times are hashed
+// once. Only the buffers allocated by the constants are memoized: their data is not changed, so a hash is valid while
+// its buffer is alive.
+class BufferHashCache {
+public:
+    static BufferHashCache& get() {
+        static BufferHashCache cache;
+        return cache;
+    }
+
+    template <typename F>
+    uint64_t get_or_compute(const std::shared_ptr<ov::AlignedBuffer>& buffer,
+                            const char* ptr,
+                            size_t size,
+                            const F& compute) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto found = m_hashes.find(ptr);
+            if (found != m_hashes.end() && found->second.size == size &&
+                !found->second.buffer.owner_before(buffer) && !buffer.owner_before(found->second.buffer)) {
+                return found->second.hash;
+            }
+        }
+
+        const uint64_t hash = compute(ptr, size);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_hashes.size() >= m_purge_size) {
+            for (auto it = m_hashes.begin(); it != m_hashes.end();) {
+                it = it->second.buffer.expired() ? m_hashes.erase(it) : std::next(it);
+            }
+            m_purge_size = std::max(m_purge_size, m_hashes.size() * 2);
+        }
+        m_hashes[ptr] = {buffer, size, hash};
+        return hash;
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<ov::AlignedBuffer> buffer;
+        size_t size;
+        uint64_t hash;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<const void*, Entry> m_hashes;
+    size_t m_purge_size = 1024;
+};
+
+// Hashes the constants backed by a weights file by the source id (which identifies the file and its version) and the
+// offset in the file instead of the values, so the weights are not read. The other constants are hashed by values,
+// the hashes are memoized per buffer owned by the constant. A shared buffer (e.g. a constant made from an ov::Tensor)
+// may be rewritten by its owner in place, so it is hashed every time.
+class SourceHashConstantWriter final : public util::ConstantWriter {
+public:
+    SourceHashConstantWriter(std::ostream& bin_data, const ov::Model& model) : util::ConstantWriter(bin_data, true) {
+        collect_sources(model);
+    }
+
+    using util::ConstantWriter::write;
+
+    FilePosition write(const char* ptr,
+                       size_t size,
+                       size_t& new_size,
+                       bool compress_to_fp16,
+                       ov::element::Type src_type,
+                       bool ptr_is_temporary) override {
+        const auto found = m_sources.find(ptr);
+        if (compress_to_fp16 || found == m_sources.end()) {
+            return util::ConstantWriter::write(ptr, size, new_size, compress_to_fp16, src_type, ptr_is_temporary);
+        }
+        new_size = size;
+        m_source_hash = util::u64_hash_combine(m_source_hash, {found->second.first, found->second.second, size});
+        return 0;
+    }
+
+    uint64_t get_source_hash() const {
+        return m_source_hash;
+    }
+
+protected:
+    HashValue compute_hash(const char* ptr, size_t size) override {
+        const auto found = m_buffers.find(ptr);
+        if (found == m_buffers.end()) {
+            return util::ConstantWriter::compute_hash(ptr, size);
+        }
+        return BufferHashCache::get().get_or_compute(found->second, ptr, size, [](const char* data, size_t data_size) {
+            return ov::runtime::compute_hash(data, data_size);
+        });
+    }
+
+private:
+    void collect_sources(const ov::Model& model) {
+        for (const auto& op : model.get_ops()) {
+            if (const auto constant = ov::as_type<ov::op::v0::Constant>(op.get())) {
+                const auto data = constant->get_data_ptr();
+                const auto source_id = weight_sharing::Extension::get_constant_source_id(*constant);
+                if (source_id != weight_sharing::invalid_source_id) {
+                    m_sources.emplace(data,
+                                      std::make_pair(source_id, weight_sharing::Extension::get_constant_id(*constant)));
+                } else if (auto buffer = weight_sharing::Extension::get_constant_buffer(*constant);
+                           buffer && typeid(*buffer) == typeid(ov::AlignedBuffer)) {
+                    m_buffers.emplace(data, std::move(buffer));
+                }
+            } else if (const auto multi_subgraph = ov::as_type<ov::op::util::MultiSubGraphOp>(op.get())) {
+                for (const auto& body : multi_subgraph->get_functions()) {
+                    collect_sources(*body);
+                }
+            }
+        }
+    }
+
+    // data pointer -> {source id, offset in the source}
+    std::unordered_map<const void*, std::pair<uint64_t, uint64_t>> m_sources;
+    // data pointer -> buffer allocated by the constant without a source
+    std::unordered_map<const void*, std::shared_ptr<ov::AlignedBuffer>> m_buffers;
+    uint64_t m_source_hash = 0;
+};
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
@@ -313,18 +436,27 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     std::ostream bin(&null_buffer);
 
     // Determinism is important for hash calculation
-    // If skip weights set, disable compression to skip internal data hashing
-    auto constant_writer = util::ConstantWriter(bin, !m_skip_weights);
-    serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
-
-    auto seed = util::u64_hash_combine(0, xml_hash.get_result());
-    m_hash = util::u64_hash_combine(seed, constant_writer.get_data_hash());
+    auto seed = uint64_t{0};
+    if (m_hash_weights_by_source && !m_skip_weights) {
+        auto constant_writer = SourceHashConstantWriter(bin, *model);
+        serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
+        seed = util::u64_hash_combine(seed, xml_hash.get_result());
+        seed = util::u64_hash_combine(seed, constant_writer.get_source_hash());
+        m_hash = util::u64_hash_combine(seed, constant_writer.get_data_hash());
+    } else {
+        // If skip weights set, disable compression to skip internal data hashing
+        auto constant_writer = util::ConstantWriter(bin, !m_skip_weights);
+        serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
+        seed = util::u64_hash_combine(seed, xml_hash.get_result());
+        m_hash = util::u64_hash_combine(seed, constant_writer.get_data_hash());
+    }
     // Return false because we didn't change OpenVINO Model
     return false;
 }
 
-pass::Hash::Hash(uint64_t& output_hash_value, bool skip_weights)
+pass::Hash::Hash(uint64_t& output_hash_value, bool skip_weights, bool hash_weights_by_source)
     : m_hash(output_hash_value),
-      m_skip_weights(skip_weights) {}
+      m_skip_weights(skip_weights),
+      m_hash_weights_by_source(hash_weights_by_source) {}
 
 }  // namespace ov
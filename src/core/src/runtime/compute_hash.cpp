@@ -2,16 +2,20 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-// The CRC computation is used for x86.
+// The CRC is computed with the JIT kernels on x86 and with the portable implementation giving the same value otherwise.
 // The calculations were taken from the article
 // "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction - Intel (December, 2009)".
 
 #include "openvino/runtime/compute_hash.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
-#include <iterator>
+#include <vector>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/visibility.hpp"
 
 #if !defined(OS_CHROMEOS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
@@ -19,7 +23,6 @@
 #endif
 
 #ifdef OV_CORE_USE_XBYAK_JIT
-#    include "openvino/core/parallel.hpp"
 #    include "openvino/reference/utils/registers_pool.hpp"
 #    include "openvino/util/os.hpp"
 #endif  // OV_CORE_USE_XBYAK_JIT
@@ -824,115 +827,244 @@ void ComputeHash<isa>::fold_to_64(const Vmm& v_dst) {
 }  // namespace jit
 #endif  // OV_CORE_USE_XBYAK_JIT
 
-size_t compute_hash(const void* src, size_t size) {
+namespace {
+
+// The polynomial of the CRC computed by the kernels (ECMA-182), without the x^64 term.
+constexpr uint64_t CRC_POLY = 0x42f0e1eba9ea3693;
+constexpr size_t CRC_BLOCK = 16lu;
+// The chunks smaller than this are not worth a separate thread.
+constexpr size_t MIN_CHUNK_SIZE = 1lu << 20;
+
+// a * b mod POLY
+uint64_t crc_mul(uint64_t a, uint64_t b) {
+    uint64_t res = 0lu;
+    for (int i = 63; i >= 0; --i) {
+        res = (res << 1) ^ ((res >> 63) ? CRC_POLY : 0lu);
+        if ((b >> i) & 1lu) {
+            res ^= a;
+        }
+    }
+    return res;
+}
+
+// x^(8 * bytes) mod POLY, multiplying a CRC by it appends the given number of zero bytes to the data.
+uint64_t crc_shift(uint64_t bytes) {
+    uint64_t res = 1lu;
+    for (uint64_t power = 1lu << 8; bytes != 0; bytes >>= 1, power = crc_mul(power, power)) {
+        if (bytes & 1lu) {
+            res = crc_mul(res, power);
+        }
+    }
+    return res;
+}
+
+// Slicing-by-8 tables: table[k][i] = i * x^(64 + 8 * k) mod POLY.
+struct CrcTables {
+    CrcTables() {
+        for (uint64_t i = 0; i < 256; ++i) {
+            uint64_t crc = i << 56;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc << 1) ^ ((crc >> 63) ? CRC_POLY : 0lu);
+            }
+            table[0][i] = crc;
+        }
+        for (size_t k = 1; k < table.size(); ++k) {
+            for (size_t i = 0; i < 256; ++i) {
+                table[k][i] = (table[k - 1][i] << 8) ^ table[0][table[k - 1][i] >> 56];
+            }
+        }
+    }
+
+    std::array<std::array<uint64_t, 256>, 8> table{};
+};
+
+uint64_t crc_update(uint64_t crc, const uint8_t* data, size_t size) {
+    static const CrcTables tables;
+    const auto& t = tables.table;
+    for (; size >= 8; data += 8, size -= 8) {
+        uint64_t word = 0lu;
+        for (size_t i = 0; i < 8; ++i) {
+            word = (word << 8) | data[i];
+        }
+        const auto v = crc ^ word;
+        crc = t[7][v >> 56] ^ t[6][(v >> 48) & 0xff] ^ t[5][(v >> 40) & 0xff] ^ t[4][(v >> 32) & 0xff] ^
+              t[3][(v >> 24) & 0xff] ^ t[2][(v >> 16) & 0xff] ^ t[1][(v >> 8) & 0xff] ^ t[0][v & 0xff];
+    }
+    for (; size > 0; ++data, --size) {
+        crc = (crc << 8) ^ t[0][(crc >> 56) ^ *data];
+    }
+    return crc;
+}
+
+uint64_t padded_size(size_t size) {
+    return std::max(CRC_BLOCK, (size + CRC_BLOCK - 1) / CRC_BLOCK * CRC_BLOCK);
+}
+
+// The same value as the kernels compute: the first block is combined with {~0, size_arg}, the data is padded with
+// zeros to the whole blocks.
+uint64_t crc_hash(const uint8_t* src, size_t size, uint64_t size_arg) {
+    std::array<uint8_t, CRC_BLOCK> first{};
+    std::memcpy(first.data(), src, std::min(size, CRC_BLOCK));
+    for (size_t i = 0; i < 8; ++i) {
+        first[i] ^= 0xff;
+        first[8 + i] ^= static_cast<uint8_t>(size_arg >> (56 - 8 * i));
+    }
+    auto crc = crc_update(0lu, first.data(), first.size());
+    if (size > CRC_BLOCK) {
+        crc = crc_update(crc, src + CRC_BLOCK, size - CRC_BLOCK);
+        crc = crc_mul(crc, crc_shift(padded_size(size) - size));
+    }
+    return crc;
+}
+
+// Splits the data into the chunks of the whole blocks hashed in parallel, and combines the chunk CRCs as
+// crc(A + B) = crc(A) * x^(8 * |B|) + crc(B). Only the first chunk hash combines the initial value with the data
+// size, chunk_hash(src, size, 0) for the rest ones is compensated for the initial value {~0, 0}.
+template <typename F>
+uint64_t crc_hash_parallel(const uint8_t* src, size_t size, size_t chunks_num, const F& chunk_hash) {
+    static const auto init_crc = [] {
+        std::array<uint8_t, CRC_BLOCK> init{};
+        std::fill_n(init.begin(), 8, 0xff);
+        return crc_update(0lu, init.data(), init.size());
+    }();
+
+    const auto chunk = padded_size((size + chunks_num - 1) / chunks_num);
+    chunks_num = (size + chunk - 1) / chunk;
+    std::vector<uint64_t> crcs(chunks_num, 0lu);
+    parallel_for(chunks_num, [&](size_t i) {
+        const auto start = chunk * i;
+        const auto chunk_size = std::min<size_t>(chunk, size - start);
+        if (i == 0) {
+            crcs[i] = chunk_hash(src, chunk_size, size);
+        } else {
+            crcs[i] = chunk_hash(src + start, chunk_size, 0lu) ^
+                      crc_mul(init_crc, crc_shift(padded_size(chunk_size) - CRC_BLOCK));
+        }
+    });
+
+    uint64_t result = 0lu;
+    for (size_t i = 0; i < chunks_num; ++i) {
+        const auto chunk_size = std::min<size_t>(chunk, size - chunk * i);
+        result = crc_mul(result, crc_shift(padded_size(chunk_size))) ^ crcs[i];
+    }
+    return result;
+}
+
+size_t hash_chunks_num(size_t size) {
+    return std::min<size_t>(parallel_get_max_threads(), size / MIN_CHUNK_SIZE);
+}
+
 #ifdef OV_CORE_USE_XBYAK_JIT
-    if (util::may_i_use_dynamic_code()) {
-        if (Generator::mayiuse(avx2)) {
-            uint64_t result = 0lu;
+uint64_t jit_hash(const void* src, size_t size, uint64_t size_arg) {
+    static auto single_thr_kernel = [] {
+        if (Generator::mayiuse(avx512_core))
+            return jit::ComputeHash<avx512_core>::create({jit::SINGLE_THREAD});
+        else
+            return jit::ComputeHash<avx2>::create({jit::SINGLE_THREAD});
+    }();
+
+    uint64_t result = 0lu;
+    jit::ComputeHashCallArgs args;
+    args.src_ptr = src;
+    args.dst_ptr = &result;
+    args.k_ptr = jit::K_PULL;
+    args.work_amount = static_cast<uint64_t>(size);
+    args.size = size_arg;
+
+    (*single_thr_kernel)(&args);
+    return result;
+}
+#endif  // OV_CORE_USE_XBYAK_JIT
 
-            // Parallel section
-            constexpr uint64_t min_wa_per_thread = 131072lu;  // 2^17
-            const uint64_t size_u64 = static_cast<uint64_t>(size);
-            if (size_u64 >= min_wa_per_thread * 2lu) {
-                // MSVC>=19.51 miscompiles static local initialization with ternary + non-trivial return type.
-                // Using IIFE with if/else as a workaround. Remove when MSVC fixes the bug.
-                // https://developercommunity.visualstudio.com/t/11105892
-                static auto first_thr_kernel = [] {
-                    if (Generator::mayiuse(avx512_core))
-                        return jit::ComputeHash<avx512_core>::create({jit::FIRST_THREAD});
-                    else
-                        return jit::ComputeHash<avx2>::create({jit::FIRST_THREAD});
-                }();
-                static auto n_thr_kernel = [] {
-                    if (Generator::mayiuse(avx512_core))
-                        return jit::ComputeHash<avx512_core>::create({jit::N_THREAD});
-                    else
-                        return jit::ComputeHash<avx2>::create({jit::N_THREAD});
-                }();
-                static auto final_fold_kernel = [] {
-                    if (Generator::mayiuse(avx512_core))
-                        return jit::ComputeHash<avx512_core>::create({jit::FINAL_FOLD});
-                    else
-                        return jit::ComputeHash<avx2>::create({jit::FINAL_FOLD});
-                }();
-
-                static const uint64_t max_thr_num = 2lu;
-                uint64_t thr_num = std::min(size_u64 / min_wa_per_thread, max_thr_num);
-                const uint64_t el_per_thread =
-                    first_thr_kernel->get_vlen() * ((size_u64 / thr_num) / first_thr_kernel->get_vlen());
-                std::vector<uint8_t> intermediate(thr_num * first_thr_kernel->get_vlen());
-
-                parallel_nt_static(static_cast<int>(thr_num), [&](const int ithr, const int nthr) {
-                    uint64_t start = el_per_thread * ithr;
-                    if (start >= size_u64) {
-                        return;
-                    }
-                    uint64_t work_amount = (el_per_thread + start > size_u64) ? size_u64 - start : el_per_thread;
-
-                    jit::ComputeHashCallArgs args;
-
-                    args.src_ptr = reinterpret_cast<const uint8_t*>(src) + first_thr_kernel->get_vlen() * ithr;
-                    args.dst_ptr = &(intermediate[first_thr_kernel->get_vlen() * ithr]);
-                    args.k_ptr = jit::K_PULL;
-                    args.work_amount = work_amount;
-                    args.size = size_u64;
-                    args.threads_num = thr_num;
-
-                    if (ithr == 0) {
-                        (*first_thr_kernel)(&args);
-                    } else {
-                        (*n_thr_kernel)(&args);
-                    }
-                });
+}  // namespace
 
-                jit::ComputeHashCallArgs args;
-                args.work_amount = size_u64 - el_per_thread * thr_num;
-                args.src_ptr = reinterpret_cast<const uint8_t*>(src) + size_u64 - args.work_amount;
-                args.dst_ptr = &result;
-                args.k_ptr = jit::K_PULL;
-                args.size = size_u64;
-                args.intermediate_ptr = intermediate.data();
+size_t compute_hash(const void* src, size_t size) {
+    const auto data = static_cast<const uint8_t*>(src);
+    const auto chunks_num = hash_chunks_num(size);
+#ifdef OV_CORE_USE_XBYAK_JIT
+    if (util::may_i_use_dynamic_code() && Generator::mayiuse(avx2) && Generator::mayiuse(pclmulqdq)) {
+        // Large buffers are split into the chunks for all the threads, a chunk is hashed by the single thread kernel
+        if (chunks_num > 2) {
+            return crc_hash_parallel(data, size, chunks_num, jit_hash);
+        }
 
-                (*final_fold_kernel)(&args);
-            } else {
-                static auto single_thr_kernel = [] {
-                    if (Generator::mayiuse(avx512_core))
-                        return jit::ComputeHash<avx512_core>::create({jit::SINGLE_THREAD});
-                    else
-                        return jit::ComputeHash<avx2>::create({jit::SINGLE_THREAD});
-                }();
+        // Parallel section
+        constexpr uint64_t min_wa_per_thread = 131072lu;  // 2^17
+        const uint64_t size_u64 = static_cast<uint64_t>(size);
+        if (size_u64 >= min_wa_per_thread * 2lu) {
+            uint64_t result = 0lu;
+            // MSVC>=19.51 miscompiles static local initialization with ternary + non-trivial return type.
+            // Using IIFE with if/else as a workaround. Remove when MSVC fixes the bug.
+            // https://developercommunity.visualstudio.com/t/11105892
+            static auto first_thr_kernel = [] {
+                if (Generator::mayiuse(avx512_core))
+                    return jit::ComputeHash<avx512_core>::create({jit::FIRST_THREAD});
+                else
+                    return jit::ComputeHash<avx2>::create({jit::FIRST_THREAD});
+            }();
+            static auto n_thr_kernel = [] {
+                if (Generator::mayiuse(avx512_core))
+                    return jit::ComputeHash<avx512_core>::create({jit::N_THREAD});
+                else
+                    return jit::ComputeHash<avx2>::create({jit::N_THREAD});
+            }();
+            static auto final_fold_kernel = [] {
+                if (Generator::mayiuse(avx512_core))
+                    return jit::ComputeHash<avx512_core>::create({jit::FINAL_FOLD});
+                else
+                    return jit::ComputeHash<avx2>::create({jit::FINAL_FOLD});
+            }();
+
+            static const uint64_t max_thr_num = 2lu;
+            uint64_t thr_num = std::min(size_u64 / min_wa_per_thread, max_thr_num);
+            const uint64_t el_per_thread =
+                first_thr_kernel->get_vlen() * ((size_u64 / thr_num) / first_thr_kernel->get_vlen());
+            std::vector<uint8_t> intermediate(thr_num * first_thr_kernel->get_vlen());
+
+            parallel_nt_static(static_cast<int>(thr_num), [&](const int ithr, const int nthr) {
+                uint64_t start = el_per_thread * ithr;
+                if (start >= size_u64) {
+                    return;
+                }
+                uint64_t work_amount = (el_per_thread + start > size_u64) ? size_u64 - start : el_per_thread;
 
                 jit::ComputeHashCallArgs args;
-                args.src_ptr = src;
-                args.dst_ptr = &result;
+
+                args.src_ptr = reinterpret_cast<const uint8_t*>(src) + first_thr_kernel->get_vlen() * ithr;
+                args.dst_ptr = &(intermediate[first_thr_kernel->get_vlen() * ithr]);
                 args.k_ptr = jit::K_PULL;
-                args.work_amount = size_u64;
+                args.work_amount = work_amount;
                 args.size = size_u64;
-
-                (*single_thr_kernel)(&args);
-            }
-
+                args.threads_num = thr_num;
+
+                if (ithr == 0) {
+                    (*first_thr_kernel)(&args);
+                } else {
+                    (*n_thr_kernel)(&args);
+                }
+            });
+
+            jit::ComputeHashCallArgs args;
+            args.work_amount = size_u64 - el_per_thread * thr_num;
+            args.src_ptr = reinterpret_cast<const uint8_t*>(src) + size_u64 - args.work_amount;
+            args.dst_ptr = &result;
+            args.k_ptr = jit::K_PULL;
+            args.size = size_u64;
+            args.intermediate_ptr = intermediate.data();
+
+            (*final_fold_kernel)(&args);
             return result;
         }
-    }
 
+        return jit_hash(src, size, size_u64);
+    }
 #endif  // OV_CORE_USE_XBYAK_JIT
 
-    constexpr auto cel_size = sizeof(size_t);
-    size_t seed = size;
-    const auto data = static_cast<const size_t*>(src);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-
-    return seed;
+    // The portable implementation gives the same value as the kernels
+    if (chunks_num > 1) {
+        return crc_hash_parallel(data, size, chunks_num, crc_hash);
+    }
+    return crc_hash(data, size, size);
 }
 
 }  // namespace runtime
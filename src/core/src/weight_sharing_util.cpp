@@ -99,6 +99,10 @@ std::shared_ptr<ov::AlignedBuffer> Extension::get_constant_source_buffer(const o
     return desc ? desc->get_source_buffer() : nullptr;
 }
 
+std::shared_ptr<ov::AlignedBuffer> Extension::get_constant_buffer(const ov::op::v0::Constant& constant) {
+    return constant.m_data;
+}
+
 void Extension::hint_evict(ov::op::v0::Constant& constant) noexcept {
     if (constant.m_data) {
         if (constant.m_data->get_descriptor()) {
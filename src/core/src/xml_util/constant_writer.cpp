@@ -38,7 +38,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        const HashValue hash = compute_hash(data_ptr, new_size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
@@ -101,6 +101,10 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
     }
 }
 
+ConstantWriter::HashValue ConstantWriter::compute_hash(const char* ptr, size_t size) {
+    return ov::runtime::compute_hash(ptr, size);
+}
+
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                                                               size_t size,
                                                               const element::Type& src_type,
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/compute_hash.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "transformations/hash.hpp"
+
+namespace ov::test {
+
+namespace {
+// Bitwise CRC-64 (ECMA-182) of the data padded with zeros to 16 bytes blocks, the first block is combined with
+// {~0, size}. This is the value of the JIT kernels, so all the implementations have to give it.
+uint64_t reference_hash(const std::vector<uint8_t>& data) {
+    constexpr uint64_t poly = 0x42f0e1eba9ea3693;
+    const auto size = static_cast<uint64_t>(data.size());
+    std::vector<uint8_t> padded(data);
+    padded.resize(std::max<size_t>(16, (data.size() + 15) / 16 * 16), 0);
+    for (size_t i = 0; i < 8; ++i) {
+        padded[i] ^= 0xff;
+        padded[8 + i] ^= static_cast<uint8_t>(size >> (56 - 8 * i));
+    }
+
+    uint64_t crc = 0;
+    for (const auto byte : padded) {
+        crc ^= static_cast<uint64_t>(byte) << 56;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc << 1) ^ ((crc >> 63) ? poly : 0);
+        }
+    }
+    return crc;
+}
+
+std::vector<uint8_t> random_data(size_t size) {
+    std::mt19937 gen(static_cast<unsigned>(size));
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> data(size);
+    for (auto& value : data) {
+        value = static_cast<uint8_t>(dist(gen));
+    }
+    return data;
+}
+}  // namespace
+
+TEST(compute_hash, small_sizes) {
+    for (size_t size = 0; size < 300; ++size) {
+        const auto data = random_data(size);
+        EXPECT_EQ(runtime::compute_hash(data.data(), data.size()), static_cast<size_t>(reference_hash(data)))
+            << "size " << size;
+    }
+}
+
+TEST(compute_hash, large_sizes) {
+    // the sizes hashed by several threads and by the chunks for all the threads
+    for (const size_t size : {size_t{1} << 18, (size_t{1} << 18) + 17, (size_t{9} << 20) + 5}) {
+        const auto data = random_data(size);
+        EXPECT_EQ(runtime::compute_hash(data.data(), data.size()), static_cast<size_t>(reference_hash(data)))
+            << "size " << size;
+    }
+}
+
+// A constant made from a tensor shares the memory of the caller, which may rewrite it in place before the next compile.
+TEST(compute_hash, model_hash_follows_shared_constant_data) {
+    const auto data = random_data(1024);
+    ov::Tensor tensor(ov::element::u8, ov::Shape{data.size()});
+    std::memcpy(tensor.data(), data.data(), data.size());
+    const auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{data.size()});
+    const auto add = std::make_shared<ov::op::v1::Add>(param, std::make_shared<ov::op::v0::Constant>(tensor));
+    const auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param});
+
+    const auto model_hash = [&] {
+        uint64_t hash = 0;
+        ov::pass::Hash(hash, false, true).run_on_model(model);
+        return hash;
+    };
+    const auto before = model_hash();
+    EXPECT_EQ(before, model_hash());
+    tensor.data<uint8_t>()[data.size() / 2] ^= 0xff;
+    EXPECT_NE(before, model_hash());
+}
+
+}  // namespace ov::test
@@ -82,6 +82,30 @@ TEST(MappedMemory, get_id_same_for_same_file) {
     std::filesystem::remove(file_path);
 }
 
+TEST(MappedMemory, get_id_changes_on_file_rewrite) {
+    std::filesystem::path file_path = utils::generateTestFilePrefix() + "_rewritten_file";
+    const char test_data[] = "Test data for rewritten file";
+
+    {
+        std::ofstream os(file_path, std::ios::binary);
+        os.write(test_data, sizeof(test_data));
+    }
+    const auto id = load_mmap_object(file_path)->get_id();
+
+    // The same path, offset and size rewritten a moment later, well within the same second. The pause only outlasts the
+    // tick of the file system clock, the last write time is not touched.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+        std::ofstream os(file_path, std::ios::binary);
+        const char new_data[] = "Data for the rewritten file!";
+        static_assert(sizeof(new_data) == sizeof(test_data));
+        os.write(new_data, sizeof(new_data));
+    }
+    EXPECT_NE(load_mmap_object(file_path)->get_id(), id);
+
+    std::filesystem::remove(file_path);
+}
+
 struct RangedMappingTestRegions {
     size_t offset_1;
     size_t size_1;
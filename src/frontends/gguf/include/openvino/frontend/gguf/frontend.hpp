@@ -12,6 +12,12 @@
 
 namespace ov::frontend::gguf {
 
+/// \brief Load option, a bool entry of the `ov::AnyMap` passed to `load()` after the decoder. When true, the
+/// Q3_K/Q5_K/Q6_K weights keep their native bitness as u3/u6 compressed weights, which the CPU plugin decompresses
+/// inside FullyConnected. Off by default: Q5_K/Q6_K are requantized to channel-wise Q8_0_C and Q3_K is inflated to
+/// i4, as in the llama.cpp ggml-openvino backend, which every device runs without expanding the weights to f16.
+inline constexpr const char* native_k_quants = "NATIVE_K_QUANTS";
+
 class GGUF_FRONTEND_API FrontEnd : public ov::frontend::FrontEnd {
 public:
     using Ptr = std::shared_ptr<FrontEnd>;
@@ -55,10 +61,11 @@ protected:
     bool supported_impl(const std::vector<ov::Any>& variants) const override;
 
     /// \brief Load the input model from a GgufDecoder.
-    /// \param variants A single element holding a `std::shared_ptr<GgufDecoder>` -- a decoder
-    ///        supplied by a direct linker, wrapping an already-built ggml graph (the llama.cpp
-    ///        cgraph path). File-path (`.gguf`) loading, built per-architecture by the native
-    ///        builder, is not yet implemented in this frontend.
+    /// \param variants A `std::shared_ptr<GgufDecoder>` -- a decoder supplied by a direct linker,
+    ///        wrapping an already-built ggml graph (the llama.cpp cgraph path) -- optionally
+    ///        followed by an `ov::AnyMap` of load options (see `native_k_quants`). File-path
+    ///        (`.gguf`) loading, built per-architecture by the native builder, is not yet
+    ///        implemented in this frontend.
     /// \return InputModel::Ptr
     InputModel::Ptr load_impl(const std::vector<ov::Any>& variants) const override;
 
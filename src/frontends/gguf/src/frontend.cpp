@@ -108,7 +108,16 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
                             "GGUF Frontend supports loading from a GgufDecoder only.");
     auto decoder = variants[0].as<std::shared_ptr<GgufDecoder>>();
     FRONT_END_GENERAL_CHECK(decoder, "Couldn't cast ov::Any to std::shared_ptr<GgufDecoder>");
-    return std::make_shared<InputModel>(decoder);
+
+    bool keep_native_k_quants = false;
+    if (variants.size() > 1) {
+        FRONT_END_GENERAL_CHECK(variants[1].is<ov::AnyMap>(), "GGUF Frontend expects the load options as ov::AnyMap.");
+        const auto& options = variants[1].as<ov::AnyMap>();
+        if (auto it = options.find(native_k_quants); it != options.end()) {
+            keep_native_k_quants = it->second.as<bool>();
+        }
+    }
+    return std::make_shared<InputModel>(decoder, keep_native_k_quants);
 }
 
 }  // namespace gguf
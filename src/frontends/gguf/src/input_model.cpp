@@ -10,7 +10,9 @@ namespace ov {
 namespace frontend {
 namespace gguf {
 
-InputModel::InputModel(const std::shared_ptr<GgufDecoder>& gdecoder) : m_decoder(gdecoder) {}
+InputModel::InputModel(const std::shared_ptr<GgufDecoder>& gdecoder, bool native_k_quants)
+    : m_decoder(gdecoder),
+      m_native_k_quants(native_k_quants) {}
 
 const std::map<std::string, std::shared_ptr<ov::Node>>& InputModel::get_model_inputs() const {
     return m_decoder->get_model_inputs();
@@ -38,6 +40,10 @@ const std::shared_ptr<GgufDecoder>& InputModel::get_model_decoder() const {
     return m_decoder;
 }
 
+bool InputModel::native_k_quants() const {
+    return m_native_k_quants;
+}
+
 }  // namespace gguf
 }  // namespace frontend
 }  // namespace ov
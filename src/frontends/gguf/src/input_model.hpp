@@ -28,7 +28,7 @@ class GGUF_FRONTEND_API InputModel : public ov::frontend::InputModel {
     friend class ::ov::frontend::gguf::FrontEnd;
 
 public:
-    explicit InputModel(const std::shared_ptr<GgufDecoder>& gdecoder);
+    explicit InputModel(const std::shared_ptr<GgufDecoder>& gdecoder, bool native_k_quants = false);
 
     // Model-scope topology (forwarded to the underlying decoder's model-scope accessors).
     const std::map<std::string, std::shared_ptr<ov::Node>>& get_model_inputs() const;
@@ -41,8 +41,12 @@ public:
     // extra inputs, KV param/result pairs, is_stateful / is_static, tokenizer metadata).
     const std::shared_ptr<GgufDecoder>& get_model_decoder() const;
 
+    // The native_k_quants load option: Q3_K/Q5_K/Q6_K weights stay u3/u6.
+    bool native_k_quants() const;
+
 private:
     std::shared_ptr<GgufDecoder> m_decoder;
+    bool m_native_k_quants = false;
 };
 
 }  // namespace ov::frontend::gguf
@@ -16,10 +16,13 @@ typedef std::map<std::string, Output<Node>> TensorMap;
 
 class NodeContext : public frontend::NodeContext {
 public:
-    NodeContext(const std::shared_ptr<GgufDecoder>& decoder, std::shared_ptr<TensorMap>& tensor_map)
+    NodeContext(const std::shared_ptr<GgufDecoder>& decoder,
+                std::shared_ptr<TensorMap>& tensor_map,
+                bool native_k_quants = false)
         : ov::frontend::NodeContext(decoder->get_op_type()),
           m_decoder(decoder),
-          m_tensor_map(tensor_map) {
+          m_tensor_map(tensor_map),
+          m_native_k_quants(native_k_quants) {
         m_input_names = decoder->get_input_names();
         m_output_names = decoder->get_output_names();
     }
@@ -80,9 +83,15 @@ public:
         return m_decoder->get_attribute(name);
     }
 
+    // The native_k_quants load option of the model, read by translate_weight.
+    bool native_k_quants() const {
+        return m_native_k_quants;
+    }
+
 private:
     std::shared_ptr<GgufDecoder> m_decoder;
     std::shared_ptr<TensorMap>& m_tensor_map;
+    bool m_native_k_quants = false;
     std::vector<std::string> m_input_names;
     std::vector<std::string> m_output_names;
 };
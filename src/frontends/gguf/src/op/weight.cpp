@@ -88,14 +88,15 @@ OutputVector translate_weight(const NodeContext& context) {
     if (shape.size() > 2) {
         const size_t cols = shape.back();
         const size_t rows = std::accumulate(shape.begin(), shape.end() - 1, size_t{1}, std::multiplies<size_t>());
-        auto node = make_weight_node(data, quant_type, ov::Shape{rows, cols}, context.get_name());
+        auto node =
+            make_weight_node(data, quant_type, ov::Shape{rows, cols}, context.get_name(), context.native_k_quants());
         std::vector<int64_t> full(shape.begin(), shape.end());
         auto target = ov::op::v0::Constant::create(ov::element::i64, {full.size()}, full);
         auto reshaped = std::make_shared<ov::op::v1::Reshape>(node, target, false);
         return rename_outputs_with_suffix({reshaped}, context.get_name());
     }
 
-    auto node = make_weight_node(data, quant_type, shape, context.get_name());
+    auto node = make_weight_node(data, quant_type, shape, context.get_name(), context.native_k_quants());
     return rename_outputs_with_suffix({node}, context.get_name());
 }
 
@@ -99,6 +99,11 @@ void gguf_fill_sym(const gguf_tensor& tensor, ov::Tensor& weights, ov::Tensor& s
 // Tensor shapes must match quant_sizes.
 void gguf_fill_asym(const gguf_tensor& tensor, ov::Tensor& weights, ov::Tensor& scales, ov::Tensor& zp);
 
+// Fill pre-allocated u6 (Q5_K/Q6_K) or u3 (Q3_K) weights, f16 scales and zero-points from a
+// K-quant tensor, keeping the native bitness. Q3_K/Q6_K are centered by a scalar zero-point
+// (4/32, u8 or f16), Q5_K takes per-group zero-points like gguf_fill_asym.
+void gguf_fill_split_bit(const gguf_tensor& tensor, ov::Tensor& weights, ov::Tensor& scales, ov::Tensor& zp);
+
 // Fill pre-allocated f4e2m1 weights and f8e8m0 scales from an MXFP4 GGUF tensor.
 void gguf_fill_mxfp4(const gguf_tensor& tensor, ov::Tensor& weights, ov::Tensor& scales);
 
@@ -10,6 +10,7 @@
 #include <numeric>
 #include "openvino/core/parallel.hpp"
 #include <sstream>
+#include <vector>
 
 #include "gguf.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
@@ -703,6 +704,79 @@ void gguf_fill_asym(const gguf_tensor& tensor, ov::Tensor& weights, ov::Tensor&
     }
 }
 
+// Pack unsigned 3/6-bit values into the OpenVINO u3/u6 layout: 8 u3 (4 u6) values in 3 bytes,
+// the low bits in the first two bytes (big endian, the first value in the most significant bits)
+// and the high bits in the third byte.
+static void pack_split_bit(const uint8_t* q, size_t n, bool u6, uint8_t* dst) {
+    const size_t values = u6 ? 4 : 8;
+    for (size_t i = 0; i < n; i += values, dst += 3) {
+        uint16_t low = 0;
+        uint8_t high = 0;
+        for (size_t j = 0; j < values; ++j) {
+            const size_t shift = values - 1 - j;
+            if (u6) {
+                low |= static_cast<uint16_t>((q[i + j] & 0xF) << (4 * shift));
+                high |= static_cast<uint8_t>(((q[i + j] >> 4) & 0x3) << (2 * shift));
+            } else {
+                low |= static_cast<uint16_t>((q[i + j] & 0x3) << (2 * shift));
+                high |= static_cast<uint8_t>(((q[i + j] >> 2) & 0x1) << shift);
+            }
+        }
+        dst[0] = static_cast<uint8_t>(low >> 8);
+        dst[1] = static_cast<uint8_t>(low & 0xFF);
+        dst[2] = high;
+    }
+}
+
+// Split-bit K-quants: Q6_K -> u6 (value + 32, zp 32), Q3_K -> u3 (value + 4, zp 4), both with a
+// scalar zero-point; Q5_K -> u6 (raw [0..31]) with the per-group zero-points of fill_q5_k. The
+// two-level super-block scales are folded into the f16 group scales by the fill_* functions.
+void gguf_fill_split_bit(const gguf_tensor& tensor, ov::Tensor& weights, ov::Tensor& scales, ov::Tensor& zp) {
+    const size_t n = tensor.num_weights;
+    const bool u6 = weights.get_element_type() == ov::element::u6;
+    std::vector<uint8_t> q(n);
+    if (tensor.type == GGUF_TYPE_Q6_K || tensor.type == GGUF_TYPE_Q5_K) {
+        OPENVINO_ASSERT(u6, "[GGUF] Q5_K/Q6_K are packed into u6 weights");
+        ov::Tensor unpacked(ov::element::i8, ov::Shape{n});
+        if (tensor.type == GGUF_TYPE_Q6_K) {
+            fill_q6_k(tensor, unpacked, scales);
+        } else {
+            fill_q5_k(tensor, unpacked, scales, zp);
+        }
+        const auto* src = unpacked.data<int8_t>();
+        const int bias = tensor.type == GGUF_TYPE_Q6_K ? 32 : 0;
+        for (size_t i = 0; i < n; ++i) {
+            q[i] = static_cast<uint8_t>(src[i] + bias);
+        }
+    } else if (tensor.type == GGUF_TYPE_Q3_K) {
+        OPENVINO_ASSERT(!u6, "[GGUF] Q3_K is packed into u3 weights");
+        ov::Tensor unpacked(ov::element::i4, ov::Shape{n});
+        fill_q3_k(tensor, unpacked, scales);
+        const auto* src = static_cast<const uint8_t*>(unpacked.data());
+        for (size_t i = 0; i < n; ++i) {
+            const int nib = (src[i / 2] >> ((i % 2) * 4)) & 0xF;
+            q[i] = static_cast<uint8_t>((nib < 8 ? nib : nib - 16) + 4);
+        }
+    } else {
+        OPENVINO_ASSERT(false, "Unsupported tensor type in 'gguf_fill_split_bit'");
+    }
+    if (tensor.type != GGUF_TYPE_Q5_K) {
+        OPENVINO_ASSERT(zp.get_size() == 1, "[GGUF] Q3_K/Q6_K use a scalar zero-point");
+        const uint8_t center = u6 ? 32 : 4;
+        if (zp.get_element_type() == ov::element::u8) {
+            *static_cast<uint8_t*>(zp.data()) = center;
+        } else {
+            *zp.data<ov::float16>() = ov::float16(static_cast<float>(center));
+        }
+    }
+    // 256-element super-blocks keep every chunk of 8 (4) values inside one row.
+    auto* dst = static_cast<uint8_t*>(weights.data());
+    const size_t chunk = 256;
+    ov::parallel_for(n / chunk, [&](size_t i) {
+        pack_split_bit(q.data() + i * chunk, chunk, u6, dst + i * chunk * (u6 ? 6 : 3) / 8);
+    });
+}
+
 }  // namespace gguf
 }  // namespace frontend
 }  // namespace ov
@@ -3,8 +3,8 @@
 //
 
 // Weight node construction for the native GGUF path. Quantized weights become a
-// low-bitness compressed decompression subgraph (u4 for 4-bit, u8 for 8-bit; OpenVINO
-// supports every GGUF bitness used here except 3-bit). Adapted from the genai gguf_utils
+// low-bitness compressed decompression subgraph (u4 for 4-bit, u8 for 8-bit, u3/u6 for the
+// Q3_K/Q5_K/Q6_K K-quants when native K-quants are requested). Adapted from the genai gguf_utils
 // make_int4/int8_weights helpers, working from the parser's compressed tensors
 // (.weight u32-packed + .scales f16 + .biases f16).
 
@@ -14,6 +14,7 @@
 #include <cctype>
 #include <cmath>
 #include <cstring>
+#include <string>
 #include <vector>
 
 #include "openvino/core/except.hpp"
@@ -276,6 +277,39 @@ std::shared_ptr<ov::Node> make_asym_int8(const std::string& name,
     return std::make_shared<ov::op::v0::Convert>(result, ov::element::f32);
 }
 
+// Split-bit K-quants (Q3_K -> u3, Q5_K/Q6_K -> u6): the native bitness + per-group f16 scale +
+// u8/f16 zero-point, which is a scalar for the centered Q3_K/Q6_K and per group for Q5_K.
+// Emits: Multiply(Subtract(Convert(u3/u6_const, f16), zp), scale) [-> Reshape].
+std::shared_ptr<ov::Node> make_split_bit(const std::string& name,
+                                         const std::unordered_map<std::string, ov::Tensor>& weights) {
+    ov::Tensor weight = get(weights, name + ".weight");  // u3 (8 per 3 bytes) / u6 (4 per 3 bytes)
+    ov::Tensor scales = get(weights, name + ".scales");
+    ov::Tensor zp_t = get(weights, name + ".zp");
+
+    const ov::Shape& orig_shape = weight.get_shape();
+    const size_t num_groups = scales.get_shape().back();
+    const size_t group_size = orig_shape.back() / num_groups;
+
+    auto grouped_shape = grouped_weight_shape(orig_shape, num_groups, group_size);
+    auto scale_shape = per_group_shape(orig_shape, num_groups);
+    scales.set_shape(scale_shape);
+    if (zp_t.get_size() != 1) {
+        zp_t.set_shape(scale_shape);
+    }
+
+    auto weights_node = make_compressed_weight_constant(weight.get_element_type(), grouped_shape, weight);
+    auto scales_node = std::make_shared<ov::op::v0::Constant>(scales);
+    auto zp_node = std::make_shared<ov::op::v0::Constant>(zp_t);
+    auto final_shape_node =
+        std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{orig_shape.size()}, orig_shape);
+
+    auto result = ov::decomposition::low_precision_dequantize(weights_node->output(0),
+                                                              scales_node->output(0),
+                                                              zp_node->output(0),
+                                                              final_shape_node->output(0));
+    return std::make_shared<ov::op::v0::Convert>(result, ov::element::f32);
+}
+
 // MXFP4 (gpt-oss): native compressed weights = f4e2m1 weight * f8e8m0 per-32 scale, both
 // kept compressed so the CPU plugin decompresses on the fly (no host f16 expansion). The
 // parser already deinterleaved into natural order; here we just build the subgraph.
@@ -417,18 +451,23 @@ std::vector<float> dequant_extracted_to_f32(const std::unordered_map<std::string
     return out;
 }
 
+bool is_split_bit_k_quant(gguf_tensor_type qtype) {
+    return qtype == GGUF_TYPE_Q3_K || qtype == GGUF_TYPE_Q5_K || qtype == GGUF_TYPE_Q6_K;
+}
+
 // Decide whether a weight is requantized to Q8_0_C, mirroring llama.cpp's
-// ggml_openvino_get_requant_type for the CPU/GPU (non-NPU) path.
-bool needs_q8_0_c_requant(const std::string& name, gguf_tensor_type qtype) {
+// ggml_openvino_get_requant_type for the CPU/GPU (non-NPU) path. With native K-quants Q5_K/Q6_K
+// stay u6 instead.
+bool needs_q8_0_c_requant(const std::string& name, gguf_tensor_type qtype, bool native_k_quants) {
     if (name.rfind("token_embd.weight", 0) == 0 || name.rfind("output.weight", 0) == 0) {
         return true;
     }
-    return qtype == GGUF_TYPE_Q6_K || qtype == GGUF_TYPE_Q5_K;
+    return (qtype == GGUF_TYPE_Q6_K || qtype == GGUF_TYPE_Q5_K) && !native_k_quants;
 }
 
 }  // namespace
 
-ov::element::Type gguf_zero_point_type(const std::string& name, gguf_tensor_type qtype) {
+ov::element::Type gguf_zero_point_type(const std::string& name, gguf_tensor_type qtype, bool native_k_quants) {
     // The CPU compressed-FullyConnected fast path only folds the dequant when the zero-point is an
     // INTEGER constant; a fractional f16 one leaves a ~2x slower kernel. Q4_K carries the matmul
     // weights of modern models and Q2_0's zp is the exact integer 1, so both use u8. The others
@@ -436,7 +475,8 @@ ov::element::Type gguf_zero_point_type(const std::string& name, gguf_tensor_type
     // error into every weight. Tensors that are requantized to Q8_0_C are excluded -- their dequant
     // feeds the channel-wise path, not a compressed FC.
     const bool integer_zp = (qtype == GGUF_TYPE_Q4_K || qtype == GGUF_TYPE_Q2_0);
-    return (integer_zp && !needs_q8_0_c_requant(name, qtype)) ? ov::element::u8 : ov::element::f16;
+    const bool requant = needs_q8_0_c_requant(name, qtype, native_k_quants);
+    return (integer_zp && !requant) ? ov::element::u8 : ov::element::f16;
 }
 
 std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
@@ -448,6 +488,12 @@ std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
     }
 
     std::shared_ptr<ov::Node> node;
+    const auto weight_type = get(weights, base + ".weight").get_element_type();
+    if (weight_type == ov::element::u3 || weight_type == ov::element::u6) {
+        node = make_split_bit(base, weights);
+        node->set_friendly_name(base + ".weight");
+        return node;
+    }
     switch (qtype) {
     case GGUF_TYPE_MXFP4:
         node = make_mxfp4(base, weights);
@@ -608,7 +654,8 @@ std::array<FusedQkvPart, 2> split_interleaved_q_gate(const std::string& base,
 std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
                                            const std::string& quant_type,
                                            const ov::Shape& logical_shape,
-                                           const std::string& name) {
+                                           const std::string& name,
+                                           bool native_k_quants) {
     OPENVINO_ASSERT(logical_shape.size() == 2,
                     "[GGUF] weight logical shape must be 2D [rows, cols], got rank ",
                     logical_shape.size());
@@ -655,8 +702,8 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
     // The legacy Q4_1/Q5_1/Q2_K types keep a faithful f16 zp:
     // they are not perf-critical here, and their zp = -min/scale can fall outside u8 range. The
     // requant path (token_embd/output) also keeps f16 -- its dequant feeds channel-wise Q8_0_C.
-    const bool requant = needs_q8_0_c_requant(name, qtype);
-    const ov::element::Type zp_type = gguf_zero_point_type(name, qtype);
+    const bool requant = needs_q8_0_c_requant(name, qtype, native_k_quants);
+    const ov::element::Type zp_type = gguf_zero_point_type(name, qtype, native_k_quants);
 
     // K-quant requant sources: the fused dequant -> Q8_0_C streams from the raw bytes, so skip the
     // full-tensor gguf_fill_* extraction below (it would be discarded) and return before the switch.
@@ -669,6 +716,22 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         return build_q8_0_c_node(rq_weights, rq_scales, rows, cols);
     }
 
+    // Native-bitness K-quants, on request only: u6 for Q5_K/Q6_K, u3 for Q3_K. Only the CPU plugin
+    // decompresses u3/u6 inside FullyConnected, the other devices constant-fold them to f16.
+    if (!requant && native_k_quants && is_split_bit_k_quant(qtype)) {
+        const bool u3 = qtype == GGUF_TYPE_Q3_K;
+        const size_t group = qtype == GGUF_TYPE_Q5_K ? 32 : 16;
+        const ov::Shape zp_shape = qtype == GGUF_TYPE_Q5_K ? ov::Shape{rows, sub_blocks_per_row(group)} : ov::Shape{};
+        ov::Tensor weights(u3 ? ov::element::u3 : ov::element::u6, ov::Shape{rows, cols});
+        ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(group)});
+        ov::Tensor zp(qtype == GGUF_TYPE_Q5_K ? zp_type : ov::element::u8, zp_shape);
+        gguf_fill_split_bit(tensor, weights, scales, zp);
+        w[base + ".weight"] = weights;
+        w[base + ".scales"] = scales;
+        w[base + ".zp"] = zp;
+        return make_weight_node(base, w, q);
+    }
+
     switch (qtype) {
     case GGUF_TYPE_Q4_0: {
         ov::Tensor weights(ov::element::u32, ov::Shape{rows, cols / 8});
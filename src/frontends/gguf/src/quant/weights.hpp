@@ -19,7 +19,9 @@ namespace ov::frontend::gguf {
 
 // Element type of the zero-point constant for an asymmetric quantized weight. Both ingest
 // paths must agree on this: it decides whether the CPU folds the dequant into the MatMul.
-ov::element::Type gguf_zero_point_type(const std::string& name, gguf_tensor_type qtype);
+ov::element::Type gguf_zero_point_type(const std::string& name,
+                                       gguf_tensor_type qtype,
+                                       bool native_k_quants = false);
 
 // Build the OpenVINO node for a GGUF weight with base name `base` (the tensor name without
 // the trailing ".weight", e.g. "blk.0.attn_q" or "token_embd"). Quantized weights become a
@@ -45,10 +47,14 @@ std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
 // `name` is the gguf tensor name (e.g. "token_embd.weight", "blk.0.ffn_down.weight"). It is
 // used to decide channel-wise requantization to Q8_0_C for the embedding / output / Q6_K /
 // Q5_K tensors, matching the llama.cpp ggml-openvino backend's CPU/GPU weight pipeline.
+//
+// `native_k_quants` (the native_k_quants load option) keeps Q3_K/Q5_K/Q6_K in their native
+// bitness as u3/u6 compressed weights instead, which only the CPU plugin runs without expanding.
 std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
                                            const std::string& quant_type,
                                            const ov::Shape& logical_shape,
-                                           const std::string& name = "");
+                                           const std::string& name = "",
+                                           bool native_k_quants = false);
 
 // Map a ggml quant type name (e.g. "Q4_K") to its gguf_tensor_type id. Throws if unknown.
 gguf_tensor_type gguf_type_from_name(const std::string& quant_type);
@@ -185,7 +185,7 @@ std::shared_ptr<Model> TranslateSession::translate_graph(const frontend::InputMo
                                       "Translation for operation type ",
                                       operation_type,
                                       " is not implemented.");
-        NodeContext node_context(decoder, tensor_map);
+        NodeContext node_context(decoder, tensor_map, gguf_model->native_k_quants());
         converted_outputs = it->second(node_context);
 
         const auto& node_output_names = decoder->get_output_names();
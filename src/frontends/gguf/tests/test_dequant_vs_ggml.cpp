@@ -83,10 +83,14 @@ const char* type_name(uint32_t type) {
 // Build the frontend dequant of `rows x cols` weights from raw ggml block bytes `qbytes`
 // via the public make_weight_node(data, quant_type, shape) entry point, then constant-fold
 // it to f32 values (row-major, rows*cols).
-std::vector<float> frontend_dequant(uint32_t type, const std::vector<uint8_t>& qbytes, uint64_t rows, uint64_t cols) {
+std::vector<float> frontend_dequant(uint32_t type,
+                                    const std::vector<uint8_t>& qbytes,
+                                    uint64_t rows,
+                                    uint64_t cols,
+                                    bool native_k_quants) {
     ov::Tensor data(ov::element::u8, ov::Shape{qbytes.size()});
     std::memcpy(data.data(), qbytes.data(), qbytes.size());
-    auto node = make_weight_node(data, type_name(type), ov::Shape{rows, cols});
+    auto node = make_weight_node(data, type_name(type), ov::Shape{rows, cols}, "", native_k_quants);
     return eval_as_f32(node);
 }
 
@@ -99,13 +103,16 @@ float max_abs_diff(const std::vector<float>& a, const std::vector<float>& b) {
 }
 
 // One case: stem (test_data file prefix) + ggml quant enum + tolerance. rows/cols match the
-// generator. Q5_K/Q6_K go through the channel-wise Q8_0_C requantization (matching the
-// llama.cpp ggml-openvino CPU/GPU backend), so they diverge from ggml's faithful to_float by
-// the Q8_0_C round-off (~1e-2) rather than by f16 noise (~3e-3).
+// generator. By default Q5_K/Q6_K go through the channel-wise Q8_0_C requantization (matching the
+// llama.cpp ggml-openvino CPU/GPU backend), so they diverge from ggml's faithful to_float by the
+// Q8_0_C round-off (~1e-2) rather than by f16 noise (~3e-3). With native K-quants Q3_K/Q5_K/Q6_K
+// keep their bitness (u3/u6 compressed weights) and only carry the f16 noise of the folded
+// super-block scales.
 struct DeqCase {
     const char* stem;
     uint32_t type;
     float tol;
+    bool native_k_quants = false;
 };
 
 constexpr uint64_t kRows = 4;
@@ -129,7 +136,7 @@ TEST_P(DequantVsGGML, MatchesGgmlToFloat) {
     const auto ref = load_npy<float>(std::string(c.stem) + "_deq");
     ASSERT_EQ(ref.size(), kRows * kCols);
 
-    const auto ours = frontend_dequant(c.type, qbytes, kRows, kCols);
+    const auto ours = frontend_dequant(c.type, qbytes, kRows, kCols, c.native_k_quants);
     ASSERT_EQ(ours.size(), ref.size());
 
     EXPECT_LE(max_abs_diff(ours, ref), c.tol)
@@ -191,3 +198,12 @@ INSTANTIATE_TEST_SUITE_P(AllQuantTypes,
                          [](const ::testing::TestParamInfo<DeqCase>& i) {
                              return std::string(i.param.stem);
                          });
+
+INSTANTIATE_TEST_SUITE_P(NativeKQuants,
+                         DequantVsGGML,
+                         ::testing::Values(DeqCase{"q3_k", GGUF_TYPE_Q3_K, kTolFaithful, true},
+                                           DeqCase{"q5_k", GGUF_TYPE_Q5_K, kTolFaithful, true},
+                                           DeqCase{"q6_k", GGUF_TYPE_Q6_K, kTolFaithful, true}),
+                         [](const ::testing::TestParamInfo<DeqCase>& i) {
+                             return std::string(i.param.stem);
+                         });
@@ -234,10 +234,9 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
                 aligned_weights_buffer->get_ptr<char>(),
                 aligned_weights_buffer->size(),
                 aligned_weights_buffer,
-                ov::create_base_descriptor(
-                    std::hash<std::decay_t<decltype(weights_path.native())>>{}(weights_path.native()),
-                    0,
-                    aligned_weights_buffer));
+                ov::create_base_descriptor(ov::util::get_id_for_file(weights_path, 0, file_size),
+                                           0,
+                                           aligned_weights_buffer));
 
         } else {
             OPENVINO_THROW("Weights file ", weights_path, " cannot be opened!");
@@ -9,17 +9,23 @@
 
 #pragma once
 
+#include <chrono>
 #include <future>
 #include <memory>
+#include <string>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/exception.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 
 namespace ov {
+namespace threading {
+class IStreamsExecutor;
+}  // namespace threading
 
 /**
  * @brief Base class with default implementation of asynchronous multi staged inference request.
@@ -71,6 +77,19 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets properties of the inference request, e.g. ov::hint::request_priority and ov::hint::request_deadline
+     * @param properties Map of pairs: (property name, property value)
+     */
+    virtual void set_property(const ov::AnyMap& properties);
+
+    /**
+     * @brief Gets a property of the inference request, e.g. ov::request_queue_wait
+     * @param name Property name
+     * @return Property value
+     */
+    virtual ov::Any get_property(const std::string& name) const;
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -272,12 +291,18 @@ private:
     std::shared_ptr<IInferRequest> m_sync_request;
 
     std::shared_ptr<ov::threading::ITaskExecutor> m_request_executor;  //!< Used to run inference CPU tasks.
+    std::shared_ptr<ov::threading::IStreamsExecutor>
+        m_request_streams_executor;  //!< m_request_executor if it is a streams executor, used for NUMA affinity
     std::shared_ptr<ov::threading::ITaskExecutor>
         m_callback_executor;  //!< Used to run post inference callback in asynchronous pipline
     std::shared_ptr<ov::threading::ITaskExecutor>
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::shared_ptr<std::function<void(std::exception_ptr)>> m_callback;
+    ov::hint::Priority m_priority = ov::hint::Priority::DEFAULT;
+    std::chrono::microseconds m_deadline{0};
+    ov::threading::TaskPriority m_task_priority;  //!< Scheduling attributes of the pipeline stages of the current run
+    std::chrono::steady_clock::duration m_queue_wait{0};  //!< Time the current run spent in the executor queues
 };
 
 }  // namespace ov
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <shared_mutex>
+
 #include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/runtime/icache_manager.hpp"
 #include "openvino/runtime/tlv_format.hpp"
@@ -27,6 +30,9 @@ public:
 
     /**
      * @brief Write a cache entry to the storage.
+     * @note The writer streams the blob directly to the file. The entry is added to the index once it is written and
+     * flushed, so the concurrent reads never see a partial entry. Concurrent writes are serialized.
+     * @note The write is synchronous, i.e. the compiled model is exported on the thread which compiles it.
      * @param blob_id The identifier of the blob.
      * @param writer The function to write the blob data.
      */
@@ -34,6 +40,7 @@ public:
 
     /**
      * @brief Read a cache entry from the storage.
+     * @note Safe to call concurrently. With memory mapping, all reads share the single mapping of the file.
      * @param blob_id The identifier of the blob.
      * @param enable_mmap Whether to use memory mapping for reading the blob data.
      * @param reader The function to read the blob data.
@@ -77,10 +84,20 @@ private:
     };
     std::unordered_map<BlobIdType, BlobInfo> m_blob_index;
     std::shared_ptr<wsh::Context> m_shared_context;
+    // Serializes the writers appending to the file
+    std::mutex m_write_mutex;
+    // Guards the index and the file end
+    mutable std::shared_mutex m_mutex;
+    // The end of the records committed to the index
+    uint64_t m_file_end;
+    // The mapping of the whole file shared by the readers, remapped when the file grows
+    std::mutex m_mapping_mutex;
+    ov::Tensor m_mapped_file;
+
     bool build_content_index(std::ifstream& stream);
 
     static BlobIdType convert_blob_id(const std::string& blob_id);
-    void write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer);
     bool has_blob_id(BlobIdType blob_id) const;
+    ov::Tensor map_blob(uint64_t offset, uint64_t size);
 };
 }  // namespace ov::runtime
@@ -23,7 +23,7 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue ordered by the task priority and deadline.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -45,6 +45,8 @@ public:
 
     void run(Task task) override;
 
+    void run_with_priority(Task task, const TaskPriority& priority) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
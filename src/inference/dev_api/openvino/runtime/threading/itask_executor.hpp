@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -25,6 +26,19 @@ namespace threading {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling attributes of a task. Executors with a task queue take the tasks with higher priority first and
+ *        the tasks with equal priority in the earliest-deadline-first order. NUMA-aware executors prefer the streams
+ *        of the given NUMA node.
+ * @ingroup ov_dev_api_threading
+ */
+struct TaskPriority {
+    int level = 0;  //!< Priority level, a higher value is scheduled first. 0 is the level of the tasks run without
+                    //!< priority and of the inference requests with the default ov::hint::Priority
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();  //!< Deadline
+    int numa_node = -1;  //!< NUMA node which is preferred to run the task, -1 means no preference
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ov_dev_api_threading
@@ -62,6 +76,14 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute ov::Task inside task executor context taking into account its priority and deadline.
+     *        Default implementation ignores the scheduling attributes and calls run().
+     * @param task A task to start
+     * @param priority Scheduling attributes of the task
+     */
+    virtual void run_with_priority(Task task, const TaskPriority& priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default run_and_wait() method implementation uses run() pure virtual method
@@ -23,6 +23,13 @@ static constexpr Property<bool> device_bind_buffer{"DEVICE_BIND_BUFFER"};
  */
 static constexpr Property<bool> enable_startup_fallback{"ENABLE_STARTUP_FALLBACK"};
 
+/**
+ * @brief auto device setting that enables the CPU compiled with LATENCY hint as the helper device, if the selected
+ * device is CPU with THROUGHPUT hint, until the model is compiled with THROUGHPUT hint. The model is compiled twice,
+ * so it is disabled by default. Takes effect with ov::intel_auto::enable_startup_fallback only.
+ */
+static constexpr Property<bool> enable_cpu_hot_swap{"ENABLE_CPU_HOT_SWAP"};
+
 /**
  * @brief auto device setting that enable/disable runtime fallback to other devices when infer fails on current
  * selected device
@@ -35,9 +42,10 @@ static constexpr Property<bool> enable_runtime_fallback{"ENABLE_RUNTIME_FALLBACK
  * @ingroup ov_runtime_cpp_prop_api
  */
 enum class SchedulePolicy {
-    ROUND_ROBIN = 0,            // will schedule the infer request using round robin policy
-    DEVICE_PRIORITY = 1,        // will schedule the infer request based on the device priority
-    DEFAULT = DEVICE_PRIORITY,  //!<  Default schedule policy is DEVICE_PRIORITY
+    ROUND_ROBIN = 0,              // will schedule the infer request using round robin policy
+    DEVICE_PRIORITY = 1,          // will schedule the infer request based on the device priority
+    SHORTEST_EXPECTED_DELAY = 2,  // will schedule the infer request to the device expected to complete it first
+    DEFAULT = DEVICE_PRIORITY,    //!<  Default schedule policy is DEVICE_PRIORITY
 };
 
 /** @cond INTERNAL */
@@ -47,6 +55,8 @@ inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy)
         return os << "ROUND_ROBIN";
     case SchedulePolicy::DEVICE_PRIORITY:
         return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::SHORTEST_EXPECTED_DELAY:
+        return os << "SHORTEST_EXPECTED_DELAY";
     default:
         OPENVINO_THROW("Unsupported schedule policy value");
     }
@@ -59,6 +69,8 @@ inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
         policy = SchedulePolicy::ROUND_ROBIN;
     } else if (str == "DEVICE_PRIORITY") {
         policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "SHORTEST_EXPECTED_DELAY") {
+        policy = SchedulePolicy::SHORTEST_EXPECTED_DELAY;
     } else if (str == "DEFAULT") {
         policy = SchedulePolicy::DEFAULT;
     } else {
@@ -75,6 +87,15 @@ inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
  */
 static constexpr Property<SchedulePolicy> schedule_policy{"SCHEDULE_POLICY"};
 
+/**
+ * @brief Read-only property reporting the load of each device in AUTO CUMULATIVE_THROUGHPUT or MULTI case, a map of the
+ * device name to the map of: "DISPATCHED" (number of the dispatched infer requests), "IN_FLIGHT" (number of the infer
+ * requests being executed), "SERVICE_TIME_MS" (moving average of the infer request execution time) and
+ * "LATENCY_HISTOGRAM" (number of the infer requests executed in [0, 1), [1, 2), [2, 4) ... [1024, inf) ms)
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> devices_load_statistics{"DEVICES_LOAD_STATISTICS"};
+
 /**
  * @brief Device utilization thresholds (in percent) used by AUTO for device selection.
  * @ingroup ov_runtime_cpp_prop_api
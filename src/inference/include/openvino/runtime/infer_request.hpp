@@ -16,6 +16,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -307,6 +308,46 @@ public:
      */
     void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets properties for the current inference request.
+     *
+     * The supported properties are ov::hint::request_priority and ov::hint::request_deadline. They are applied starting
+     * from the next inference.
+     * @param properties Map of pairs: (property name, property value).
+     */
+    void set_property(const AnyMap& properties);
+
+    /**
+     * @brief Sets properties for the current inference request.
+     *
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types.
+     * @param properties Optional pack of pairs: (property name, property value).
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<void, Properties...> set_property(Properties&&... properties) {
+        set_property(AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    /**
+     * @brief Gets a property of the current inference request, for example ov::request_queue_wait.
+     *
+     * @param name Property key, can be found in openvino/runtime/properties.hpp.
+     * @return Property value.
+     */
+    Any get_property(const std::string& name) const;
+
+    /**
+     * @brief Gets a property of the current inference request.
+     *
+     * @tparam T Type of a returned value.
+     * @param property  Property  object.
+     * @return Value of property.
+     */
+    template <typename T, PropertyMutability mutability>
+    T get_property(const ov::Property<T, mutability>& property) const {
+        return get_property(property.name()).template as<T>();
+    }
+
     /**
      * @brief Gets state control interface for the given infer request.
      *
@@ -329,6 +329,21 @@ inline std::istream& operator>>(std::istream& is, Priority& priority) {
  */
 static constexpr Property<Priority> model_priority{"MODEL_PRIORITY"};
 
+/**
+ * @brief Priority of an inference request
+ * Requests with higher priority are taken from the queue of the device executor first, requests with equal priority
+ * are ordered by their deadline (see ov::hint::request_deadline) and then in the order of submission
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<Priority> request_priority{"REQUEST_PRIORITY"};
+
+/**
+ * @brief Deadline of an inference request in microseconds counted from the start of the inference
+ * Among the requests with equal priority the one with the earliest deadline is executed first. Zero means no deadline.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t> request_deadline{"REQUEST_DEADLINE"};
+
 /**
  * @brief Enum to define possible performance mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -778,6 +793,13 @@ inline constexpr Property<std::filesystem::path> cache_path{"CACHE_PATH"};
  */
 static constexpr Property<bool, PropertyMutability::RO> loaded_from_cache{"LOADED_FROM_CACHE"};
 
+/**
+ * @brief Read-only property to get the time in microseconds the last inference of a request spent waiting in the
+ * executor queues
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> request_queue_wait{"REQUEST_QUEUE_WAIT"};
+
 /**
  * @brief Write property to specify the origin path of compiled model to speed cache model ID calculation.
  * @ingroup ov_runtime_cpp_prop_api
@@ -960,6 +982,15 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to execute the partially collected batches with the smaller power-of-two batches
+ * (instead of the batch1) when the auto-batching timeout expires.
+ * The model is compiled for every such batch, so the compilation time and the memory footprint grow. Disabled by
+ * default.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_partial_batches{"AUTO_BATCH_PARTIAL_BATCHES"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
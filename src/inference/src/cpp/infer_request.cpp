@@ -228,6 +228,14 @@ void InferRequest::cancel() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->cancel());
 }
 
+void InferRequest::set_property(const AnyMap& properties) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->set_property(properties));
+}
+
+Any InferRequest::get_property(const std::string& name) const {
+    OV_INFER_REQ_CALL_STATEMENT(return _impl->get_property(name));
+}
+
 std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
     OV_INFER_REQ_CALL_STATEMENT(return _impl->get_profiling_info());
 }
@@ -76,9 +76,10 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function, skipping weights if model path is provided
+    // 1. Calculate hash on function, skipping weights if model path is provided. Otherwise the weights read from a file
+    // are identified by the file and the offset in it, only the weights created in memory are hashed by values
     ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed, !model_path.empty());
+    m.register_pass<ov::pass::Hash>(seed, !model_path.empty(), true);
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
 
     // 2. Compute hash on serialized data and options
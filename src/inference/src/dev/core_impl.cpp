@@ -217,8 +217,9 @@ static const auto core_properties_names = ov::util::make_array(ov::cache_dir.nam
                                                                ov::enable_mmap.name(),
                                                                ov::force_tbb_terminate.name());
 
-static const auto auto_batch_properties_names =
-    ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
+static const auto auto_batch_properties_names = ov::util::make_array(ov::auto_batch_timeout.name(),
+                                                                     ov::auto_batch_partial_batches.name(),
+                                                                     ov::hint::allow_auto_batching.name());
 
 std::filesystem::path extract_weight_path(const std::string& compiled_properties) {
     if (auto start = compiled_properties.find(ov::weights_path.name()); start != std::string::npos) {
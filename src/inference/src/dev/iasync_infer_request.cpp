@@ -5,6 +5,7 @@
 #include "openvino/runtime/iasync_infer_request.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "openvino/runtime/isync_infer_request.hpp"
@@ -55,9 +56,9 @@ ov::IAsyncInferRequest::IAsyncInferRequest(const std::shared_ptr<IInferRequest>&
         m_sync_pipeline = {{std::make_shared<ov::threading::ImmediateExecutor>(), [this] {
                                 m_sync_request->infer();
                             }}};
-    auto streams_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_request_executor);
-    if (streams_executor != nullptr) {
-        m_sync_pipeline = {{std::make_shared<ImmediateStreamsExecutor>(std::move(streams_executor)), [this] {
+    m_request_streams_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_request_executor);
+    if (m_request_streams_executor != nullptr) {
+        m_sync_pipeline = {{std::make_shared<ImmediateStreamsExecutor>(m_request_streams_executor), [this] {
                                 m_sync_request->infer();
                             }}};
     }
@@ -110,6 +111,37 @@ void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)
     m_callback = std::make_shared<std::function<void(std::exception_ptr)>>(std::move(callback));
 }
 
+void ov::IAsyncInferRequest::set_property(const ov::AnyMap& properties) {
+    check_state();
+    for (const auto& property : properties) {
+        if (property.first == ov::hint::request_priority.name()) {
+            m_priority = property.second.as<ov::hint::Priority>();
+        } else if (property.first == ov::hint::request_deadline.name()) {
+            m_deadline = std::chrono::microseconds(property.second.as<uint64_t>());
+        } else {
+            OPENVINO_THROW("Unsupported property ", property.first, " by the inference request");
+        }
+    }
+}
+
+ov::Any ov::IAsyncInferRequest::get_property(const std::string& name) const {
+    check_state();
+    if (name == ov::supported_properties.name()) {
+        return std::vector<ov::PropertyName>{
+            ov::PropertyName{ov::supported_properties.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::hint::request_priority.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::hint::request_deadline.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::request_queue_wait.name(), ov::PropertyMutability::RO}};
+    } else if (name == ov::hint::request_priority.name()) {
+        return m_priority;
+    } else if (name == ov::hint::request_deadline.name()) {
+        return static_cast<uint64_t>(m_deadline.count());
+    } else if (name == ov::request_queue_wait.name()) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(m_queue_wait).count());
+    }
+    OPENVINO_THROW("Unsupported property ", name, " by the inference request");
+}
+
 std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state() const {
     check_state();
     return m_sync_request->query_state();
@@ -127,17 +159,25 @@ void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginSta
                                              const Pipeline::iterator itEndStage,
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
     m_infer_id = g_inference_uid++;
+    // the requests with the default priority are queued along with the plain tasks, in the submission order
+    m_task_priority.level = static_cast<int>(m_priority) - static_cast<int>(ov::hint::Priority::DEFAULT);
+    m_task_priority.deadline = m_deadline.count() == 0 ? std::chrono::steady_clock::time_point::max()
+                                                       : std::chrono::steady_clock::now() + m_deadline;
+    m_queue_wait = std::chrono::steady_clock::duration{0};
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
+    firstStageExecutor->run_with_priority(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)),
+                                          m_task_priority);
 }
 
 ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
     const Pipeline::iterator itStage,
     const Pipeline::iterator itEndStage,
     const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
+    const auto enqueued = std::chrono::steady_clock::now();
     return std::bind(
-        [this, itStage, itEndStage](std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor) mutable {
+        [this, itStage, itEndStage, enqueued](std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor) mutable {
+            m_queue_wait += std::chrono::steady_clock::now() - enqueued;
             // Propagate the inference ID through all subsequent stages for this instance of the pipeline
             OV_ITT_SCOPED_REGION_BASE(ov::itt::domains::Inference, "Inference::pipeline", "InferenceID", m_infer_id);
             std::exception_ptr currentException = nullptr;
@@ -147,11 +187,17 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
                 auto& stageTask = std::get<Stage_e::TASK>(thisStage);
                 OPENVINO_ASSERT(nullptr != stageTask);
                 stageTask();
+                if (m_request_streams_executor && std::get<Stage_e::EXECUTOR>(thisStage) == m_request_executor) {
+                    // the next inferences prefer the NUMA node whose caches and memory hold the request data
+                    m_task_priority.numa_node = m_request_streams_executor->get_numa_node_id();
+                }
                 if (itEndStage != itNextStage) {
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(nextStage);
                     OPENVINO_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->run_with_priority(
+                        make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)),
+                        m_task_priority);
                 }
             } catch (...) {
                 currentException = std::current_exception();
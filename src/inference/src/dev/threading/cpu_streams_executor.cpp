@@ -6,14 +6,19 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <thread>
 #include <vector>
 
+#include "dev/threading/mpmc_queue.hpp"
 #include "dev/threading/parallel_custom_arena.hpp"
 #include "dev/threading/thread_affinity.hpp"
 #include "openvino/itt.hpp"
@@ -25,7 +30,33 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// the executor and the node queue of the current worker thread
+thread_local const void* t_worker_executor = nullptr;
+thread_local int t_worker_queue = 0;
+constexpr size_t node_queue_capacity = 1024;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    struct QueuedTask {
+        Task task;
+        TaskPriority priority;
+        uint64_t sequence;
+
+        // the top of the heap is the task with the highest level, then with the earliest deadline, then the oldest one
+        struct Less {
+            bool operator()(const QueuedTask& l, const QueuedTask& r) const {
+                if (l.priority.level != r.priority.level) {
+                    return l.priority.level < r.priority.level;
+                }
+                if (l.priority.deadline != r.priority.deadline) {
+                    return l.priority.deadline > r.priority.deadline;
+                }
+                return l.sequence > r.sequence;
+            }
+        };
+    };
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         struct Observer : public custom::task_scheduler_observer {
@@ -391,6 +422,7 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        init_node_queues();
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -398,32 +430,117 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                const auto home = node_queue(_streams->local()->_numaNodeId);
+                t_worker_executor = this;
+                t_worker_queue = home < 0 ? 0 : home;
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (Pop(t_worker_queue, task)) {
+                        _pendingTasks.fetch_sub(1);
                         Execute(task, *(_streams->local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _sleepingThreads.fetch_add(1);
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks.load() > 0 || _isStopped;
+                    });
+                    _sleepingThreads.fetch_sub(1);
+                    if (_isStopped && _pendingTasks.load() <= 0) {
+                        break;
                     }
                 }
+                t_worker_executor = nullptr;
             });
         }
     }
 
-    void Enqueue(Task task) {
-        {
+    // one lock-free queue per used NUMA node, the stealing order of each one starts from the nodes of the same socket
+    void init_node_queues() {
+        const auto queues_num = std::max<size_t>(_usedNumaNodes.size(), 1);
+        std::map<int, int> node_sockets;
+        for (const auto& row : get_proc_type_table()) {
+            if (row[PROC_NUMA_NODE_ID] >= 0) {
+                node_sockets[row[PROC_NUMA_NODE_ID]] = row[PROC_SOCKET_ID];
+            }
+        }
+        auto socket_of = [&](size_t queue) {
+            if (queue >= _usedNumaNodes.size()) {
+                return -1;
+            }
+            auto found = node_sockets.find(_usedNumaNodes[queue]);
+            return found == node_sockets.end() ? -1 : found->second;
+        };
+        for (size_t queue = 0; queue < queues_num; ++queue) {
+            _nodeQueues.emplace_back(new MPMCQueue<Task>(node_queue_capacity));
+            std::vector<int> victims(queues_num);
+            std::iota(victims.begin(), victims.end(), 0);
+            std::stable_sort(victims.begin(), victims.end(), [&](int l, int r) {
+                auto rank = [&](int victim) {
+                    return victim == static_cast<int>(queue) ? 0 : (socket_of(victim) == socket_of(queue) ? 1 : 2);
+                };
+                return rank(l) < rank(r);
+            });
+            _victims.push_back(std::move(victims));
+        }
+    }
+
+    int node_queue(int numa_node_id) const {
+        auto found = std::find(_usedNumaNodes.begin(), _usedNumaNodes.end(), numa_node_id);
+        return found == _usedNumaNodes.end() ? -1 : static_cast<int>(std::distance(_usedNumaNodes.begin(), found));
+    }
+
+    // the tasks with the default priority and without a deadline go to the lock-free queues, others to the heap
+    void Enqueue(Task task, const TaskPriority& priority = {}) {
+        bool queued = false;
+        if (priority.level == 0 && priority.deadline == std::chrono::steady_clock::time_point::max()) {
+            auto queue = node_queue(priority.numa_node);
+            if (queue < 0) {
+                queue = t_worker_executor == this
+                            ? t_worker_queue
+                            : static_cast<int>(_nextQueue.fetch_add(1, std::memory_order_relaxed) % _nodeQueues.size());
+            }
+            queued = _nodeQueues[queue]->try_push(task);
+        }
+        if (!queued) {
+            // the heap also takes the overflow of the lock-free queues
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            (priority.level < 0 ? _lowTasks : _urgentTasks).fetch_add(1);
+            _taskQueue.push_back({std::move(task), priority, _taskSequence++});
+            std::push_heap(_taskQueue.begin(), _taskQueue.end(), QueuedTask::Less{});
+        }
+        // a sleeping thread either sees the pending task before waiting or is notified
+        _pendingTasks.fetch_add(1);
+        if (_sleepingThreads.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queueCondVar.notify_one();
+        }
+    }
+
+    // the order is: the heap tasks with the default or higher priority, the own NUMA node queue, the queues of other
+    // nodes starting from the same socket, the heap tasks with lower priority
+    bool Pop(int home, Task& task) {
+        if (_urgentTasks.load(std::memory_order_relaxed) > 0 && PopHeap(task, true)) {
+            return true;
+        }
+        for (const auto victim : _victims[home]) {
+            if (_nodeQueues[victim]->try_pop(task)) {
+                return true;
+            }
         }
-        _queueCondVar.notify_one();
+        return _lowTasks.load(std::memory_order_relaxed) > 0 && PopHeap(task, false);
+    }
+
+    bool PopHeap(Task& task, bool urgent_only) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_taskQueue.empty() || (urgent_only && _taskQueue.front().priority.level < 0)) {
+            return false;
+        }
+        std::pop_heap(_taskQueue.begin(), _taskQueue.end(), QueuedTask::Less{});
+        (_taskQueue.back().priority.level < 0 ? _lowTasks : _urgentTasks).fetch_sub(1);
+        task = std::move(_taskQueue.back().task);
+        _taskQueue.pop_back();
+        return true;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -493,7 +610,15 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::vector<QueuedTask> _taskQueue;  // max-heap by QueuedTask::Less
+    uint64_t _taskSequence = 0;
+    std::atomic<size_t> _urgentTasks{0};  // the tasks in _taskQueue with non-negative priority level
+    std::atomic<size_t> _lowTasks{0};     // the tasks in _taskQueue with negative priority level
+    std::vector<std::unique_ptr<MPMCQueue<Task>>> _nodeQueues;
+    std::vector<std::vector<int>> _victims;  // the stealing order for each queue of _nodeQueues
+    std::atomic<size_t> _nextQueue{0};
+    std::atomic<int64_t> _pendingTasks{0};  // may be ahead of the queues while a task is being pushed or popped
+    std::atomic<size_t> _sleepingThreads{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
@@ -575,5 +700,13 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_with_priority(Task task, const TaskPriority& priority) {
+    if (0 == _impl->_config.get_streams()) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
+    }
+}
+
 }  // namespace threading
 }  // namespace ov
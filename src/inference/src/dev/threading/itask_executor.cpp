@@ -12,6 +12,10 @@
 namespace ov {
 namespace threading {
 
+void ITaskExecutor::run_with_priority(Task task, const TaskPriority&) {
+    run(std::move(task));
+}
+
 void ITaskExecutor::run_and_wait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
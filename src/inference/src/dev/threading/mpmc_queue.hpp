@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ov {
+namespace threading {
+
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue.
+ *        Each cell has a sequence number telling whether it is ready to be written or read in the current lap of the
+ *        ring, so producers and consumers only contend on their own position counter and never take a lock.
+ * @ingroup ov_dev_api_threading
+ * @tparam T Movable and default constructible element type
+ */
+template <typename T>
+class MPMCQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity Maximum number of elements, rounded up to a power of two
+     */
+    explicit MPMCQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /**
+     * @brief Pushes the element if the queue is not full
+     * @return false if the queue is full, the element is not moved in this case
+     */
+    bool try_push(T& value) {
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pops the oldest element if the queue is not empty
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& value) {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.value = T{};
+                    cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether the queue looks empty, the result may be outdated already when returned
+     */
+    bool empty() const {
+        return m_head.load(std::memory_order_relaxed) >= m_tail.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t cache_line = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    alignas(cache_line) std::atomic<size_t> m_tail{0};
+    alignas(cache_line) std::atomic<size_t> m_head{0};
+};
+
+}  // namespace threading
+}  // namespace ov
@@ -54,18 +54,24 @@ bool read_tlv_string(std::istream& stream, std::string& str) {
     }
 }
 
-void write_padding(std::ostream& stream, uint64_t alignment) {
-    const uint64_t padding_pos = static_cast<uint64_t>(stream.tellp()) + sizeof(SingleFileStorage::PadSizeType);
+SingleFileStorage::PadSizeType get_padding_size(uint64_t padding_pos, uint64_t alignment) {
     auto aligned_pos = padding_pos + alignment - 1;
     aligned_pos -= aligned_pos % alignment;
+    return aligned_pos - padding_pos;
+}
 
-    SingleFileStorage::PadSizeType pad_size = aligned_pos - padding_pos;
+void write_padding_bytes(std::ostream& stream, SingleFileStorage::PadSizeType pad_size) {
     stream.write(reinterpret_cast<const char*>(&pad_size), sizeof(pad_size));
     if (pad_size > 0) {
         std::vector<char> padding(pad_size, 0);
         stream.write(padding.data(), padding.size());
     }
 }
+
+void write_padding(std::ostream& stream, uint64_t alignment) {
+    const uint64_t padding_pos = static_cast<uint64_t>(stream.tellp()) + sizeof(SingleFileStorage::PadSizeType);
+    write_padding_bytes(stream, get_padding_size(padding_pos, alignment));
+}
 }  // namespace
 
 const size_t SingleFileStorage::blob_alignment = []() {
@@ -87,6 +93,7 @@ SingleFileStorage::SingleFileStorage(const std::filesystem::path& path)
         read_version(stream, file_version);
         validate_version(file_version);
     }
+    m_file_end = static_cast<uint64_t>(std::filesystem::file_size(m_file_path));
 }
 
 bool SingleFileStorage::build_content_index(std::ifstream& stream) {
@@ -210,39 +217,71 @@ bool SingleFileStorage::has_blob_id(BlobIdType blob_id) const {
     return m_blob_index.find(blob_id) != m_blob_index.end();
 }
 
-void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer) {
-    OPENVINO_ASSERT(!has_blob_id(blob_id), "Blob with id ", blob_id, " already exists in cache.");
+void SingleFileStorage::write_cache_entry(const std::string& blob_id, StreamWriter writer) {
+    ScopedLocale plocal_C(LC_ALL, "C");
+    const auto id = convert_blob_id(blob_id);
+
+    // The writers append to the file one at a time, the readers see the entry once it is committed to the index
+    std::lock_guard<std::mutex> write_lock(m_write_mutex);
+    uint64_t file_end;
+    {
+        std::shared_lock lock(m_mutex);
+        OPENVINO_ASSERT(!has_blob_id(id), "Blob with id ", id, " already exists in cache.");
+        file_end = m_file_end;
+    }
+
+    std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out);
+    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", id);
+    stream.seekp(static_cast<std::streamoff>(file_end));
 
     std::streampos blob_pos;
     std::streamoff blob_size;
-
-    const auto blob_writer = [&](std::ostream& s) {
-        s.write(reinterpret_cast<const char*>(&blob_id), sizeof(blob_id));
-        write_padding(s, blob_alignment);
-        blob_pos = s.tellp();
-        OPENVINO_ASSERT(blob_pos >= 0, "Invalid blob data position ", blob_pos, " for blob id ", blob_id);
-        writer(s);
-        blob_size = s.tellp() - blob_pos;
-        OPENVINO_ASSERT(blob_size >= 0, "Invalid blob size ", blob_size, " for blob id ", blob_id);
-    };
-    write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::Blob), blob_writer);
-
     std::string model_name;  // Intentionally empty
-
-    const auto blob_map_writer = [&](std::ostream& s) {
-        s.write(reinterpret_cast<const char*>(&blob_id), sizeof(blob_id));
-        write_tlv_string(s, model_name);
+    const auto discard_records = [&] {
+        // The partial records are cut off, so the file stays readable
+        stream.close();
+        std::error_code ec;
+        std::filesystem::resize_file(m_file_path, file_end, ec);
     };
-    write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_writer);
+    try {
+        const auto blob_writer = [&](std::ostream& s) {
+            s.write(reinterpret_cast<const char*>(&id), sizeof(id));
+            write_padding(s, blob_alignment);
+            blob_pos = s.tellp();
+            OPENVINO_ASSERT(blob_pos >= 0, "Invalid blob data position ", blob_pos, " for blob id ", id);
+            writer(s);
+            blob_size = s.tellp() - blob_pos;
+            OPENVINO_ASSERT(blob_size >= 0, "Invalid blob size ", blob_size, " for blob id ", id);
+        };
+        write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::Blob), blob_writer);
 
-    m_blob_index[blob_id] = {static_cast<uint64_t>(blob_pos), static_cast<uint64_t>(blob_size), std::move(model_name)};
+        const auto blob_map_writer = [&](std::ostream& s) {
+            s.write(reinterpret_cast<const char*>(&id), sizeof(id));
+            write_tlv_string(s, model_name);
+        };
+        write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_writer);
+        stream.flush();
+    } catch (...) {
+        discard_records();
+        throw;
+    }
+    const auto records_end = stream.tellp();
+    if (!stream.good() || records_end < 0) {
+        discard_records();
+        OPENVINO_THROW("Failed to write blob id ", id, " to cache file ", m_file_path);
+    }
+
+    std::unique_lock lock(m_mutex);
+    m_blob_index[id] = {static_cast<uint64_t>(blob_pos), static_cast<uint64_t>(blob_size), std::move(model_name)};
+    m_file_end = static_cast<uint64_t>(records_end);
 }
 
-void SingleFileStorage::write_cache_entry(const std::string& blob_id, StreamWriter writer) {
-    ScopedLocale plocal_C(LC_ALL, "C");
-    std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
-    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
-    write_blob_entry(stream, convert_blob_id(blob_id), writer);
+ov::Tensor SingleFileStorage::map_blob(uint64_t offset, uint64_t size) {
+    std::lock_guard<std::mutex> lock(m_mapping_mutex);
+    if (!m_mapped_file || m_mapped_file.get_byte_size() < offset + size) {
+        m_mapped_file = read_tensor_data(m_file_path);
+    }
+    return ov::Tensor(m_mapped_file, ov::Coordinate{offset}, ov::Coordinate{offset + size});
 }
 
 void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable_mmap, StreamReader reader) {
@@ -250,14 +289,20 @@ void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable
 
     const auto cid = convert_blob_id(blob_id);
 
-    if (std::filesystem::exists(m_file_path) && has_blob_id(cid)) {
-        const auto& [blob_pos, blob_size, model_name] = m_blob_index[cid];
+    BlobInfo blob_info;
+    {
+        std::shared_lock lock(m_mutex);
+        const auto found = m_blob_index.find(cid);
+        if (found == m_blob_index.end()) {
+            return;
+        }
+        blob_info = found->second;
+    }
+
+    if (std::filesystem::exists(m_file_path)) {
+        const auto& [blob_pos, blob_size, model_name] = blob_info;
         if (enable_mmap) {
-            CompiledBlobVariant compiled_blob{std::in_place_index<0>,
-                                              read_tensor_data(m_file_path,
-                                                               element::u8,
-                                                               {static_cast<PartialShape::value_type>(blob_size)},
-                                                               blob_pos)};
+            CompiledBlobVariant compiled_blob{std::in_place_index<0>, map_blob(blob_pos, blob_size)};
             reader(compiled_blob);
         } else {
             // Use parallel file I/O to saturate NVMe bandwidth instead of single-threaded ifstream.
@@ -277,7 +322,10 @@ std::shared_ptr<wsh::Context> SingleFileStorage::get_context() const {
 
 void SingleFileStorage::write_context(const weight_sharing::Context& context) {
     ScopedLocale plocal_C(LC_ALL, "C");
-    std::ofstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::ate);
+    std::lock_guard<std::mutex> write_lock(m_write_mutex);
+    std::unique_lock lock(m_mutex);
+    std::ofstream stream(m_file_path, std::ios::binary | std::ios::in);
+    stream.seekp(static_cast<std::streamoff>(m_file_end));
 
     weight_sharing::WeightRegistry delta_weight_registry;
     for (const auto& [source_id, const_meta_map] : context.m_weight_registry) {
@@ -332,6 +380,9 @@ void SingleFileStorage::write_context(const weight_sharing::Context& context) {
     for (const auto& [source_id, buffer] : context.m_runtime_sources) {
         m_shared_context->m_runtime_sources.emplace(source_id, buffer);
     }
+    if (const auto end_pos = stream.tellp(); end_pos >= 0) {
+        m_file_end = static_cast<uint64_t>(end_pos);
+    }
 }
 
 void SingleFileStorage::initialize(std::shared_ptr<ov::wsh::Context> weight_sharing_context) {
@@ -339,6 +390,7 @@ void SingleFileStorage::initialize(std::shared_ptr<ov::wsh::Context> weight_shar
         m_shared_context = std::move(weight_sharing_context);
     }
 
+    std::unique_lock lock(m_mutex);
     if (std::ifstream stream(m_file_path, std::ios::binary); stream.good()) {
         util::Version file_version;
         read_version(stream, file_version);
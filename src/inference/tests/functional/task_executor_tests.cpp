@@ -4,8 +4,11 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <future>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
@@ -263,3 +266,42 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorTests, runsTasksByPriorityAndDeadline) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    // the only stream is busy until all the tasks are queued
+    std::promise<void> queued;
+    auto blocker = queued.get_future().share();
+    executor->run([blocker] {
+        blocker.wait();
+    });
+
+    std::mutex m;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    auto enqueue = [&](int id, const TaskPriority& priority) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&, id] {
+            std::lock_guard<std::mutex> l{m};
+            order.push_back(id);
+        });
+        futures.emplace_back(p->get_future());
+        executor->run_with_priority(
+            [p] {
+                (*p)();
+            },
+            priority);
+    };
+    const auto now = std::chrono::steady_clock::now();
+    enqueue(0, {0, std::chrono::steady_clock::time_point::max()});
+    enqueue(1, {1, now + std::chrono::seconds(2)});
+    enqueue(2, {1, std::chrono::steady_clock::time_point::max()});
+    enqueue(3, {1, now + std::chrono::seconds(1)});
+    enqueue(4, {2, std::chrono::steady_clock::time_point::max()});
+    enqueue(5, {0, std::chrono::steady_clock::time_point::max()});
+    queued.set_value();
+
+    for (auto&& future : futures) {
+        future.get();
+    }
+    ASSERT_EQ(order, (std::vector<int>{4, 3, 1, 2, 0, 5}));
+}
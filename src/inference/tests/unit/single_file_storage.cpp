@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_assertions.hpp"
@@ -236,6 +239,63 @@ TEST_F(SingleFileStorageTest, WriteReadLargeBlob_ParallelPath) {
     });
 }
 
+TEST_F(SingleFileStorageTest, ConcurrentWriteRead) {
+    constexpr size_t blobs_num = 8;
+    const auto blob_data = [](size_t i) {
+        // Some blobs exceed the parallel I/O threshold
+        return std::vector<uint8_t>(i * 1024 * 1024 + 17, static_cast<uint8_t>(i + 1));
+    };
+
+    std::vector<std::thread> writers;
+    for (size_t i = 0; i < blobs_num; ++i) {
+        writers.emplace_back([&, i] {
+            const auto data = blob_data(i);
+            m_storage->write_cache_entry(std::to_string(i), [&](std::ostream& s) {
+                s.write(reinterpret_cast<const char*>(data.data()), data.size());
+            });
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    // The context is appended after the blobs
+    weight_sharing::Context test_context;
+    test_context.m_weight_registry[1][11] = {100, 200, element::Type_t::f32};
+    m_storage->write_context(test_context);
+
+    const auto blob_read_test = [&](SingleFileStorage& storage) {
+        std::vector<std::thread> readers;
+        std::atomic_size_t read_count{0};
+        for (size_t i = 0; i < blobs_num; ++i) {
+            readers.emplace_back([&, i] {
+                const auto expected = blob_data(i);
+                storage.read_cache_entry(std::to_string(i),
+                                         false,
+                                         [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+                                             auto& stream =
+                                                 std::get<std::reference_wrapper<std::istream>>(compiled_blob).get();
+                                             std::vector<uint8_t> read_data(expected.size());
+                                             stream.read(reinterpret_cast<char*>(read_data.data()), read_data.size());
+                                             EXPECT_EQ(expected, read_data);
+                                             ++read_count;
+                                         });
+            });
+        }
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        EXPECT_EQ(read_count, blobs_num);
+    };
+
+    blob_read_test(*m_storage);
+    m_storage.reset();
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    blob_read_test(reopened_storage);
+    EXPECT_EQ(reopened_storage.get_context()->m_weight_registry.size(), 1);
+}
+
 TEST_F(SingleFileStorageTest, ContextMetaWriteRead) {
     weight_sharing::Context test_context;
     test_context.m_weight_registry[1][11] = {100, 200, element::Type_t::f32};
@@ -374,6 +434,28 @@ TEST_F(SingleFileStorageTest, WriterMisposition) {
                                                  }),
                     AssertFailure,
                     ::testing::HasSubstr("Invalid blob size"));
+
+    // The failed entries are neither indexed nor left in the file
+    EXPECT_EQ(test::utils::fileSize(m_file_path.string()), static_cast<long long>(version_size()));
+    m_storage->read_cache_entry("42", false, [](const ICacheManager::CompiledBlobVariant&) {
+        FAIL() << "Unexpected read for not stored blob id";
+    });
+    const std::vector<uint8_t> blob_data(100, 0xAB);
+    m_storage->write_cache_entry("42", [&](std::ostream& s) {
+        s.write(reinterpret_cast<const char*>(blob_data.data()), blob_data.size());
+    });
+    m_storage.reset();
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    bool read_called = false;
+    reopened_storage.read_cache_entry("42", false, [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+        auto& stream = std::get<std::reference_wrapper<std::istream>>(compiled_blob).get();
+        std::vector<uint8_t> read_data(blob_data.size());
+        stream.read(reinterpret_cast<char*>(read_data.data()), read_data.size());
+        EXPECT_EQ(blob_data, read_data);
+        read_called = true;
+    });
+    EXPECT_TRUE(read_called);
 }
 
 TEST_P(SingleFileStorageTest, WrongSizeWritten) {
@@ -28,6 +28,10 @@ bool AutoSchedule::select_other_device(const std::string& cur_dev_name) {
                 real_device_name = "CPU";
                 is_cpuhelp = true;
                 wait_actual_compiled_model_ready();
+                // the helper is the actual CPU device compiled with other configuration, keep the device
+                if (m_compile_context[ACTUALDEVICE].m_device_info.device_name.find("CPU") != std::string::npos) {
+                    return m_compile_context[ACTUALDEVICE].m_is_already.load();
+                }
             } else {
                 real_device_name = device_name;
             }
@@ -85,6 +89,7 @@ void AutoSchedule::init() {
     }
     // initialize cpuHelpReleasetime
     m_cpuhelp_release_time = std::chrono::steady_clock::now();
+    m_launch_time = m_cpuhelp_release_time;
     std::string profilingTask = "AutoSchedule::AutoSchedule:AutoMode";
     // loadContext[ACTUALDEVICE] is always enabled,
     // when there is CPU and there are more than two devices, loadContext[CPU] is enabled
@@ -139,17 +144,37 @@ void AutoSchedule::init() {
                                                               ScheduleContext::Ptr& m_context) {
         m_compile_context[CPU].m_is_enabled = true;
         const auto cpu_iter = deviceChecker().check_and_return_if_device_in_list("CPU", m_context->m_device_priorities);
-        if (cpu_iter == m_context->m_device_priorities.end() || is_actual_cpu) {
+        if (cpu_iter == m_context->m_device_priorities.end()) {
             m_compile_context[CPU].m_is_enabled = false;
             return;
         }
-        m_compile_context[CPU].m_device_info = *cpu_iter;
-        m_compile_context[CPU].m_device_info.config[ov::hint::performance_mode.name()] =
-            ov::hint::PerformanceMode::LATENCY;
         std::string cache_dir =
             m_compile_context[ACTUALDEVICE].m_device_info.config.count(ov::cache_dir.name())
                 ? m_compile_context[ACTUALDEVICE].m_device_info.config[ov::cache_dir.name()].as<std::string>()
                 : m_context->m_ov_core->get_property("", ov::cache_dir);
+        if (is_actual_cpu) {
+            // the helper is the CPU itself compiled for latency, it serves the first infer requests while the
+            // throughput configuration is compiled. The model is compiled twice, so it is opt-in. Not needed if both
+            // configurations are the same, or if the model compiled for throughput is expected to be imported from
+            // the cache
+            const auto& actual_config = m_compile_context[ACTUALDEVICE].m_device_info.config;
+            const auto hint_iter = actual_config.find(ov::hint::performance_mode.name());
+            if (!m_context->m_cpu_hot_swap || hint_iter == actual_config.end() ||
+                hint_iter->second.as<ov::hint::PerformanceMode>() == ov::hint::PerformanceMode::LATENCY ||
+                !cache_dir.empty()) {
+                m_compile_context[CPU].m_is_enabled = false;
+                return;
+            }
+            m_compile_context[CPU].m_device_info = m_compile_context[ACTUALDEVICE].m_device_info;
+            m_compile_context[CPU].m_device_info.config[ov::hint::performance_mode.name()] =
+                ov::hint::PerformanceMode::LATENCY;
+            m_compile_context[CPU].m_worker_name = "CPU_HELP";
+            LOG_INFO_TAG("will load CPU with latency configuration until the throughput one is compiled");
+            return;
+        }
+        m_compile_context[CPU].m_device_info = *cpu_iter;
+        m_compile_context[CPU].m_device_info.config[ov::hint::performance_mode.name()] =
+            ov::hint::PerformanceMode::LATENCY;
         if (!cache_dir.empty() && (m_context->m_startup_fallback || m_context->m_runtime_fallback)) {
             m_compile_context[CPU].m_device_info.config[ov::cache_dir.name()] = "";
             LOG_INFO_TAG("Clear cache dir setting for CPU accelerator");
@@ -160,9 +185,8 @@ void AutoSchedule::init() {
     if (m_compile_context[ACTUALDEVICE].m_is_enabled) {
         LOG_INFO_TAG("select device:%s", m_compile_context[ACTUALDEVICE].m_device_info.device_name.c_str());
         bool is_actual_cpu = m_compile_context[ACTUALDEVICE].m_device_info.device_name.find("CPU") != std::string::npos;
-        // if Actual device is CPU or perf_hint is cumulative, disabled m_compile_context[CPU], only use
-        // m_compile_context[ACTUALDEVICE]
-        if (is_actual_cpu || !m_context->m_startup_fallback) {
+        // if startup fallback is disabled, disable m_compile_context[CPU], only use m_compile_context[ACTUALDEVICE]
+        if (!m_context->m_startup_fallback) {
             m_compile_context[CPU].m_is_enabled = false;
         } else {
             customize_helper_context_from_cache_setting(is_actual_cpu, m_compile_context, m_context);
@@ -203,6 +227,12 @@ void AutoSchedule::init() {
         m_executor->run(m_compile_context[ACTUALDEVICE].m_task);
         auto recycleTask = [this]() mutable {
             wait_actual_compiled_model_ready();
+            if (m_compile_context[ACTUALDEVICE].m_is_already) {
+                std::chrono::duration<double, std::milli> swap_time = std::chrono::steady_clock::now() - m_launch_time;
+                LOG_INFO_TAG("switch from CPU_HELP to %s after %lf ms",
+                             m_compile_context[ACTUALDEVICE].m_device_info.device_name.c_str(),
+                             swap_time.count());
+            }
             while (!m_exitflag && m_compile_context[ACTUALDEVICE].m_is_already) {
                 // handle the case of ACTUAL faster than CPU
                 m_compile_context[CPU].m_future.wait();
@@ -237,6 +267,11 @@ void AutoSchedule::init() {
                     }
                     cpuhelp_all_start_times.sort(std::less<Time>());
                     cpuhelp_all_end_times.sort(std::less<Time>());
+                    if (m_cpuhelp_infer_count != 0) {
+                        std::chrono::duration<double, std::milli> time_to_first_infer =
+                            cpuhelp_all_end_times.front() - m_launch_time;
+                        LOG_INFO_TAG("CPU_HELP: time to first inference:%lf ms", time_to_first_infer.count());
+                    }
                 });
                 if (destroynum == m_worker_requests["CPU_HELP"].size()) {
                     std::lock_guard<std::mutex> lock(m_context->m_mutex);
@@ -489,6 +524,7 @@ bool AutoSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
     if (!preferred_device.empty()) {
         m_infer_pipeline_tasks_device_specific[preferred_device]->push(std::move(pipeline_task));
     } else {
+        m_queued_tasks++;
         m_infer_pipeline_tasks.push(std::move(pipeline_task));
     }
     return false;
@@ -33,6 +33,8 @@ private:
     bool select_other_device(const std::string& cur_dev_name) override;
     size_t                                                               m_cpuhelp_infer_count = 0;
     double                                                               m_cpuhelp_fps = 0.0;
+    // start of the model compilation, reference of the time to the first inference
+    Time                                                                 m_launch_time;
     mutable std::once_flag                                               m_oc;
     std::once_flag                                                       m_firstload_oc;
     std::future<void>                                                    m_firstload_future;
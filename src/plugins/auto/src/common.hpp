@@ -68,6 +68,7 @@ struct WorkerInferRequest {
     std::list<Time>               m_end_times;
     int                           m_index = 0;
     AutoImmediateExecutor::Ptr    m_fallback_exec;
+    Time                          m_infer_start_time;
 };
 
 struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
@@ -77,12 +78,52 @@ struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         (*m_workptrptr)->m_task = std::move(task);
         (*m_workptrptr)->m_fallback_exec = m_fallback_exec;
+        (*m_workptrptr)->m_infer_start_time = std::chrono::steady_clock::now();
         (*m_workptrptr)->m_inferrequest->start_async();
     };
     WorkerInferRequest** m_workptrptr = nullptr;
     AutoImmediateExecutor::Ptr m_fallback_exec;
 };
 
+/**
+ * @brief Load of a device in CUMULATIVE_THROUGHPUT mode: the number of the infer requests dispatched to the device and
+ * being executed by it, the moving average of the execution time and the histogram of the execution time.
+ * Reported by ov::intel_auto::devices_load_statistics and used by SchedulePolicy::SHORTEST_EXPECTED_DELAY.
+ */
+class DeviceLoadStatistics {
+public:
+    using Ptr = std::shared_ptr<DeviceLoadStatistics>;
+    // [0, 1), [1, 2), [2, 4) ... [512, 1024), [1024, inf) ms
+    static constexpr size_t HISTOGRAM_BUCKETS = 12;
+    // number of the infer requests dispatched to the other devices after which an idle device is tried again, so that
+    // the service time of a device which was once slow is refreshed
+    static constexpr uint64_t EXPLORATION_PERIOD = 64;
+
+    void set_capacity(size_t capacity);
+    void record_dispatch();
+    void cancel_dispatch();
+    // an infer request was dispatched to another device
+    void record_skip();
+    void record_completion(std::chrono::duration<double, std::milli> duration);
+    // expected time to complete a new infer request: the service time if the device has an idle worker request.
+    // Otherwise a busy worker request is released every service time / capacity on average, and the queued infer
+    // requests are served first: the service time * (1 + (queued + 1) / capacity)
+    double get_expected_delay(size_t queued = 0) const;
+    // the device has an idle worker request and was skipped for EXPLORATION_PERIOD infer requests
+    bool should_explore() const;
+    ov::AnyMap to_any_map() const;
+
+private:
+    mutable std::mutex  m_mutex;
+    size_t              m_capacity = 0;
+    uint64_t            m_dispatched = 0;
+    uint64_t            m_completed = 0;
+    uint64_t            m_skipped = 0;
+    int64_t             m_in_flight = 0;
+    double              m_service_time = 0.0;
+    std::vector<uint64_t> m_histogram = std::vector<uint64_t>(HISTOGRAM_BUCKETS, 0);
+};
+
 struct DeviceInformation {
     DeviceName device_name;
     ov::AnyMap config;
@@ -209,6 +250,7 @@ public:
     bool                                           m_batching_disabled = false;
     bool                                           m_startup_fallback = true;
     bool                                           m_runtime_fallback = true;
+    bool                                           m_cpu_hot_swap = false;
     bool                                           m_bind_buffer = false;
     std::shared_ptr<ov::Model>                     m_model;
     std::filesystem::path                          m_model_path;
@@ -8,6 +8,9 @@
 #include "plugin.hpp"
 #include "openvino/util/file_util.hpp"
 
+#include <limits>
+#include <tuple>
+
 // ------------------------------CumuSchedule----------------------------
 namespace ov {
 namespace auto_plugin {
@@ -26,6 +29,33 @@ std::string CumuSchedule::schedule_to_next_device(const std::vector<DeviceInform
         m_n_ctput_schedule_next_device++;
     } else if (schedule_policy == ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY) {
         selected_device_name = devices[current_device_index].device_name;
+    } else if (schedule_policy == ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY) {
+        // the devices are tried in the ascending order of the expected delay, the ties are resolved by the priority.
+        // Only the devices with the shortest expected delay are tried: if all of them are busy, the task waits for a
+        // worker request of such a device rather than being executed by a slower device. An idle device skipped for
+        // DeviceLoadStatistics::EXPLORATION_PERIOD infer requests is tried first, so its service time is refreshed.
+        // The tasks waiting in the shared queue are served before the new one and delay the busy devices.
+        const std::size_t queued = m_queued_tasks;
+        // (explored first, expected delay, device index)
+        std::vector<std::tuple<bool, double, std::size_t>> delays;
+        delays.reserve(devices.size());
+        double shortest_delay = std::numeric_limits<double>::max();
+        for (std::size_t i = 0; i < devices.size(); i++) {
+            const auto it = m_device_load_statistics.find(devices[i].device_name);
+            const bool explore = it != m_device_load_statistics.end() && it->second->should_explore();
+            const double delay = it != m_device_load_statistics.end() ? it->second->get_expected_delay(queued) : 0.0;
+            delays.emplace_back(!explore, delay, i);
+            if (!explore) {
+                shortest_delay = std::min(shortest_delay, delay);
+            }
+        }
+        std::stable_sort(delays.begin(), delays.end(), [](const auto& a, const auto& b) {
+            return std::tie(std::get<0>(a), std::get<1>(a)) < std::tie(std::get<0>(b), std::get<1>(b));
+        });
+        const bool selected = current_device_index < delays.size() &&
+                              (!std::get<0>(delays[current_device_index]) ||
+                               std::get<1>(delays[current_device_index]) <= shortest_delay);
+        selected_device_name = selected ? devices[std::get<2>(delays[current_device_index])].device_name : "";
     }
     return selected_device_name;
 }
@@ -147,6 +177,7 @@ void CumuSchedule::init() {
         m_idle_worker_requests[device.device_name];
         m_worker_requests[device.device_name];
         m_infer_pipeline_tasks_device_specific[device.device_name] = nullptr;
+        m_device_load_statistics[device.device_name] = std::make_shared<DeviceLoadStatistics>();
     }
     // load devices other than CPU first
     if (other_devices_loads.size() > 0) {
@@ -246,9 +277,27 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         }
         auto selected_device_name =
             preferred_device.empty() ? schedule_to_next_device(devices, current_device_index) : preferred_device;
+        if (selected_device_name.empty()) {
+            break;
+        }
+        // the dispatch is recorded before the task is run, as the request may complete before run_pipeline_task returns
+        const auto statistics_it = m_device_load_statistics.find(selected_device_name);
+        const auto load_statistics =
+            statistics_it != m_device_load_statistics.end() ? statistics_it->second : nullptr;
+        if (load_statistics) {
+            load_statistics->record_dispatch();
+        }
         if (run_pipeline_task(pipeline_task, m_idle_worker_requests[selected_device_name], preferred_device)) {
+            for (const auto& statistics : m_device_load_statistics) {
+                if (statistics.second != load_statistics) {
+                    statistics.second->record_skip();
+                }
+            }
             return true;
         } else {
+            if (load_statistics) {
+                load_statistics->cancel_dispatch();
+            }
             current_device_index++;
         }
     }
@@ -257,6 +306,7 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
     if (!preferred_device.empty()) {
         m_infer_pipeline_tasks_device_specific[preferred_device]->push(std::move(pipeline_task));
     } else {
+        m_queued_tasks++;
         m_infer_pipeline_tasks.push(std::move(pipeline_task));
     }
     return false;
@@ -173,6 +173,9 @@ public:
         multi_supported_configKeys.erase(std::remove(
                                 multi_supported_configKeys.begin(), multi_supported_configKeys.end(), ov::intel_auto::enable_runtime_fallback.name()),
                                 multi_supported_configKeys.end());
+        multi_supported_configKeys.erase(std::remove(
+                                multi_supported_configKeys.begin(), multi_supported_configKeys.end(), ov::intel_auto::enable_cpu_hot_swap.name()),
+                                multi_supported_configKeys.end());
         multi_supported_configKeys.erase(std::remove(
                                 multi_supported_configKeys.begin(), multi_supported_configKeys.end(), ov::intel_auto::devices_utilization_threshold.name()),
                                 multi_supported_configKeys.end());
@@ -191,6 +194,9 @@ public:
         multi_supported_properties.erase(std::remove(
                                 multi_supported_properties.begin(), multi_supported_properties.end(), ov::intel_auto::enable_runtime_fallback),
                                 multi_supported_properties.end());
+        multi_supported_properties.erase(std::remove(
+                                multi_supported_properties.begin(), multi_supported_properties.end(), ov::intel_auto::enable_cpu_hot_swap),
+                                multi_supported_properties.end());
         multi_supported_properties.erase(std::remove(multi_supported_properties.begin(),
                                                      multi_supported_properties.end(),
                                                      ov::intel_auto::devices_utilization_threshold),
@@ -10,6 +10,64 @@ thread_local WorkerInferRequest* Schedule::m_this_worker_infer_request = nullptr
 // TODO: revert to the plain variable (see header file), when we moved to the next CentOS 8.x in our support matrix
 thread_local const char* Schedule::m_this_preferred_device_name = "";
 
+void DeviceLoadStatistics::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+}
+
+void DeviceLoadStatistics::record_dispatch() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_dispatched++;
+    m_in_flight++;
+    m_skipped = 0;
+}
+
+void DeviceLoadStatistics::cancel_dispatch() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_dispatched--;
+    m_in_flight--;
+}
+
+void DeviceLoadStatistics::record_skip() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_skipped++;
+}
+
+void DeviceLoadStatistics::record_completion(std::chrono::duration<double, std::milli> duration) {
+    const double time = duration.count();
+    size_t bucket = 0;
+    for (double upper = 1.0; bucket < HISTOGRAM_BUCKETS - 1 && time >= upper; upper *= 2) {
+        bucket++;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_in_flight--;
+    // exponential moving average, so that the changes of the device load are taken into account quickly
+    m_service_time = m_completed == 0 ? time : m_service_time + (time - m_service_time) / 8;
+    m_completed++;
+    m_histogram[bucket]++;
+}
+
+double DeviceLoadStatistics::get_expected_delay(size_t queued) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0 || m_in_flight < static_cast<int64_t>(m_capacity)) {
+        return m_service_time;
+    }
+    return m_service_time * (1.0 + static_cast<double>(queued + 1) / m_capacity);
+}
+
+bool DeviceLoadStatistics::should_explore() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity != 0 && m_in_flight < static_cast<int64_t>(m_capacity) && m_skipped >= EXPLORATION_PERIOD;
+}
+
+ov::AnyMap DeviceLoadStatistics::to_any_map() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {{"DISPATCHED", m_dispatched},
+            {"IN_FLIGHT", std::max<int64_t>(m_in_flight, 0)},
+            {"SERVICE_TIME_MS", m_service_time},
+            {"LATENCY_HISTOGRAM", m_histogram}};
+}
+
 void Schedule::launch(const ScheduleContext::Ptr& context) {
     m_context = context;
     m_log_tag = context->m_log_tag;
@@ -96,6 +154,12 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
     m_infer_pipeline_tasks_device_specific[device] = std::unique_ptr<TaskQueue>(new TaskQueue);
     auto* idle_workerrequests_ptr = &(idle_worker_requests);
     idle_worker_requests.set_capacity(num_requests);
+    const auto statistics_it = m_device_load_statistics.find(device);
+    DeviceLoadStatistics::Ptr load_statistics =
+        statistics_it != m_device_load_statistics.end() ? statistics_it->second : nullptr;
+    if (load_statistics) {
+        load_statistics->set_capacity(num_requests);
+    }
     int num = 0;
     for (auto&& worker_request : worker_requests) {
         worker_request.m_inferrequest = {compiled_model->create_infer_request(), compiled_model._so};
@@ -103,7 +167,12 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
         worker_request_ptr->m_index = num++;
         OPENVINO_ASSERT(idle_worker_requests.try_push(std::make_pair(worker_request_ptr->m_index, worker_request_ptr)) == true);
         worker_request.m_inferrequest->set_callback(
-            [worker_request_ptr, this, device, idle_workerrequests_ptr](std::exception_ptr exception_ptr) mutable {
+            [worker_request_ptr, this, device, idle_workerrequests_ptr, load_statistics](
+                std::exception_ptr exception_ptr) mutable {
+                if (load_statistics) {
+                    load_statistics->record_completion(std::chrono::steady_clock::now() -
+                                                       worker_request_ptr->m_infer_start_time);
+                }
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{worker_request_ptr, *idle_workerrequests_ptr};
                 worker_request_ptr->m_exception_ptr = std::move(exception_ptr);
                 {
@@ -137,7 +206,9 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
                         // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                         ov::threading::Task t;
                         do {
-                            m_infer_pipeline_tasks.try_pop(t);
+                            if (m_infer_pipeline_tasks.try_pop(t)) {
+                                m_queued_tasks--;
+                            }
                         } while (t && schedule_to_worker_infer_request(std::move(t)));
                         do {
                             m_infer_pipeline_tasks_device_specific[device]->try_pop(t);
@@ -263,6 +334,14 @@ Pipeline Schedule::get_async_pipeline(const ISyncInferPtr& infer_request, Worker
     return pipeline;
 }
 
+ov::AnyMap Schedule::get_devices_load_statistics() const {
+    ov::AnyMap statistics;
+    for (const auto& item : m_device_load_statistics) {
+        statistics[item.first] = item.second->to_any_map();
+    }
+    return statistics;
+}
+
 std::string Schedule::get_log_tag() const noexcept {
     return m_log_tag;
 }
@@ -21,6 +21,8 @@ public:
     void run(ov::threading::Task infer_task) override;
     virtual ~Schedule();
     virtual ISyncInferPtr create_sync_infer_request();
+    // map of the device name to its DeviceLoadStatistics, empty if the schedule does not collect the statistics
+    ov::AnyMap get_devices_load_statistics() const;
     static thread_local WorkerInferRequest* m_this_worker_infer_request;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
     // the bug is e.g. manifesting on the old CentOS (and it's 4.8.x gcc) used in our testing
@@ -41,6 +43,8 @@ protected:
     DeviceMap<NotBusyPriorityWorkerRequests>                             m_idle_worker_requests;
     DeviceMap<std::vector<WorkerInferRequest>>                           m_worker_requests;
     TaskQueue                                                            m_infer_pipeline_tasks;
+    // number of the tasks waiting in m_infer_pipeline_tasks
+    std::atomic<std::size_t>                                             m_queued_tasks = {0};
     DeviceMap<std::unique_ptr<TaskQueue>>                                m_infer_pipeline_tasks_device_specific;
     SoCompiledModel                                                      m_passthrough_compiled_model;
     ScheduleContext::Ptr                                                 m_context;
@@ -50,6 +54,8 @@ protected:
     mutable std::atomic<std::size_t>                                     m_request_id = {0};
     std::mutex                                                           m_dev_infer_mutex;
     std::unordered_map<IASyncInferPtr, WorkerInferRequest*>              m_dev_infer;
+    // populated before the workers are generated, not modified afterwards
+    DeviceMap<DeviceLoadStatistics::Ptr>                                 m_device_load_statistics;
 };
 
 }  // namespace auto_plugin
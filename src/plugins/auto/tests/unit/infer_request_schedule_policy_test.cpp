@@ -131,9 +131,119 @@ const std::vector<ConfigParams> configs = {
     ConfigParams{metaDevices,
                  ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY,
                  {{"DEVICE_0", 3}, {"DEVICE_1", 2}, {"DEVICE_2", 1}},
-                 {"DEVICE_0", "DEVICE_0", "DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_2"}}};
+                 {"DEVICE_0", "DEVICE_0", "DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_2"}},
+    // without the load statistics all the devices have the same expected delay, the device priority is followed
+    ConfigParams{metaDevicesWithTwoDevs,
+                 ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY,
+                 {{"DEVICE_0", 2}, {"DEVICE_1", 3}},
+                 {"DEVICE_0", "DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_1"}},
+    ConfigParams{metaDevices,
+                 ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY,
+                 {{"DEVICE_0", 1}, {"DEVICE_1", 3}, {"DEVICE_2", 2}},
+                 {"DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_1", "DEVICE_2", "DEVICE_2"}}};
 
 INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests,
                          MockCumuSchedule,
                          ::testing::ValuesIn(configs),
-                         MockCumuSchedule::getTestCaseName);
\ No newline at end of file
+                         MockCumuSchedule::getTestCaseName);
+class ShortestExpectedDelayScheduleTest : public ov::auto_plugin::CumuSchedule, public ::testing::Test {
+public:
+    void SetUp() override {
+        m_context = std::make_shared<ov::auto_plugin::ScheduleContext>();
+        m_context->m_schedule_policy = ov::intel_auto::SchedulePolicy::SHORTEST_EXPECTED_DELAY;
+        for (const auto& device : metaDevicesWithTwoDevs) {
+            m_device_load_statistics[device.device_name] = std::make_shared<ov::auto_plugin::DeviceLoadStatistics>();
+            m_device_load_statistics[device.device_name]->set_capacity(2);
+        }
+    }
+
+    void TearDown() override {
+        m_device_load_statistics.clear();
+        m_context.reset();
+    }
+
+    void complete(const std::string& device, double time_ms, size_t count = 1) {
+        for (size_t i = 0; i < count; i++) {
+            m_device_load_statistics[device]->record_dispatch();
+            m_device_load_statistics[device]->record_completion(std::chrono::duration<double, std::milli>(time_ms));
+        }
+    }
+};
+
+TEST_F(ShortestExpectedDelayScheduleTest, fasterDeviceIsSelectedFirst) {
+    complete("DEVICE_0", 10.0);
+    complete("DEVICE_1", 2.0);
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_1");
+    // the slower device is not used while the faster one is expected to complete the request first
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 1), "");
+}
+
+TEST_F(ShortestExpectedDelayScheduleTest, busyDeviceIsSelectedIfExpectedToCompleteFirst) {
+    complete("DEVICE_0", 10.0);
+    complete("DEVICE_1", 2.0);
+    m_device_load_statistics["DEVICE_1"]->record_dispatch();
+    m_device_load_statistics["DEVICE_1"]->record_dispatch();
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_1");
+}
+
+TEST_F(ShortestExpectedDelayScheduleTest, idleDeviceIsSelectedIfBusyDeviceIsSlower) {
+    complete("DEVICE_0", 10.0);
+    complete("DEVICE_1", 8.0);
+    m_device_load_statistics["DEVICE_0"]->record_dispatch();
+    m_device_load_statistics["DEVICE_0"]->record_dispatch();
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_1");
+    m_device_load_statistics["DEVICE_1"]->record_dispatch();
+    m_device_load_statistics["DEVICE_1"]->record_dispatch();
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_1");
+}
+
+TEST_F(ShortestExpectedDelayScheduleTest, queuedTasksDelayBusyDevice) {
+    complete("DEVICE_0", 10.0);
+    complete("DEVICE_1", 4.0);
+    m_device_load_statistics["DEVICE_1"]->record_dispatch();
+    m_device_load_statistics["DEVICE_1"]->record_dispatch();
+    // 4 * (1 + 1 / 2) < 10
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_1");
+    // 4 * (1 + 4 / 2) > 10: the idle device completes the request first
+    m_queued_tasks = 3;
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_0");
+    EXPECT_DOUBLE_EQ(m_device_load_statistics["DEVICE_1"]->get_expected_delay(3), 12.0);
+}
+
+TEST_F(ShortestExpectedDelayScheduleTest, skippedIdleDeviceIsExplored) {
+    complete("DEVICE_0", 10.0);
+    complete("DEVICE_1", 2.0);
+    for (uint64_t i = 0; i < ov::auto_plugin::DeviceLoadStatistics::EXPLORATION_PERIOD - 1; i++) {
+        m_device_load_statistics["DEVICE_0"]->record_skip();
+    }
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_1");
+    m_device_load_statistics["DEVICE_0"]->record_skip();
+    EXPECT_TRUE(m_device_load_statistics["DEVICE_0"]->should_explore());
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 0), "DEVICE_0");
+    // the fastest device is still tried if the explored one is busy
+    EXPECT_EQ(schedule_to_next_device(metaDevicesWithTwoDevs, 1), "DEVICE_1");
+    // the exploration restarts once the device gets an infer request
+    m_device_load_statistics["DEVICE_0"]->record_dispatch();
+    EXPECT_FALSE(m_device_load_statistics["DEVICE_0"]->should_explore());
+}
+
+TEST_F(ShortestExpectedDelayScheduleTest, loadStatisticsAreReported) {
+    complete("DEVICE_0", 0.5);
+    complete("DEVICE_0", 3.0, 2);
+    complete("DEVICE_0", 5000.0);
+    m_device_load_statistics["DEVICE_1"]->record_dispatch();
+    const auto statistics = get_devices_load_statistics();
+    ASSERT_EQ(statistics.size(), 2u);
+    const auto device_0 = statistics.at("DEVICE_0").as<ov::AnyMap>();
+    EXPECT_EQ(device_0.at("DISPATCHED").as<uint64_t>(), 4u);
+    EXPECT_EQ(device_0.at("IN_FLIGHT").as<int64_t>(), 0);
+    EXPECT_GT(device_0.at("SERVICE_TIME_MS").as<double>(), 0.0);
+    const auto histogram = device_0.at("LATENCY_HISTOGRAM").as<std::vector<uint64_t>>();
+    ASSERT_EQ(histogram.size(), ov::auto_plugin::DeviceLoadStatistics::HISTOGRAM_BUCKETS);
+    EXPECT_EQ(histogram[0], 1u);
+    EXPECT_EQ(histogram[2], 2u);
+    EXPECT_EQ(histogram.back(), 1u);
+    const auto device_1 = statistics.at("DEVICE_1").as<ov::AnyMap>();
+    EXPECT_EQ(device_1.at("DISPATCHED").as<uint64_t>(), 1u);
+    EXPECT_EQ(device_1.at("IN_FLIGHT").as<int64_t>(), 1);
+}
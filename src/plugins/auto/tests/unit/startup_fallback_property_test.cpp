@@ -122,4 +122,73 @@ const std::vector<ConfigParams> testCacheConfigs = {
 INSTANTIATE_TEST_SUITE_P(smoke_Auto_disableCachingForCPUPlugin,
                          AutoLoadExeNetworkCacheDirSettingTest,
                          ::testing::ValuesIn(testCacheConfigs),
-                         AutoLoadExeNetworkCacheDirSettingTest::getTestCaseNameCacheTest);
\ No newline at end of file
+                         AutoLoadExeNetworkCacheDirSettingTest::getTestCaseNameCacheTest);
+using CpuHotSwapParams = std::tuple<std::string,  // performance hint of the CPU device
+                                    bool,         // startup fallback
+                                    bool,         // cpu hot swap
+                                    bool>;        // expected compiling of the CPU helper with latency hint
+class AutoCpuHotSwap : public tests::AutoTest, public ::testing::TestWithParam<CpuHotSwapParams> {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<CpuHotSwapParams> obj) {
+        const auto& [hint, startup_fallback, hot_swap, expected_helper] = obj.param;
+        std::ostringstream result;
+        result << "hint_" << hint << "_startup_fallback_" << startup_fallback << "_hot_swap_" << hot_swap
+               << "_expected_helper_" << expected_helper;
+        return result.str();
+    }
+    void SetUp() override {
+        plugin->set_device_name("AUTO");
+        ON_CALL(*core,
+                compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                              ::testing::Matcher<const std::string&>(_),
+                              _))
+            .WillByDefault(Return(mockExeNetwork));
+        ON_CALL(*plugin, get_valid_device)
+            .WillByDefault([](const std::vector<DeviceInformation>& metaDevices, const std::string& netPrecision) {
+                std::list<DeviceInformation> devices(metaDevices.begin(), metaDevices.end());
+                return devices;
+            });
+    }
+};
+
+TEST_P(AutoCpuHotSwap, compileCpuHelperWithLatencyHint) {
+    const auto& [hint, startup_fallback, hot_swap, expected_helper] = this->GetParam();
+    metaDevices = {{ov::test::utils::DEVICE_CPU, {{ov::hint::performance_mode.name(), hint}}, -1}};
+    ON_CALL(*plugin, parse_meta_devices(_, _)).WillByDefault(Return(metaDevices));
+    ON_CALL(*plugin, select_device(_, _, _, _)).WillByDefault(Return(metaDevices[0]));
+
+    std::map<std::string, std::string> actual_config = {{ov::hint::performance_mode.name(), hint}};
+    std::map<std::string, std::string> helper_config = {{ov::hint::performance_mode.name(), "LATENCY"}};
+    if (hint == "LATENCY") {
+        EXPECT_CALL(*core,
+                    compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                                  ::testing::Matcher<const std::string&>(StrEq(ov::test::utils::DEVICE_CPU)),
+                                  ::testing::Matcher<const ov::AnyMap&>(MapContains(actual_config))))
+            .Times(1);
+    } else {
+        EXPECT_CALL(*core,
+                    compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                                  ::testing::Matcher<const std::string&>(StrEq(ov::test::utils::DEVICE_CPU)),
+                                  ::testing::Matcher<const ov::AnyMap&>(MapContains(actual_config))))
+            .Times(1);
+        EXPECT_CALL(*core,
+                    compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                                  ::testing::Matcher<const std::string&>(StrEq(ov::test::utils::DEVICE_CPU)),
+                                  ::testing::Matcher<const ov::AnyMap&>(MapContains(helper_config))))
+            .Times(expected_helper ? 1 : 0);
+    }
+
+    OV_ASSERT_NO_THROW(plugin->compile_model(model,
+                                             {ov::intel_auto::enable_startup_fallback(startup_fallback),
+                                              ov::intel_auto::enable_cpu_hot_swap(hot_swap)}));
+}
+
+const std::vector<CpuHotSwapParams> testCpuHotSwapConfigs = {CpuHotSwapParams{"THROUGHPUT", true, true, true},
+                                                             CpuHotSwapParams{"THROUGHPUT", true, false, false},
+                                                             CpuHotSwapParams{"THROUGHPUT", false, true, false},
+                                                             CpuHotSwapParams{"LATENCY", true, true, false}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Auto_CpuHotSwap,
+                         AutoCpuHotSwap,
+                         ::testing::ValuesIn(testCpuHotSwapConfigs),
+                         AutoCpuHotSwap::getTestCaseName);
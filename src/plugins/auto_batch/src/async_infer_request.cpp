@@ -65,12 +65,19 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                // the arrival is recorded together with the push under the mutex, so of the requests arriving at
+                // once only one starts the batch, and the worker never sees the task before its arrival time
+                std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
+                workerInferRequest->record_arrival(workerInferRequest->_tasks.size() == 0);
                 workerInferRequest->_tasks.push(t);
-                // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
+                // notified under the mutex, so the wake-up is not lost while the worker computes its timeout
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
+                } else if (sz == 1) {
+                    // the worker restarts waiting with the timeout adapted to the batch being collected
+                    workerInferRequest->_cond.notify_one();
                 }
             };
             AsyncInferRequest* _this = nullptr;
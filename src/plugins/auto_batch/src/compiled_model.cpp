@@ -5,10 +5,53 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <algorithm>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+void update_moving_average(double& average, std::chrono::steady_clock::duration duration) {
+    const auto value = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    average = average > 0 ? average + (value - average) / 4 : value;
+}
+}  // namespace
+
+void CompiledModel::WorkerInferRequest::record_arrival(bool first, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    if (_last_arrival != std::chrono::steady_clock::time_point{})
+        update_moving_average(_arrival_interval, now - _last_arrival);
+    _last_arrival = now;
+    if (first)
+        _first_arrival = now;
+}
+
+void CompiledModel::WorkerInferRequest::record_execution(std::chrono::steady_clock::duration duration, bool batched) {
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    update_moving_average(batched ? _batch_execution : _single_execution, duration);
+}
+
+std::chrono::microseconds CompiledModel::WorkerInferRequest::get_time_out(std::chrono::milliseconds max_time_out,
+                                                                         std::chrono::steady_clock::time_point now) {
+    if (_tasks.size() == 0)
+        return max_time_out;
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    auto time_out = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(max_time_out).count());
+    if (_arrival_interval > 0) {
+        // when the batch is not expected to be full in time, collect only the requests arriving close to each other
+        const double expected_fill = _arrival_interval * (_batch_size - 1);
+        time_out = expected_fill > time_out ? std::min(time_out, _arrival_interval)
+                                            : std::min(time_out, 2 * expected_fill);
+    }
+    if (_batch_execution > 0 && _single_execution > 0) {
+        // waiting longer than the batched execution saves over the batch1 execution does not pay off
+        time_out = std::min(time_out, std::max(0.0, _batch_size * _single_execution - _batch_execution));
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - _first_arrival);
+    return std::max(std::chrono::microseconds(0), std::chrono::microseconds(static_cast<int64_t>(time_out)) - elapsed);
+}
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -17,13 +60,15 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<int, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_partial_batch(compiled_models_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
@@ -65,16 +110,33 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        auto save_default_tensor = [&](const ov::Output<const ov::Node>& port) {
+            auto tensor = workerRequestPtr->_infer_request_batched->get_tensor(port);
+            if (!tensor._so)
+                tensor._so = workerRequestPtr->_infer_request_batched._so;
+            workerRequestPtr->_default_batched_tensors[port] = tensor;
+        };
+        for (const auto& input_id : m_batched_inputs)
+            save_default_tensor(inputs()[input_id]);
+        for (const auto& output_id : m_batched_outputs)
+            save_default_tensor(outputs()[output_id]);
+        for (const auto& partial_batch : m_compiled_models_partial_batch) {
+            auto& request = workerRequestPtr->_infer_requests_partial_batch[partial_batch.first];
+            request = {partial_batch.second->create_infer_request(), partial_batch.second._so};
+        }
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                workerRequestPtr->record_execution(std::chrono::steady_clock::now() - workerRequestPtr->_batch_start,
+                                                   true);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
                     workerRequestPtr->_completion_tasks[c]();
                 }
                 // reset the timeout
+                std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
                 workerRequestPtr->_is_wakeup = true;
                 workerRequestPtr->_cond.notify_one();
             });
@@ -84,7 +146,10 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    // the time to collect the batch is adapted to the requests arrival rate and the batch execution
+                    // time, the AUTO_BATCH_TIMEOUT is the upper bound
+                    const auto time_out = workerRequestPtr->get_time_out(std::chrono::milliseconds(m_time_out));
+                    status = workerRequestPtr->_cond.wait_for(lock, time_out);
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -97,31 +162,76 @@ CompiledModel::GetWorkerInferRequest() const {
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                        std::vector<std::shared_ptr<ov::autobatch_plugin::SyncInferRequest>> requests(sz);
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
+                            requests[t.first->m_sync_request->get_batch_id()] = t.first->m_sync_request;
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        bind_batched_tensors(*workerRequestPtr, requests);
+                        for (const auto& request : requests) {
+                            request->copy_inputs_if_needed();
+                        }
+                        workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        // timeout to collect the batch is over, the collected requests are executed with the smaller
+                        // batches (by the binary decomposition of their number), the rest in the batch1 mode
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
+                        auto on_completed = [sz, &arrived, &all_completed](int num) {
+                            if (sz == (arrived += num)) {
+                                all_completed.set_value();
+                            }
+                        };
+                        int n = 0;
+                        auto& partial_requests = workerRequestPtr->_infer_requests_partial_batch;
+                        for (auto it = partial_requests.rbegin(); it != partial_requests.rend(); ++it) {
+                            const int batch = it->first;
+                            if (sz - n < batch)
+                                continue;
+                            auto& partial_request = it->second;
+                            std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(
+                                batch);
+                            for (int b = 0; b < batch; b++, n++) {
+                                OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[b]));
+                                tasks[b].first->m_sync_request->copy_inputs_to(partial_request, b, batch);
+                                tasks[b].first->m_sync_request->m_batched_request_status =
+                                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                            }
+                            partial_request->set_callback(
+                                [tasks, batch, &partial_request, &on_completed](std::exception_ptr p) {
+                                    for (int b = 0; b < batch; b++) {
+                                        auto& sync_request = tasks[b].first->m_sync_request;
+                                        try {
+                                            if (p)
+                                                std::rethrow_exception(p);
+                                            sync_request->copy_outputs_from(partial_request, b, batch);
+                                        } catch (...) {
+                                            sync_request->m_exception_ptr = std::current_exception();
+                                        }
+                                        tasks[b].second();
+                                    }
+                                    on_completed(batch);
+                                });
+                            partial_request->start_async();
+                        }
+                        // popping the rest of the tasks and execute each with batch1
+                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                        for (; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            const auto start = std::chrono::steady_clock::now();
                             t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, start, workerRequestPtr, &on_completed](std::exception_ptr p) {
                                     if (p)
                                         t.first->m_sync_request->m_exception_ptr = p;
+                                    workerRequestPtr->record_execution(std::chrono::steady_clock::now() - start,
+                                                                       false);
                                     t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
-                                    }
+                                    on_completed(1);
                                 });
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
@@ -138,6 +248,24 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::bind_batched_tensors(WorkerInferRequest& worker,
+                                         const std::vector<std::shared_ptr<SyncInferRequest>>& requests) const {
+    for (const auto& port_and_tensor : worker._default_batched_tensors) {
+        const auto& port = port_and_tensor.first;
+        std::vector<ov::SoPtr<ov::ITensor>> tensors;
+        tensors.reserve(requests.size());
+        for (const auto& request : requests) {
+            tensors.push_back(request->get_tensor(port));
+        }
+        auto tensor = get_batched_view(tensors, port_and_tensor.second->get_shape());
+        if (!tensor)
+            tensor = port_and_tensor.second;
+        auto& batched_request = worker._infer_request_batched;
+        if (batched_request->get_tensor(port)->data() != tensor->data())
+            batched_request->set_tensor(port, tensor);
+    }
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -212,10 +340,14 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_partial_batches.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_partial_batches) {
+            auto partial_batches = m_config.find(ov::auto_batch_partial_batches.name());
+            return partial_batches != m_config.end() && partial_batches->second.as<bool>();
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <map>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -17,6 +19,7 @@ namespace ov {
 namespace autobatch_plugin {
 
 class AsyncInferRequest;
+class SyncInferRequest;
 
 class CompiledModel : public ov::ICompiledModel {
 public:
@@ -31,6 +34,28 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // tensors allocated by the batched request for the batched ports, used when the user tensors are not contiguous
+        std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> _default_batched_tensors;
+        // requests compiled for the smaller (power of two) batches to execute the partially collected batches
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _infer_requests_partial_batch;
+
+        // records the arrival of a request, first is true for the first request of the batch
+        void record_arrival(bool first, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+        // records the execution time of the batched request (or of the request without batch)
+        void record_execution(std::chrono::steady_clock::duration duration, bool batched);
+        // time left to collect the batch, up to the max_time_out (AUTO_BATCH_TIMEOUT) since the first request arrived
+        std::chrono::microseconds get_time_out(
+            std::chrono::milliseconds max_time_out,
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+        // statistics for the adaptive timeout, all the durations are moving averages in microseconds
+        std::mutex _stats_mutex;
+        std::chrono::steady_clock::time_point _first_arrival;
+        std::chrono::steady_clock::time_point _last_arrival;
+        std::chrono::steady_clock::time_point _batch_start;
+        double _arrival_interval = 0;
+        double _batch_execution = 0;
+        double _single_execution = 0;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +66,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<int, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -68,6 +94,10 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    // binds the batched request to the memory of the user tensors when they are the consecutive slices of the same
+    // buffer (zero-copy), to its default tensors otherwise
+    void bind_batched_tensors(WorkerInferRequest& worker,
+                              const std::vector<std::shared_ptr<SyncInferRequest>>& requests) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
@@ -79,6 +109,7 @@ protected:
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    const std::map<int, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_partial_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
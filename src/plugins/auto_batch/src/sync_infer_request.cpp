@@ -6,6 +6,7 @@
 #include "sync_infer_request.hpp"
 
 #include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -30,6 +31,27 @@ inline ov::SoPtr<ov::ITensor> create_shared_tensor_on_batched_tensor(ov::SoPtr<o
     }
 }
 
+ov::SoPtr<ov::ITensor> get_batched_view(const std::vector<ov::SoPtr<ov::ITensor>>& tensors,
+                                        const ov::Shape& batched_shape) {
+    if (tensors.empty() || !tensors[0])
+        return {};
+    const auto& first = tensors[0];
+    const auto type = first->get_element_type();
+    const auto slice_size = first->get_byte_size();
+    for (size_t i = 0; i < tensors.size(); i++) {
+        const auto& tensor = tensors[i];
+        if (!tensor || std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) || !tensor->is_continuous() ||
+            tensor->get_element_type() != type || tensor->get_byte_size() != slice_size)
+            return {};
+        if (static_cast<uint8_t*>(tensor->data()) != static_cast<uint8_t*>(first->data()) + i * slice_size)
+            return {};
+    }
+    auto batched_tensor = ov::make_tensor(type, batched_shape, first->data());
+    if (batched_tensor->get_byte_size() != slice_size * tensors.size())
+        return {};
+    return {batched_tensor, first._so};
+}
+
 SyncInferRequest::SyncInferRequest(
     const std::shared_ptr<const ov::autobatch_plugin::CompiledModel>& compiled_model,
     const std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>& worker_request,
@@ -49,6 +71,10 @@ size_t SyncInferRequest::get_batch_size() const {
     return m_batch_size;
 }
 
+size_t SyncInferRequest::get_batch_id() const {
+    return m_batch_id;
+}
+
 void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                                       const std::set<std::size_t>& batched_outputs) {
     const auto inputs = get_inputs();
@@ -105,28 +131,34 @@ void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferR
 }
 
 void SyncInferRequest::copy_inputs_if_needed() {
+    copy_inputs_to(m_batched_request_wrapper->_infer_request_batched, m_batch_id, m_batch_size);
+}
+
+void SyncInferRequest::copy_inputs_to(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size) {
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
-        auto dst_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(it);
-        copy_tensor_if_needed(get_tensor(it), dst_tensor, true);
+        auto dst_tensor = req->get_tensor(it);
+        copy_tensor_if_needed(get_tensor(it), dst_tensor, true, batch_id, batch_size);
     }
 }
 
 void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
                                              ov::SoPtr<ov::ITensor>& dst,
-                                             const bool bInput) {
+                                             const bool bInput,
+                                             size_t batch_id,
+                                             size_t batch_size) {
     auto ptrDst = static_cast<char*>(dst->data());
     auto ptrSrc = static_cast<char*>(src->data());
     ptrdiff_t szDst = dst->get_byte_size();
     ptrdiff_t szSrc = src->get_byte_size();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szDst / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szDst / batch_size : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szSrc / batch_size : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -135,10 +167,14 @@ void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
 }
 
 void SyncInferRequest::copy_outputs_if_needed() {
+    copy_outputs_from(m_batched_request_wrapper->_infer_request_batched, m_batch_id, m_batch_size);
+}
+
+void SyncInferRequest::copy_outputs_from(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size) {
     for (const auto& it : get_outputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto dst_tensor = get_tensor(it);
-        copy_tensor_if_needed(m_batched_request_wrapper->_infer_request_batched->get_tensor(it), dst_tensor, false);
+        copy_tensor_if_needed(req->get_tensor(it), dst_tensor, false, batch_id, batch_size);
     }
 }
 
@@ -11,6 +11,14 @@
 namespace ov {
 namespace autobatch_plugin {
 
+// Batched tensor over the memory of the per-request tensors (ordered by the batch id) when they are the consecutive
+// slices of the same host buffer, so the batched request reads and writes the user memory in place. Empty otherwise.
+ov::SoPtr<ov::ITensor> get_batched_view(const std::vector<ov::SoPtr<ov::ITensor>>& tensors,
+                                        const ov::Shape& batched_shape);
+
+// The default tensors of the request are the views of its slot in the tensors of the batched request, so the data
+// written to them (e.g. by the preprocessing) is consumed in place. The tensors set by the user are copied to the slot,
+// unless the tensors of all the requests of the batch are the consecutive slices of the same buffer.
 class SyncInferRequest : public ov::ISyncInferRequest {
 public:
     SyncInferRequest(const std::shared_ptr<const ov::autobatch_plugin::CompiledModel>& compiled_model,
@@ -27,6 +35,12 @@ public:
 
     void copy_outputs_if_needed();
 
+    // copies the inputs to the batch_id slot of the request compiled for the (partial) batch of batch_size
+    void copy_inputs_to(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
+    // copies the outputs from the batch_id slot of the request compiled for the (partial) batch of batch_size
+    void copy_outputs_from(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t batch_id, size_t batch_size);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,13 +54,20 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
     size_t get_batch_size() const;
 
+    size_t get_batch_id() const;
+
 protected:
-    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
+    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                               ov::SoPtr<ov::ITensor>& dst,
+                               const bool bInput,
+                               size_t batch_id,
+                               size_t batch_size);
 
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                         const std::set<std::size_t>& batched_outputs);
@@ -211,3 +211,63 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
                          PluginCompileModelTest,
                          ::testing::ValuesIn(plugin_compile_model_param_test),
                          PluginCompileModelTest::getTestCaseName);
+
+class PluginCompileModelPartialBatchTest : public PluginCompileModelTest {
+public:
+    std::vector<size_t> m_compiled_batches;
+
+    void SetUp() override {
+        PluginCompileModelTest::SetUp();
+        ON_CALL(*m_core,
+                compile_model(MatcherCast<const std::shared_ptr<const ov::Model>&>(_),
+                              MatcherCast<const std::string&>(_),
+                              _))
+            .WillByDefault(
+                [this](const std::shared_ptr<const ov::Model>& model, const std::string&, const ov::AnyMap&) {
+                    m_compiled_batches.push_back(model->get_parameters()[0]->get_shape()[0]);
+                    return m_mock_compile_model;
+                });
+    }
+};
+
+TEST_P(PluginCompileModelPartialBatchTest, CompilePartialBatchesOnlyOnRequest) {
+    m_model = ov::test::utils::make_multi_single_conv();
+    std::shared_ptr<ov::ICompiledModel> compiled_model;
+    OV_ASSERT_NO_THROW(compiled_model = m_plugin->compile_model(m_model, m_plugin_properities));
+
+    const auto partial_batches = m_plugin_properities.find(ov::auto_batch_partial_batches.name());
+    const bool expect_partial_batches =
+        partial_batches != m_plugin_properities.end() && partial_batches->second.as<bool>();
+    // the model without batch, the model with the full batch and (on request) the smaller power of two batches
+    std::vector<size_t> expected_batches = {1, static_cast<size_t>(m_batch_size)};
+    for (size_t batch = 2; expect_partial_batches && batch < static_cast<size_t>(m_batch_size); batch *= 2)
+        expected_batches.push_back(batch);
+    EXPECT_EQ(m_compiled_batches, expected_batches);
+    EXPECT_EQ(compiled_model->get_property(ov::auto_batch_partial_batches.name()).as<bool>(), expect_partial_batches);
+}
+
+const std::vector<plugin_compile_model_param> plugin_compile_model_partial_batch_param_test = {
+    plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT}},
+                               {{ov::auto_batch_timeout(static_cast<uint32_t>(200))}, {ov::device::priorities("CPU(8)")}},
+                               8},
+    plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT}},
+                               {{ov::auto_batch_timeout(static_cast<uint32_t>(200))},
+                                {ov::auto_batch_partial_batches(false)},
+                                {ov::device::priorities("CPU(8)")}},
+                               8},
+    plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT}},
+                               {{ov::auto_batch_timeout(static_cast<uint32_t>(200))},
+                                {ov::auto_batch_partial_batches(true)},
+                                {ov::device::priorities("CPU(8)")}},
+                               8},
+    plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT}},
+                               {{ov::auto_batch_timeout(static_cast<uint32_t>(200))},
+                                {ov::auto_batch_partial_batches(true)},
+                                {ov::device::priorities("CPU(12)")}},
+                               12},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
+                         PluginCompileModelPartialBatchTest,
+                         ::testing::ValuesIn(plugin_compile_model_partial_batch_param_test),
+                         PluginCompileModelTest::getTestCaseName);
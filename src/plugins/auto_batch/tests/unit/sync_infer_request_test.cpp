@@ -4,10 +4,13 @@
 
 #include "sync_infer_request.hpp"
 
+#include <cstring>
+
 #include "common_test_utils/subgraph_builders/multi_single_conv.hpp"
 #include "mock_common.hpp"
 #include "openvino/core/dimension.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 #include "transformations/utils/utils.hpp"
 #include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
@@ -220,6 +223,58 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     EXPECT_NO_THROW(req->get_profiling_info());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyToPartialBatchTestCase) {
+    if (m_batch_size < 2)
+        GTEST_SKIP() << "the partial batches are used only for the batch of 2 and more";
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    // the request compiled for the partial batch of 2 (out of the m_batch_size)
+    const size_t partial_batch = 2;
+    auto partial_model = m_model->clone();
+    partial_model->reshape(ov::PartialShape{static_cast<int64_t>(partial_batch), 3, 24, 24});
+    auto i_compile_model_partial_batch =
+        std::make_shared<NiceMock<MockICompiledModel>>(partial_model, m_auto_batch_plugin);
+    auto sync_infer_request_partial_batch =
+        std::make_shared<NiceMock<MockISyncInferRequest>>(i_compile_model_partial_batch);
+    ov::SoPtr<ov::IAsyncInferRequest> partial_request = {
+        std::make_shared<NiceMock<MockIAsyncInferRequest>>(sync_infer_request_partial_batch, m_executor, nullptr),
+        {}};
+
+    // the requests to execute are the last ones of the full batch, but take the first positions in the partial batch
+    for (size_t b = 0; b < partial_batch; b++) {
+        auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                      workerRequestPtr,
+                                                      static_cast<int>(m_batch_size - partial_batch + b),
+                                                      m_batch_size,
+                                                      m_batched_inputs,
+                                                      m_batched_outputs);
+        m_auto_batch_infer_requests.emplace_back(req);
+        const auto& input = req->get_inputs()[0];
+        const auto& output = req->get_outputs()[0];
+        auto input_tensor = ov::make_tensor(input.get_element_type(), input.get_shape());
+        auto output_tensor = ov::make_tensor(output.get_element_type(), output.get_shape());
+        req->set_tensor(input, {input_tensor, {}});
+        req->set_tensor(output, {output_tensor, {}});
+        std::memset(input_tensor->data(), static_cast<int>(b + 1), input_tensor->get_byte_size());
+
+        OV_ASSERT_NO_THROW(req->copy_inputs_to(partial_request, b, partial_batch));
+        auto partial_input = partial_request->get_tensor(input);
+        ASSERT_EQ(partial_input->get_byte_size(), partial_batch * input_tensor->get_byte_size());
+        auto partial_input_slice =
+            static_cast<uint8_t*>(partial_input->data()) + b * input_tensor->get_byte_size();
+        EXPECT_EQ(std::memcmp(partial_input_slice, input_tensor->data(), input_tensor->get_byte_size()), 0);
+
+        auto partial_output = partial_request->get_tensor(output);
+        ASSERT_EQ(partial_output->get_byte_size(), partial_batch * output_tensor->get_byte_size());
+        auto partial_output_slice =
+            static_cast<uint8_t*>(partial_output->data()) + b * output_tensor->get_byte_size();
+        std::memset(partial_output_slice, static_cast<int>(b + 3), output_tensor->get_byte_size());
+        OV_ASSERT_NO_THROW(req->copy_outputs_from(partial_request, b, partial_batch));
+        EXPECT_EQ(std::memcmp(output_tensor->data(), partial_output_slice, output_tensor->get_byte_size()), 0);
+    }
+}
+
 std::vector<ov::element::Type_t> element_type{ov::element::Type_t::f16,
                                               ov::element::Type_t::f32,
                                               ov::element::Type_t::f64,
@@ -237,3 +292,35 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
                          AutoBatchRequestTest,
                          ::testing::Combine(::testing::ValuesIn(batch_size), ::testing::ValuesIn(element_type)),
                          AutoBatchRequestTest::getTestCaseName);
+
+TEST(AutoBatchBatchedViewTest, ConsecutiveSlicesAreBoundInPlace) {
+    auto buffer = ov::make_tensor(ov::element::f32, ov::Shape{4, 3, 2});
+    const auto slice_size = buffer->get_byte_size() / 4;
+    std::vector<ov::SoPtr<ov::ITensor>> slots;
+    for (size_t i = 0; i < 4; i++) {
+        auto data = static_cast<uint8_t*>(buffer->data()) + i * slice_size;
+        slots.push_back({ov::make_tensor(ov::element::f32, ov::Shape{1, 3, 2}, data), nullptr});
+    }
+    auto batched = get_batched_view(slots, ov::Shape{4, 3, 2});
+    ASSERT_NE(batched, nullptr);
+    EXPECT_EQ(batched->data(), buffer->data());
+    EXPECT_EQ(batched->get_shape(), ov::Shape({4, 3, 2}));
+}
+
+TEST(AutoBatchBatchedViewTest, SeparateTensorsAreNotBound) {
+    std::vector<ov::SoPtr<ov::ITensor>> slots;
+    for (size_t i = 0; i < 4; i++) {
+        slots.push_back({ov::make_tensor(ov::element::f32, ov::Shape{1, 3, 2}), nullptr});
+    }
+    EXPECT_EQ(get_batched_view(slots, ov::Shape{4, 3, 2}), nullptr);
+}
+
+TEST(AutoBatchBatchedViewTest, ReorderedSlicesAreNotBound) {
+    auto buffer = ov::make_tensor(ov::element::f32, ov::Shape{2, 3, 2});
+    const auto slice_size = buffer->get_byte_size() / 2;
+    auto first = static_cast<uint8_t*>(buffer->data());
+    std::vector<ov::SoPtr<ov::ITensor>> slots{
+        {ov::make_tensor(ov::element::f32, ov::Shape{1, 3, 2}, first + slice_size), nullptr},
+        {ov::make_tensor(ov::element::f32, ov::Shape{1, 3, 2}, first), nullptr}};
+    EXPECT_EQ(get_batched_view(slots, ov::Shape{2, 3, 2}), nullptr);
+}
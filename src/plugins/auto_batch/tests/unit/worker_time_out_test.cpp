@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mock_common.hpp"
+
+using namespace std::chrono;
+
+class WorkerTimeOutTest : public ::testing::Test {
+public:
+    CompiledModel::WorkerInferRequest m_worker;
+    // all the times are given explicitly, so the expected timeouts do not depend on the test machine load
+    const steady_clock::time_point m_start = steady_clock::time_point{} + hours(1);
+
+    void SetUp() override {
+        m_worker._batch_size = 4;
+    }
+
+    void add_task() {
+        m_worker._first_arrival = m_start;
+        m_worker._tasks.push({nullptr, [] {}});
+    }
+};
+
+TEST_F(WorkerTimeOutTest, NoTasksWaitMaxTimeOut) {
+    m_worker._arrival_interval = 1000;
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(100), m_start), microseconds(100000));
+}
+
+TEST_F(WorkerTimeOutTest, NoStatisticsWaitMaxTimeOut) {
+    add_task();
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(100), m_start), microseconds(100000));
+    // the time already spent on collecting the batch is deduced
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(100), m_start + milliseconds(10)), microseconds(90000));
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(100), m_start + milliseconds(200)), microseconds(0));
+}
+
+TEST_F(WorkerTimeOutTest, FrequentArrivalsWaitForBatchToFill) {
+    add_task();
+    m_worker._arrival_interval = 1000;
+    // 3 more requests are expected in 3ms, twice more is waited
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(1000), m_start), microseconds(6000));
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(1000), m_start + milliseconds(2)), microseconds(4000));
+}
+
+TEST_F(WorkerTimeOutTest, RareArrivalsDoNotWaitForBatchToFill) {
+    add_task();
+    m_worker._arrival_interval = 400000;
+    // the batch is not expected to be full within the max timeout, so only the next request is waited
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(1000), m_start), microseconds(400000));
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(1000), m_start + milliseconds(100)), microseconds(300000));
+}
+
+TEST_F(WorkerTimeOutTest, NoWaitWhenBatchingDoesNotPayOff) {
+    add_task();
+    m_worker._single_execution = 10000;
+    m_worker.record_execution(milliseconds(40), true);
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(1000), m_start), microseconds(0));
+}
+
+TEST_F(WorkerTimeOutTest, WaitLimitedBySavingOfBatchedExecution) {
+    add_task();
+    m_worker._single_execution = 10000;
+    m_worker.record_execution(milliseconds(35), true);
+    // 4 requests in the batch1 mode take 40ms, the batched request takes 35ms
+    EXPECT_EQ(m_worker.get_time_out(milliseconds(1000), m_start), microseconds(5000));
+}
+
+TEST_F(WorkerTimeOutTest, RecordArrivalUpdatesInterval) {
+    m_worker.record_arrival(true, m_start);
+    EXPECT_EQ(m_worker._arrival_interval, 0);
+    EXPECT_EQ(m_worker._first_arrival, m_start);
+    m_worker.record_arrival(false, m_start + milliseconds(2));
+    EXPECT_EQ(m_worker._arrival_interval, 2000);
+    // the moving average moves by the quarter of the difference
+    m_worker.record_arrival(false, m_start + milliseconds(10));
+    EXPECT_EQ(m_worker._arrival_interval, 3500);
+    EXPECT_EQ(m_worker._first_arrival, m_start);
+    EXPECT_EQ(m_worker._last_arrival, m_start + milliseconds(10));
+}
@@ -4,6 +4,11 @@
 
 #include "async_infer_request.hpp"
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
 struct RequestExecutor : ov::threading::ITaskExecutor {
     explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
         m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
@@ -21,12 +26,61 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     ov::threading::Task m_task;
 };
 
+// Runs the subrequests of a micro-batch pipeline step concurrently, the task is run when all of them are finished
+struct MicroBatchStepExecutor : ov::threading::ITaskExecutor {
+    MicroBatchStepExecutor(std::vector<ov::SoPtr<ov::IAsyncInferRequest>>& requests,
+                           std::function<std::vector<size_t>()> bind_step)
+        : m_requests(requests),
+          m_bind_step(std::move(bind_step)) {}
+    void run(ov::threading::Task task) override {
+        m_task = std::move(task);
+        m_exception_ptr = nullptr;
+        const auto active = m_bind_step();
+        m_pending = active.size();
+        for (const auto idx : active) {
+            m_requests[idx]->set_callback([this](std::exception_ptr exception_ptr) {
+                if (nullptr != exception_ptr) {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_exception_ptr = std::move(exception_ptr);
+                }
+                if (--m_pending == 0) {
+                    auto task = std::move(m_task);
+                    task();
+                }
+            });
+        }
+        for (const auto idx : active) {
+            m_requests[idx]->start_async();
+        }
+    };
+    std::vector<ov::SoPtr<ov::IAsyncInferRequest>>& m_requests;
+    std::function<std::vector<size_t>()> m_bind_step;
+    std::mutex m_mutex;
+    std::atomic<size_t> m_pending{0};
+    std::exception_ptr m_exception_ptr;
+    ov::threading::Task m_task;
+};
+
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
+    if (m_infer_request->m_micro_batches > 1) {
+        for (size_t step = 0; step < m_infer_request->micro_batch_steps(); step++) {
+            auto step_executor =
+                std::make_shared<MicroBatchStepExecutor>(m_infer_request->m_subrequests, [this, step] {
+                    return m_infer_request->bind_micro_batch_step(step);
+                });
+            m_pipeline.emplace_back(step_executor, [step_executor] {
+                if (nullptr != step_executor->m_exception_ptr) {
+                    std::rethrow_exception(step_executor->m_exception_ptr);
+                }
+            });
+        }
+        return;
+    }
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
         m_pipeline.emplace_back(request_executor, [request_executor] {
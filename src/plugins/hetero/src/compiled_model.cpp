@@ -8,15 +8,19 @@
 #include <chrono>
 #include <cstdint>
 #include <limits>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "async_infer_request.hpp"
 #include "blob_serialization.hpp"
 #include "graph_debug_dump.hpp"
 #include "itt.hpp"
 #include "op/device_subgraph.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
@@ -124,6 +128,87 @@ void write_framed_payload_via_seekable_stream(std::ostream& modelStream,
     ov::hetero::write_framed_payload(modelStream, payloadType, payloadStream, payloadSize);
 }
 
+// Reshapes the submodels for the micro-batch when all their inputs and outputs share the same static batch dimension
+// divisible by the number of micro-batches. Returns an empty vector otherwise.
+std::vector<ov::hetero::SubmodelInfo> make_micro_batch_submodels(const std::vector<ov::hetero::SubmodelInfo>& submodels,
+                                                                 size_t micro_batches) {
+    if (micro_batches < 2 || submodels.size() < 2) {
+        return {};
+    }
+    size_t batch = 0;
+    const auto has_batch = [&](const ov::PartialShape& shape) {
+        if (shape.is_dynamic() || shape.rank().get_length() == 0) {
+            return false;
+        }
+        const auto dim = static_cast<size_t>(shape[0].get_length());
+        batch = batch == 0 ? dim : batch;
+        return dim == batch;
+    };
+    for (const auto& submodel : submodels) {
+        const auto& model = submodel.second;
+        if (!model->get_sinks().empty()) {
+            return {};
+        }
+        for (const auto& input : model->inputs()) {
+            if (!has_batch(input.get_partial_shape())) {
+                return {};
+            }
+        }
+        for (const auto& output : model->outputs()) {
+            if (!has_batch(output.get_partial_shape())) {
+                return {};
+            }
+        }
+    }
+    if (batch < micro_batches || batch % micro_batches != 0) {
+        return {};
+    }
+
+    const auto micro_batch = static_cast<int64_t>(batch / micro_batches);
+    std::vector<ov::hetero::SubmodelInfo> micro_batch_submodels;
+    micro_batch_submodels.reserve(submodels.size());
+    for (const auto& [device, model] : submodels) {
+        auto micro_batch_model = model->clone();
+        std::map<ov::Output<ov::Node>, ov::PartialShape> shapes;
+        for (const auto& input : micro_batch_model->inputs()) {
+            auto shape = input.get_partial_shape();
+            shape[0] = micro_batch;
+            shapes.emplace(input, shape);
+        }
+        try {
+            micro_batch_model->reshape(shapes);
+        } catch (const std::exception&) {
+            return {};
+        }
+        for (const auto& output : micro_batch_model->outputs()) {
+            const auto& shape = output.get_partial_shape();
+            if (shape.is_dynamic() || shape[0].get_length() != micro_batch) {
+                return {};
+            }
+        }
+        micro_batch_submodels.emplace_back(device, micro_batch_model);
+    }
+    return micro_batch_submodels;
+}
+
+// Port of the whole batch for the port of a submodel compiled for the micro-batch
+ov::Output<const ov::Node> make_whole_batch_port(const ov::Output<const ov::Node>& port,
+                                                 size_t micro_batches,
+                                                 bool is_output) {
+    auto shape = port.get_shape();
+    shape[0] *= micro_batches;
+    auto parameter = std::make_shared<ov::op::v0::Parameter>(port.get_element_type(), shape);
+    parameter->set_friendly_name(port.get_node()->get_friendly_name());
+    parameter->output(0).get_tensor().set_names(port.get_names());
+    if (!is_output) {
+        return parameter->output(0);
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(parameter);
+    result->set_friendly_name(port.get_node()->get_friendly_name());
+    result->output(0).get_tensor().set_names(port.get_names());
+    return result->output(0);
+}
+
 }  // namespace
 
 ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -158,7 +243,10 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         t0 = clock::now();
     }
 
-    const bool add_exclusive = submodels.size() > 1;
+    const auto micro_batch_submodels = make_micro_batch_submodels(submodels, m_cfg.micro_batches);
+    m_micro_batches = micro_batch_submodels.empty() ? 1 : m_cfg.micro_batches;
+    // the submodels processing different micro-batches at the same time must not share a single executor
+    const bool add_exclusive = submodels.size() > 1 && m_micro_batches == 1;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -167,7 +255,7 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
     m_compiled_submodels.reserve(submodels.size());
 
     size_t submodel_index = 0;
-    for (const auto& [device, sub_model] : submodels) {
+    for (const auto& [device, sub_model] : micro_batch_submodels.empty() ? submodels : micro_batch_submodels) {
         clock::time_point t_submodel_start{};
         clock::time_point t_compile_start{};
         clock::time_point t_compile_end{};
@@ -267,6 +355,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
 
     pugi::xml_node heteroNode = heteroXmlDoc.document_element();
     m_name = get_str_attr(heteroNode, "name");
+    m_micro_batches = static_cast<size_t>(get_uint64_attr(heteroNode, "micro_batches", 1));
     const auto version_attr = heteroNode.attribute(HETERO_BLOB_FORMAT_VERSION_ATTR);
     std::uint32_t blob_format_version = 1;
     if (version_attr) {
@@ -427,7 +516,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
                                                     ov::loaded_from_cache,
-                                                    ov::hetero::number_of_submodels};
+                                                    ov::hetero::number_of_submodels,
+                                                    ov::hetero::micro_batches};
         return ro_properties;
     };
 
@@ -475,6 +565,9 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{
             (m_compiled_submodels.size() - get_hetero_plugin()->independent_submodel_size)};
+    } else if (ov::hetero::micro_batches == name) {
+        // 1 when the model cannot be split into the micro-batches
+        return decltype(ov::hetero::micro_batches)::value_type{static_cast<uint32_t>(m_micro_batches)};
     }
     return m_cfg.get(name);
 }
@@ -517,6 +610,15 @@ void ov::hetero::CompiledModel::set_inputs_and_outputs() {
                             " outputs. Index is out of range: " + std::to_string(output_idx));
         m_compiled_outputs.emplace_back(compiled_submodel->outputs()[output_idx]);
     }
+    if (m_micro_batches > 1) {
+        // the submodels are compiled for the micro-batch, the model keeps the whole batch
+        for (auto& input : m_compiled_inputs) {
+            input = make_whole_batch_port(input, m_micro_batches, false);
+        }
+        for (auto& output : m_compiled_outputs) {
+            output = make_whole_batch_port(output, m_micro_batches, true);
+        }
+    }
 }
 
 void ov::hetero::CompiledModel::export_model(std::ostream& model_stream) const {
@@ -526,6 +628,9 @@ void ov::hetero::CompiledModel::export_model(std::ostream& model_stream) const {
     auto heteroNode = doc.append_child("hetero");
     heteroNode.append_attribute("name").set_value(m_name.c_str());
     heteroNode.append_attribute(HETERO_BLOB_FORMAT_VERSION_ATTR).set_value(HETERO_BLOB_FORMAT_VERSION);
+    if (m_micro_batches > 1) {
+        heteroNode.append_attribute("micro_batches").set_value(std::to_string(m_micro_batches).c_str());
+    }
 
     auto inputs_map_node = heteroNode.append_child("inputs_to_submodels_inputs");
     for (const auto& it : m_mapping_info._inputs_to_submodels_inputs) {
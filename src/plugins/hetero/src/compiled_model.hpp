@@ -62,6 +62,8 @@ private:
     std::vector<ov::Output<const ov::Node>> m_compiled_inputs;
     std::vector<ov::Output<const ov::Node>> m_compiled_outputs;
     SubgraphsMappingInfo m_mapping_info;
+    // number of micro-batches the submodels are compiled for, 1 if the batch is not split
+    size_t m_micro_batches = 1;
 
     struct CompiledModelDesc {
         std::string device;
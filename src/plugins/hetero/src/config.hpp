@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -38,6 +39,8 @@ struct Configuration {
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    uint32_t micro_batches = 1;
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
@@ -17,5 +17,11 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Number of micro-batches the batch dimension of an inference is split into, so that the consecutive submodels
+ * process different micro-batches at the same time. 1 (default) runs the submodels on the whole batch one by one.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> micro_batches{"HETERO_MICRO_BATCHES"};
 }  // namespace hetero
 }  // namespace ov
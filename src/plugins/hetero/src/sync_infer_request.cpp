@@ -5,14 +5,18 @@
 #include "sync_infer_request.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <exception>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
 #include "remote_tensor.hpp"
@@ -35,6 +39,12 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         m_port_to_subrequest_idx[port] = submodel_idx;
     }
 
+    m_micro_batches = compiled_model->m_micro_batches;
+    if (m_micro_batches > 1) {
+        init_micro_batches(*compiled_model);
+        return;
+    }
+
     std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
     for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
         const auto& submodel_idx_in = kvp.first.first;
@@ -57,6 +67,103 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
 
 ov::hetero::InferRequest::~InferRequest() = default;
 
+void ov::hetero::InferRequest::init_micro_batches(const ov::hetero::CompiledModel& compiled_model) {
+    // the request owns the whole batch tensors, the subrequests get the views of the micro-batches
+    for (const auto& port : get_inputs()) {
+        allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+            tensor = {ov::make_tensor(port.get_element_type(), port.get_shape()), nullptr};
+        });
+    }
+    for (const auto& port : get_outputs()) {
+        allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+            tensor = {ov::make_tensor(port.get_element_type(), port.get_shape()), nullptr};
+        });
+    }
+
+    const auto& mapping_info = compiled_model.m_mapping_info;
+    for (const auto& request : m_subrequests) {
+        m_micro_batch_inputs.emplace_back(request->get_compiled_model()->inputs().size());
+        m_micro_batch_outputs.emplace_back(request->get_compiled_model()->outputs().size());
+    }
+    for (size_t i = 0; i < mapping_info._inputs_to_submodels_inputs.size(); i++) {
+        const auto& [submodel_idx, port_idx] = mapping_info._inputs_to_submodels_inputs[i];
+        m_micro_batch_inputs[submodel_idx][port_idx] = {MicroBatchBinding::Type::INPUT, i};
+    }
+    for (size_t i = 0; i < mapping_info._outputs_to_submodels_outputs.size(); i++) {
+        const auto& [submodel_idx, port_idx] = mapping_info._outputs_to_submodels_outputs[i];
+        m_micro_batch_outputs[submodel_idx][port_idx] = {MicroBatchBinding::Type::OUTPUT, i};
+    }
+
+    // The micro-batch is written by the submodel `out` at the step `micro_batch + out` and read by the submodel `in`
+    // at the step `micro_batch + in`, so the ring buffer keeps `in - out + 1` micro-batches. The model outputs are
+    // read by the next submodels from the views of the model output tensors.
+    std::vector<ov::hetero::NodeInfo> buffer_ports;
+    std::vector<size_t> buffer_depths;
+    for (const auto& [in, out] : mapping_info._submodels_input_to_prev_output) {
+        auto& producer = m_micro_batch_outputs[out.first][out.second];
+        if (producer.type == MicroBatchBinding::Type::NONE) {
+            producer = {MicroBatchBinding::Type::BUFFER, buffer_ports.size()};
+            buffer_ports.push_back(out);
+            buffer_depths.push_back(2);
+        }
+        if (producer.type == MicroBatchBinding::Type::BUFFER) {
+            buffer_depths[producer.index] = std::max(buffer_depths[producer.index], in.first - out.first + 1);
+        }
+        m_micro_batch_inputs[in.first][in.second] = producer;
+    }
+    for (size_t i = 0; i < buffer_ports.size(); i++) {
+        const auto& [submodel_idx, port_idx] = buffer_ports[i];
+        const auto& port = m_subrequests[submodel_idx]->get_compiled_model()->outputs()[port_idx];
+        std::vector<ov::SoPtr<ov::ITensor>> slots;
+        for (size_t slot = 0; slot < buffer_depths[i]; slot++) {
+            slots.push_back({ov::make_tensor(port.get_element_type(), port.get_shape()), nullptr});
+        }
+        m_micro_batch_buffers.emplace_back(std::move(slots));
+    }
+}
+
+ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_micro_batch_tensor(const MicroBatchBinding& binding,
+                                                                        size_t micro_batch) const {
+    if (binding.type == MicroBatchBinding::Type::BUFFER) {
+        const auto& slots = m_micro_batch_buffers[binding.index];
+        return slots[micro_batch % slots.size()];
+    }
+    OPENVINO_ASSERT(binding.type != MicroBatchBinding::Type::NONE, "Submodel port has no micro-batch tensor");
+    const auto& port =
+        binding.type == MicroBatchBinding::Type::INPUT ? get_inputs()[binding.index] : get_outputs()[binding.index];
+    const auto tensor = ov::ISyncInferRequest::get_tensor(port);
+    OPENVINO_ASSERT(tensor->is_continuous(), "HETERO micro-batches require continuous tensors, port: ", port);
+    auto shape = tensor->get_shape();
+    shape[0] /= m_micro_batches;
+    const auto micro_batch_bytes = tensor->get_byte_size() / m_micro_batches;
+    auto* data = static_cast<uint8_t*>(tensor->data()) + micro_batch * micro_batch_bytes;
+    return {ov::make_tensor(tensor->get_element_type(), shape, data), tensor._so};
+}
+
+std::vector<size_t> ov::hetero::InferRequest::bind_micro_batch_step(size_t step) {
+    std::vector<size_t> active;
+    for (size_t i = 0; i < m_subrequests.size(); i++) {
+        if (step < i || step - i >= m_micro_batches) {
+            continue;
+        }
+        const auto micro_batch = step - i;
+        const auto& request = m_subrequests[i];
+        const auto& compiled_model = request->get_compiled_model();
+        for (size_t port_idx = 0; port_idx < m_micro_batch_inputs[i].size(); port_idx++) {
+            request->set_tensor(compiled_model->inputs()[port_idx],
+                                get_micro_batch_tensor(m_micro_batch_inputs[i][port_idx], micro_batch));
+        }
+        for (size_t port_idx = 0; port_idx < m_micro_batch_outputs[i].size(); port_idx++) {
+            if (m_micro_batch_outputs[i][port_idx].type != MicroBatchBinding::Type::NONE) {
+                request->set_tensor(compiled_model->outputs()[port_idx],
+                                    get_micro_batch_tensor(m_micro_batch_outputs[i][port_idx], micro_batch));
+            }
+        }
+        active.push_back(i);
+    }
+    return active;
+}
+
 ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov::Output<const ov::Node>& port) const {
     auto found_port = find_port(port);
     ov::Output<const ov::Node> internal_port;
@@ -70,6 +177,9 @@ ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov
 }
 
 ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    if (m_micro_batches > 1) {
+        return ov::ISyncInferRequest::get_tensor(port);
+    }
     const auto infer_request = get_request(port);
     auto tensor = infer_request->get_tensor(port);
     if (!tensor._so) {
@@ -80,6 +190,12 @@ ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<con
 
 void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port,
                                           const ov::SoPtr<ov::ITensor>& tensor) {
+    if (m_micro_batches > 1) {
+        OPENVINO_ASSERT(!std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr),
+                        "HETERO micro-batches don't support remote tensors, port: ",
+                        port);
+        return ov::ISyncInferRequest::set_tensor(port, tensor);
+    }
     if (auto remote = std::dynamic_pointer_cast<ov::hetero::RemoteTensor>(tensor._ptr)) {
         auto device_name = get_request(port)->get_compiled_model()->get_context()->get_device_name();
         get_request(port)->set_tensor(port, remote->get_tensor_by_name(device_name));
@@ -90,6 +206,9 @@ void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port
 
 std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
     const ov::Output<const ov::Node>& port) const {
+    if (m_micro_batches > 1) {
+        return ov::ISyncInferRequest::get_tensors(port);
+    }
     const auto infer_request = get_request(port);
     auto tensors = infer_request->get_tensors(port);
     for (auto& tensor : tensors) {
@@ -102,10 +221,14 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
 
 void ov::hetero::InferRequest::set_tensors(const ov::Output<const ov::Node>& port,
                                            const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
+    OPENVINO_ASSERT(m_micro_batches == 1, "HETERO micro-batches don't support batched tensors, port: ", port);
     return get_request(port)->set_tensors(port, tensors);
 }
 
 void ov::hetero::InferRequest::check_tensors() const {
+    if (m_micro_batches > 1) {
+        return ov::ISyncInferRequest::check_tensors();
+    }
     // Ignore `check_tensor` of inputs and outputs of Hetero Compiled Model because
     // `m_tensors` are not allocated
     return;
@@ -125,6 +248,27 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
+    if (m_micro_batches > 1) {
+        for (size_t step = 0; step < micro_batch_steps(); step++) {
+            const auto active = bind_micro_batch_step(step);
+            for (const auto idx : active) {
+                m_subrequests[idx]->set_callback([](std::exception_ptr) {});
+                m_subrequests[idx]->start_async();
+            }
+            std::exception_ptr exception_ptr;
+            for (const auto idx : active) {
+                try {
+                    m_subrequests[idx]->wait();
+                } catch (...) {
+                    exception_ptr = exception_ptr ? exception_ptr : std::current_exception();
+                }
+            }
+            if (exception_ptr) {
+                std::rethrow_exception(exception_ptr);
+            }
+        }
+        return;
+    }
     for (auto&& request : m_subrequests) {
         OPENVINO_ASSERT(request);
         request->infer();
@@ -48,10 +48,35 @@ public:
 private:
     friend class AsyncInferRequest;
 
+    // Tensor of a submodel port for a micro-batch: a view of the model input or output, or a slot of the ring buffer
+    // holding the intermediate micro-batches
+    struct MicroBatchBinding {
+        enum class Type { NONE, INPUT, OUTPUT, BUFFER };
+        Type type = Type::NONE;
+        size_t index = 0;
+    };
+
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
+    void init_micro_batches(const ov::hetero::CompiledModel& compiled_model);
+
+    // Pipeline step `step` runs the subrequest `i` on the micro-batch `step - i`
+    size_t micro_batch_steps() const {
+        return m_micro_batches + m_subrequests.size() - 1;
+    }
+
+    // Binds the micro-batch tensors of the subrequests running at the step and returns their indices
+    std::vector<size_t> bind_micro_batch_step(size_t step);
+
+    ov::SoPtr<ov::ITensor> get_micro_batch_tensor(const MicroBatchBinding& binding, size_t micro_batch) const;
+
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+
+    size_t m_micro_batches = 1;
+    std::vector<std::vector<MicroBatchBinding>> m_micro_batch_inputs;
+    std::vector<std::vector<MicroBatchBinding>> m_micro_batch_outputs;
+    std::vector<std::vector<ov::SoPtr<ov::ITensor>>> m_micro_batch_buffers;
 };
 
 }  // namespace hetero
@@ -1,11 +1,14 @@
 // Copyright (C) 2018-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <cstring>
+
 #include "common_test_utils/test_constants.hpp"
 #include "hetero_tests.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -123,4 +126,36 @@ TEST_F(HeteroTests, get_runtime_model) {
         ASSERT_TRUE(info.count(ov::exec_model_info::OUTPUT_PRECISIONS));
     }
     EXPECT_EQ(0, original_names.size());
-}
\ No newline at end of file
+}
+TEST_F(HeteroTests, infer_with_micro_batches) {
+    auto model = create_model_with_subtract_add(4);
+    auto reference_model =
+        core.compile_model(model, ov::test::utils::DEVICE_HETERO, ov::device::priorities("MOCK0,MOCK1"));
+    auto compiled_model = core.compile_model(model,
+                                             ov::test::utils::DEVICE_HETERO,
+                                             ov::device::priorities("MOCK0,MOCK1"),
+                                             ov::hetero::micro_batches(2));
+    EXPECT_EQ(2, compiled_model.get_property(ov::hetero::micro_batches));
+    ASSERT_EQ(model->input().get_shape(), compiled_model.input().get_shape());
+    ASSERT_EQ(model->output().get_shape(), compiled_model.output().get_shape());
+
+    auto input_tensor = create_and_fill_tensor(model->input().get_element_type(), model->input().get_shape());
+    auto reference_request = reference_model.create_infer_request();
+    reference_request.set_input_tensor(input_tensor);
+    reference_request.infer();
+    auto reference = reference_request.get_output_tensor();
+
+    auto infer_request = compiled_model.create_infer_request();
+    infer_request.set_input_tensor(input_tensor);
+    infer_request.infer();
+    auto output = infer_request.get_output_tensor();
+    ASSERT_EQ(reference.get_shape(), output.get_shape());
+    EXPECT_EQ(0, std::memcmp(reference.data(), output.data(), reference.get_byte_size()));
+
+    auto async_request = compiled_model.create_infer_request();
+    async_request.set_input_tensor(input_tensor);
+    async_request.start_async();
+    async_request.wait();
+    output = async_request.get_output_tensor();
+    EXPECT_EQ(0, std::memcmp(reference.data(), output.data(), reference.get_byte_size()));
+}
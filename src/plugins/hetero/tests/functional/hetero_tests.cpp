@@ -195,6 +195,25 @@ std::shared_ptr<ov::Model> ov::hetero::tests::HeteroTests::create_model_with_mul
     result->set_friendly_name("res");
     return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
 }
+
+std::shared_ptr<ov::Model> ov::hetero::tests::HeteroTests::create_model_with_subtract_add(size_t batch) {
+    const auto bs = static_cast<int64_t>(batch);
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{bs, 3, 2, 2});
+    param->set_friendly_name("input");
+    auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    const_value->set_friendly_name("const_val");
+    auto add = std::make_shared<ov::opset11::Add>(param, const_value);
+    add->set_friendly_name("add");
+    auto const_value2 = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {3});
+    const_value2->set_friendly_name("const_val2");
+    auto subtract = std::make_shared<ov::opset11::Subtract>(add, const_value2);
+    subtract->set_friendly_name("sub");
+    auto add2 = std::make_shared<ov::opset11::Add>(subtract, add);
+    add2->set_friendly_name("add2");
+    auto result = std::make_shared<ov::opset11::Result>(add2);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
 // Mock plugins
 
 class MockCompiledModel : public ov::ICompiledModel {
@@ -4,13 +4,16 @@
 
 #include "async_infer_request.h"
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
+#include "openvino/core/except.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "pipeline_stages.hpp"
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
     const std::shared_ptr<IInferRequest>& request,
@@ -19,7 +22,9 @@ ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
     const bool is_optimized_single_stream)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_internal_request(request) {
-    static_cast<SyncInferRequest*>(request.get())->set_async_request(this);
+    if (auto sync_request = std::dynamic_pointer_cast<SyncInferRequest>(request)) {
+        sync_request->set_async_request(this);
+    }
     m_stream_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(task_executor);
     m_infer_func = [this]() {
         ov::IAsyncInferRequest::infer();
@@ -35,10 +40,9 @@ ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
-    if (m_has_sub_infers) {
-        m_sub_infer_requests.clear();
-    }
+    // the pipeline stages in flight use the sub requests
     stop_and_wait();
+    m_sub_infer_requests.clear();
 }
 
 void ov::intel_cpu::AsyncInferRequest::throw_if_canceled() const {
@@ -50,6 +54,56 @@ void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
     m_sub_infer_requests = requests;
 }
 
+void ov::intel_cpu::AsyncInferRequest::setPipelineStages(const std::vector<PipelineStage>& stages) {
+    OPENVINO_ASSERT(stages.size() == m_sub_infer_requests.size(),
+                    "The number of pipeline stages ",
+                    stages.size(),
+                    " differs from the number of sub requests ",
+                    m_sub_infer_requests.size());
+    m_pipeline_stages = stages;
+    m_pipeline.clear();
+    for (size_t i = 0; i < m_pipeline_stages.size(); i++) {
+        const auto& stage_request = std::static_pointer_cast<AsyncInferRequest>(m_sub_infer_requests[i]);
+        m_pipeline.emplace_back(stage_request->m_stream_executor, [this, i] {
+            infer_pipeline_stage(i);
+        });
+    }
+    // the synchronous inference goes through the stages as well
+    m_sync_pipeline = m_pipeline;
+    m_infer_func = [this]() {
+        ov::IAsyncInferRequest::infer();
+    };
+}
+
+void ov::intel_cpu::AsyncInferRequest::infer_pipeline_stage(size_t stage_idx) {
+    auto stage_request = [this](size_t idx) {
+        return std::static_pointer_cast<AsyncInferRequest>(m_sub_infer_requests[idx])->m_internal_request;
+    };
+    const auto& stage = m_pipeline_stages[stage_idx];
+    const auto request = stage_request(stage_idx);
+    const auto& inputs = request->get_inputs();
+    const auto& outputs = request->get_outputs();
+
+    // the tensors cut between the stages are passed as is, without copying
+    for (size_t i = 0; i < stage.inputs.size(); i++) {
+        const auto& source = stage.inputs[i];
+        if (source.stage == PipelineStage::NO_STAGE) {
+            const auto& input = m_internal_request->get_inputs()[source.index];
+            request->set_tensor(inputs[i], m_internal_request->get_tensor(input));
+        } else {
+            const auto producer = stage_request(source.stage);
+            request->set_tensor(inputs[i], producer->get_tensor(producer->get_outputs()[source.index]));
+        }
+    }
+    for (size_t i = 0; i < stage.outputs.size(); i++) {
+        if (stage.outputs[i] != PipelineStage::NO_OUTPUT) {
+            request->set_tensor(outputs[i],
+                                m_internal_request->get_tensor(m_internal_request->get_outputs()[stage.outputs[i]]));
+        }
+    }
+    request->infer();
+}
+
 void ov::intel_cpu::AsyncInferRequest::infer() {
     m_infer_func();
 }
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <vector>
 
 #include "infer_request.h"
+#include "pipeline_stages.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -36,6 +38,10 @@ public:
         m_has_sub_infers = has_sub_infer;
     }
 
+    // Replaces the pipeline with one task per stage, run by the executor of the stage sub request. The requests in
+    // flight occupy different stages at the same time.
+    void setPipelineStages(const std::vector<PipelineStage>& stages);
+
     void throw_if_canceled() const;
 
     std::vector<std::shared_ptr<ov::IAsyncInferRequest>> m_sub_infer_requests;
@@ -43,6 +49,11 @@ public:
     std::shared_ptr<IInferRequest> m_internal_request;
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor;
     std::function<void()> m_infer_func;
+
+private:
+    void infer_pipeline_stage(size_t stage_idx);
+
+    std::vector<PipelineStage> m_pipeline_stages;
 };
 
 }  // namespace ov::intel_cpu
@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "best_fit_memory_solver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+BestFitMemorySolver::BestFitMemorySolver(std::vector<Box> boxes, std::chrono::microseconds timeLimit)
+    : m_boxes(std::move(boxes)),
+      m_timeLimit(timeLimit) {
+    int maxFinish = 0;
+    for (const auto& box : m_boxes) {
+        maxFinish = std::max(std::max(maxFinish, box.start), box.finish);
+    }
+    for (auto& box : m_boxes) {
+        if (box.finish == -1) {
+            box.finish = maxFinish;
+        }
+    }
+}
+
+int64_t BestFitMemorySolver::place(const std::vector<size_t>& order,
+                                   bool firstFit,
+                                   std::vector<int64_t>& offsets,
+                                   int64_t bestSize,
+                                   const std::chrono::steady_clock::time_point& deadline) const {
+    std::vector<size_t> placed;
+    placed.reserve(order.size());
+    std::vector<std::pair<int64_t, int64_t>> busy;  // {offset, end} of the boxes alive at the same time
+    int64_t totalSize = 0;
+
+    for (const auto idx : order) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return -1;
+        }
+
+        const auto& box = m_boxes[idx];
+        busy.clear();
+        for (const auto other : placed) {
+            const auto& otherBox = m_boxes[other];
+            if (otherBox.start <= box.finish && box.start <= otherBox.finish) {
+                busy.emplace_back(offsets[other], offsets[other] + otherBox.size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // the smallest (or the lowest) gap which fits the box, otherwise on top of the alive boxes
+        int64_t offset = -1;
+        int64_t bestGap = std::numeric_limits<int64_t>::max();
+        int64_t top = 0;
+        for (const auto& [begin, end] : busy) {
+            const auto gap = begin - top;
+            if (gap >= box.size && gap < bestGap) {
+                bestGap = gap;
+                offset = top;
+                if (firstFit) {
+                    break;
+                }
+            }
+            top = std::max(top, end);
+        }
+        if (offset < 0) {
+            offset = top;
+        }
+
+        offsets[idx] = offset;
+        placed.push_back(idx);
+        totalSize = std::max(totalSize, offset + box.size);
+        if (totalSize >= bestSize) {
+            // cannot improve the best placement anymore
+            return -1;
+        }
+    }
+
+    return totalSize;
+}
+
+int64_t BestFitMemorySolver::solve() {
+    using Comparator = std::function<bool(const Box&, const Box&)>;
+    auto lifetime = [](const Box& box) {
+        return static_cast<int64_t>(box.finish - box.start + 1);
+    };
+    const std::vector<Comparator> comparators{
+        [](const Box& l, const Box& r) {
+            return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+        },
+        [&](const Box& l, const Box& r) {
+            return l.size * lifetime(l) > r.size * lifetime(r);
+        },
+        [&](const Box& l, const Box& r) {
+            return lifetime(l) > lifetime(r) || (lifetime(l) == lifetime(r) && l.size > r.size);
+        },
+        [](const Box& l, const Box& r) {
+            return l.start < r.start || (l.start == r.start && l.size > r.size);
+        },
+    };
+
+    const auto deadline = std::chrono::steady_clock::now() + m_timeLimit;
+    m_offsets.clear();
+    m_triedOrders = 0;
+    if (m_boxes.empty()) {
+        return 0;
+    }
+
+    // the greedy solution is the baseline, so the result is never worse than the one of ov::MemorySolver
+    ov::MemorySolver greedy(m_boxes);
+    int64_t bestSize = greedy.solve();
+    std::vector<int64_t> bestOffsets(m_boxes.size());
+    for (size_t i = 0; i < m_boxes.size(); ++i) {
+        bestOffsets[i] = greedy.get_offset(static_cast<int>(m_boxes[i].id));
+    }
+
+    std::vector<int64_t> offsets(m_boxes.size(), 0);
+    std::vector<size_t> order(m_boxes.size());
+    for (const auto& comparator : comparators) {
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            return comparator(m_boxes[l], m_boxes[r]);
+        });
+
+        for (const bool firstFit : {false, true}) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                break;
+            }
+            const auto size = place(order, firstFit, offsets, bestSize, deadline);
+            m_triedOrders++;
+            if (size >= 0 && size < bestSize) {
+                bestSize = size;
+                bestOffsets = offsets;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < m_boxes.size(); ++i) {
+        m_offsets[m_boxes[i].id] = bestOffsets[i];
+    }
+
+    return bestSize;
+}
+
+int64_t BestFitMemorySolver::get_offset(int64_t id) const {
+    auto found = m_offsets.find(id);
+    OPENVINO_ASSERT(found != m_offsets.end(), "There are no box for provided ID");
+    return found->second;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Offline memory solver, an alternative to the greedy ov::MemorySolver with the same interface.
+ *
+ * The solution of the greedy solver is taken as the baseline. Then the boxes are placed one by one into the smallest
+ * (best fit) or the lowest (first fit) gap between the already placed boxes alive at the same time. As the result
+ * depends on the placement order, several orders (by size, by size x lifetime, by lifetime and by start) are tried one
+ * after another while the time limit allows, and the smallest placement is kept. So the result is never worse than the
+ * greedy one, and the time limit bounds only the additional placements.
+ */
+class BestFitMemorySolver {
+public:
+    using Box = ov::MemorySolver::Box;
+
+    explicit BestFitMemorySolver(std::vector<Box> boxes,
+                                 std::chrono::microseconds timeLimit = std::chrono::milliseconds(100));
+
+    /**
+     * @brief Solve memory location
+     * @return Size of common memory blob required for storing all
+     */
+    int64_t solve();
+
+    /**
+     * @brief Provides calculated offset for specified box id
+     */
+    [[nodiscard]] int64_t get_offset(int64_t id) const;
+
+    /**
+     * @brief Number of the placements tried by the last solve call in addition to the greedy one
+     */
+    [[nodiscard]] size_t triedOrders() const {
+        return m_triedOrders;
+    }
+
+private:
+    // returns the required size or -1 if the placement is not better than the best one or the deadline is reached
+    int64_t place(const std::vector<size_t>& order,
+                  bool firstFit,
+                  std::vector<int64_t>& offsets,
+                  int64_t bestSize,
+                  const std::chrono::steady_clock::time_point& deadline) const;
+
+    std::vector<Box> m_boxes;
+    std::chrono::microseconds m_timeLimit;
+    std::unordered_map<int64_t, int64_t> m_offsets;
+    size_t m_triedOrders = 0;
+};
+
+}  // namespace ov::intel_cpu
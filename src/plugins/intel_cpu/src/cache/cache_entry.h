@@ -4,15 +4,57 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "lru_cache.h"
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Lookup counters of a cache. The counters may be shared between several cache entries and updated
+ * concurrently.
+ */
+struct CacheStatistics {
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> evictions{0};
+    // lookups which missed the cache but were served by a value concurrently built by another thread
+    std::atomic<uint64_t> deduplicated{0};
+};
+
+/**
+ * @brief Byte budget of a cache. The budget may be shared between several cache entries and updated concurrently.
+ * Zero limit means the cache has no byte budget.
+ */
+struct CacheBudget {
+    explicit CacheBudget(size_t limit) : limit(limit) {}
+
+    const size_t limit;
+    std::atomic<size_t> used{0};
+};
+
+/**
+ * @brief Returns the number of bytes held by a cached value, which are accounted against the byte budget of the cache.
+ * The values of the types which do not specialize the trait are not accounted.
+ */
+template <typename ValueType>
+struct CacheValueBytes {
+    static size_t get(const ValueType& /*value*/) {
+        return 0;
+    }
+};
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
@@ -25,10 +67,16 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const
+ * KeyType&), pop(), getCapacity() and size() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The records are split into shards by the key hash, each shard is protected by its own mutex, so the entry may
+ * be safely accessed from several threads. Concurrent misses on the same key build the value only once, the other
+ * threads wait for the result.
+ * @note The values accounted by CacheValueBytes are held within the byte budget, when it is set. The budget may be
+ * common for several entries, so the least recently used records of the shard the value is added to are evicted until
+ * the budget is met or only the added record is left.
  */
 
 template <typename KeyType, typename ValType, typename ImplType = LruCache<KeyType, ValType>>
@@ -36,7 +84,27 @@ class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    /**
+     * @param capacity is the maximum number of records stored in the entry
+     * @param numShards is the number of independently locked parts the records are split into
+     * @param statistics is an optional set of counters updated on each lookup
+     * @param budget is an optional byte budget of the accounted values
+     */
+    explicit CacheEntry(size_t capacity,
+                        size_t numShards = 1,
+                        std::shared_ptr<CacheStatistics> statistics = nullptr,
+                        std::shared_ptr<CacheBudget> budget = nullptr)
+        : _capacity(capacity),
+          _statistics(std::move(statistics)),
+          _budget(std::move(budget)) {
+        numShards = std::max<size_t>(1, std::min(numShards, capacity));
+        // rounded down, so the shards together never hold more than the capacity
+        const size_t shardCapacity = capacity / numShards;
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity));
+        }
+    }
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the
@@ -48,24 +116,104 @@ public:
      */
 
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
-        if (0 == _impl.getCapacity()) {
+        if (0 == _capacity) {
             // fast track
+            count(&CacheStatistics::misses);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
-        auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
-        auto retEmpty = ValType();
-        if (retVal == retEmpty) {
-            retStatus = LookUpStatus::Miss;
+
+        auto& shard = *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+        const auto retEmpty = ValType();
+        std::promise<ValType> promise;
+        {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            ValType retVal = shard.impl.get(key);
+            if (retVal != retEmpty) {
+                count(&CacheStatistics::hits);
+                return {retVal, LookUpStatus::Hit};
+            }
+
+            auto inFlightItr = shard.inFlight.find(key);
+            if (inFlightItr != shard.inFlight.end()) {
+                auto future = inFlightItr->second;
+                lock.unlock();
+                count(&CacheStatistics::deduplicated);
+                return {future.get(), LookUpStatus::Hit};
+            }
+            shard.inFlight.emplace(key, promise.get_future().share());
+        }
+
+        count(&CacheStatistics::misses);
+        ValType retVal;
+        try {
             retVal = builder(key);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.inFlight.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
             if (retVal != retEmpty) {
-                _impl.put(key, retVal);
+                // the key is not stored in the shard while its value is being built
+                if (shard.impl.size() == shard.impl.getCapacity()) {
+                    evict(shard);
+                }
+                shard.impl.put(key, retVal);
+                if (_budget) {
+                    _budget->used.fetch_add(CacheValueBytes<ValType>::get(retVal));
+                    while (overBudget() && shard.impl.size() > 1) {
+                        evict(shard);
+                    }
+                }
             }
+            shard.inFlight.erase(key);
+        }
+        promise.set_value(retVal);
+        return {retVal, LookUpStatus::Miss};
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const KeyType& k) const {
+            return k.hash();
+        }
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : impl(capacity) {}
+
+        std::mutex mutex;
+        ImplType impl;
+        std::unordered_map<KeyType, std::shared_future<ValType>, key_hasher> inFlight;
+    };
+
+    void evict(Shard& shard) {
+        const auto record = shard.impl.pop();
+        if (_budget) {
+            _budget->used.fetch_sub(CacheValueBytes<ValType>::get(record.second));
+        }
+        count(&CacheStatistics::evictions);
+    }
+
+    [[nodiscard]] bool overBudget() const {
+        return _budget->limit != 0 && _budget->used.load() > _budget->limit;
+    }
+
+    void count(std::atomic<uint64_t> CacheStatistics::* counter) {
+        if (_statistics) {
+            ((*_statistics).*counter).fetch_add(1, std::memory_order_relaxed);
         }
-        return {retVal, retStatus};
     }
 
-    ImplType _impl;
+    size_t _capacity;
+    std::shared_ptr<CacheStatistics> _statistics;
+    std::shared_ptr<CacheBudget> _budget;
+    std::vector<std::unique_ptr<Shard>> _shards;
 };
 
 }  // namespace ov::intel_cpu
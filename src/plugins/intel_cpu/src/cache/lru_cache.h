@@ -78,6 +78,19 @@ public:
         }
     }
 
+    /**
+     * @brief Removes the least recently used record
+     * @return the removed record
+     * @note the cache must not be empty
+     */
+
+    value_type pop() {
+        auto record = std::move(_lruList.back());
+        _cacheMapper.erase(record.first);
+        _lruList.pop_back();
+        return record;
+    }
+
     /**
      * @brief Returns the current capacity value
      * @return the current capacity value
@@ -86,6 +99,14 @@ public:
         return _capacity;
     }
 
+    /**
+     * @brief Returns the number of records currently stored in the cache
+     * @return the number of stored records
+     */
+    [[nodiscard]] size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key& k) const {
@@ -5,9 +5,54 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "cache/cache_entry.h"
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::MultiCache(const MultiCache& other)
+    : _capacity(other._capacity),
+      _numShards(other._numShards),
+      _statistics(other._statistics),
+      _budget(other._budget),
+      _shared(other._shared) {
+    std::lock_guard<std::mutex> lock(other._storageMutex);
+    _storage = other._storage;
+}
+
+std::map<std::string, uint64_t> MultiCache::getStatistics() const {
+    const auto& budget = _shared ? _shared->_budget : _budget;
+    return {{"hits", _statistics->hits.load()},
+            {"misses", _statistics->misses.load()},
+            {"evictions", _statistics->evictions.load()},
+            {"deduplicated", _statistics->deduplicated.load()},
+            {"bytes", budget->used.load()},
+            {"process_wide", _shared ? 1 : 0}};
+}
+
+std::shared_ptr<MultiCache> MultiCache::getShared(const std::string& name,
+                                              size_t capacity,
+                                              size_t numShards,
+                                              size_t budget) {
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<MultiCache>> caches;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& weakCache = caches[name];
+    auto cache = weakCache.lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(capacity, numShards, budget);
+        weakCache = cache;
+    }
+    return cache;
+}
+
 }  // namespace ov::intel_cpu
@@ -6,18 +6,34 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 
 #include "cache_entry.h"
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Marks the cached value types which may be used by several streams at a time, i.e. the values which are not
+ * modified at execution time and keep no scratch memory of their own. The other values are cached per stream, even
+ * when the streams share a cache.
+ */
+template <typename ValueType>
+struct SharedCacheValue : std::false_type {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The cache may be accessed concurrently. For the caches shared by many streams the number of shards should be
+ * increased to reduce the lock contention.
+ * @note A cache created over a shared one keeps the values marked by SharedCacheValue in the shared cache and all the
+ * other values in its own storage.
  */
 
 class MultiCache {
@@ -30,9 +46,29 @@ public:
 
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param numShards is the number of independently locked parts each entry is split into
+     * @param budget is the limit of the bytes held by the values accounted by CacheValueBytes in all the entries, zero
+     * means no limit
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, size_t numShards = 1, size_t budget = 0)
+        : _capacity(capacity),
+          _numShards(numShards),
+          _statistics(std::make_shared<CacheStatistics>()),
+          _budget(std::make_shared<CacheBudget>(budget)) {}
+
+    /**
+     * @param capacity is the records limit of the entries of the values which are not shared
+     * @param shared is the cache of the values marked by SharedCacheValue, the lookup counters are common with it
+     */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> shared)
+        : _capacity(capacity),
+          _numShards(1),
+          _statistics(shared->_statistics),
+          _budget(std::make_shared<CacheBudget>(0)),
+          _shared(std::move(shared)) {}
+
+    MultiCache(const MultiCache& other);
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,10 +83,36 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
+        if constexpr (SharedCacheValue<ValueType>::value) {
+            if (_shared) {
+                return _shared->getOrCreate(key, std::move(builder));
+            }
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Returns the accumulated lookup counters of all the entries and the bytes held by the accounted values
+     * @return map of the counter name to its value
+     * @note The counters of a cache created over a shared one are common with the shared cache, i.e. they are
+     * accumulated over all the users of the shared cache, which is reported by the "process_wide" value.
+     */
+    [[nodiscard]] std::map<std::string, uint64_t> getStatistics() const;
+
+    /**
+     * @brief Returns the cache shared by all the streams and compiled models in the process. The cache is created on
+     * the first request and released when the last user releases it.
+     * @param name identifies the cache, i.e. several independent shared caches may exist
+     * @param capacity is used only when the cache is created
+     * @param numShards is used only when the cache is created
+     * @param budget is used only when the cache is created
+     */
+    static std::shared_ptr<MultiCache> getShared(const std::string& name,
+                                                 size_t capacity,
+                                                 size_t numShards,
+                                                 size_t budget = 0);
+
 private:
     template <typename T>
     size_t getTypeId();
@@ -59,6 +121,11 @@ private:
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _numShards;
+    std::shared_ptr<CacheStatistics> _statistics;
+    std::shared_ptr<CacheBudget> _budget;
+    std::shared_ptr<MultiCache> _shared;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -72,9 +139,10 @@ template <typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _numShards, _statistics, _budget)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -8,20 +8,26 @@
 #include <cstdint>
 #include <cstring>
 #include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
+#include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
+#include "dynamic_streams_executor.hpp"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
 #include "internal_properties.hpp"
 #include "low_precision/low_precision.hpp"
+#include "memory_control.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -35,6 +41,8 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "packed_weights.hpp"
+#include "pipeline_stages.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -71,6 +79,9 @@ CompiledModel::~CompiledModel() {
     if (streamsExecutor) {
         streamsExecutor->cpu_reset();
     }
+    if (auto wideExecutor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_wide_task_executor)) {
+        wideExecutor->cpu_reset();
+    }
     CPU_DEBUG_CAP_ENABLE(dumpMemoryStats(m_cfg.debugCaps, m_name, m_graphs, m_socketWeights));
 }
 
@@ -78,7 +89,8 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             const PackedWeights::Ptr& packed_weights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
@@ -88,6 +100,18 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     m_runtime_requirements = build_runtime_requirements();
+    if (packed_weights) {
+        m_socketWeights.setPackedWeights(packed_weights);
+    }
+    // with the dynamic streams, the intermediate memory of the idle set of graphs (wide or narrow) is reused by the
+    // other one instead of being doubled
+    if (m_cfg.sharedMemoryArenas || m_cfg.dynamicStreams) {
+        m_memoryArenas = std::make_shared<MemoryArenaPool>();
+    }
+    // the repacked weights of every socket are kept under the budget of the model while it is idle
+    if (m_cfg.weightsCacheBudget > 0) {
+        m_socketWeights.setEvictionBudget(m_cfg.weightsCacheBudget);
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -121,47 +145,67 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
-    int streams = std::max(1, executor_config.get_streams());
-    std::vector<Task> tasks;
-    tasks.resize(streams);
-    m_graphs.resize(streams);
-    if (executor_config.get_streams() != 0) {
-        auto all_graphs_ready = [&] {
-            return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
-                return graph.IsReady();
-            });
-        };
-        do {
-            for (auto&& task : tasks) {
-                task = [this] {
+    const auto& policy = m_cfg.modelDistributionPolicy;
+    if (m_cfg.numSubStreams > 0 && policy.count(ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL) == 0 &&
+        policy.count(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) != 0) {
+        // every stage and its constants are kept by the sub-stream of one socket only
+        m_pipeline_stages = split_model_stages(model, m_cfg.numSubStreams);
+    }
+
+    // the graphs of the pipeline stages are built by the sub compiled models, the whole model never runs as is
+    if (m_pipeline_stages.empty()) {
+        int streams = std::max(1, executor_config.get_streams());
+        std::vector<Task> tasks;
+        tasks.resize(streams);
+        m_graphs.resize(streams);
+        if (executor_config.get_streams() != 0) {
+            auto all_graphs_ready = [&] {
+                return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
+                    return graph.IsReady();
+                });
+            };
+            do {
+                for (auto&& task : tasks) {
+                    task = [this] {
 #if defined(OV_CPU_WITH_ACL)
-                    static std::once_flag flag_once;
-                    std::call_once(flag_once, [&]() {
-                        std::shared_ptr<arm_compute::IScheduler> acl_scheduler = std::make_shared<ACLScheduler>();
-                        arm_compute::Scheduler::set(std::static_pointer_cast<arm_compute::IScheduler>(acl_scheduler));
-                    });
+                        static std::once_flag flag_once;
+                        std::call_once(flag_once, [&]() {
+                            std::shared_ptr<arm_compute::IScheduler> acl_scheduler = std::make_shared<ACLScheduler>();
+                            arm_compute::Scheduler::set(
+                                std::static_pointer_cast<arm_compute::IScheduler>(acl_scheduler));
+                        });
 #endif
-                    CompiledModel::get_graph();
-                };
-            }
-            m_task_executor->run_and_wait(tasks);
-        } while (!all_graphs_ready());
-    } else {
-        CompiledModel::get_graph();
+                        CompiledModel::get_graph();
+                    };
+                }
+                m_task_executor->run_and_wait(tasks);
+            } while (!all_graphs_ready());
+        } else {
+            CompiledModel::get_graph();
+        }
+    }
+    if (m_cfg.dynamicStreams && !m_cfg.exclusiveAsyncRequests && m_cfg.numSubStreams == 0 &&
+        executor_config.get_streams() > 1) {
+        init_dynamic_streams(executor_config);
     }
     if (m_cfg.numSubStreams > 0) {
         m_has_sub_compiled_models = true;
         auto sub_cfg = m_cfg;
         sub_cfg.numSubStreams = 0;
-        sub_cfg.enableNodeSplit = true;
         auto streams_info_table = m_cfg.streamExecutorConfig.get_streams_info_table();
-        auto message = message_manager();
         m_sub_memory_manager = std::make_shared<SubMemoryManager>(m_cfg.numSubStreams);
-        message->set_num_sub_streams(m_cfg.numSubStreams);
-        for (int i = 0; i < m_cfg.numSubStreams; i++) {
+        if (m_pipeline_stages.empty()) {
+            sub_cfg.enableNodeSplit = true;
+            message_manager()->set_num_sub_streams(m_cfg.numSubStreams);
+        }
+        const auto num_sub_models =
+            m_pipeline_stages.empty() ? m_cfg.numSubStreams : static_cast<int>(m_pipeline_stages.size());
+        for (int i = 0; i < num_sub_models; i++) {
             std::vector<std::vector<int>> sub_streams_table;
             sub_streams_table.push_back(streams_info_table[i + 1]);
             sub_streams_table[0][NUMBER_OF_STREAMS] = 1;
+            // the pipeline stages don't communicate with each other, so they have no rank
+            auto rank = m_pipeline_stages.empty() ? sub_cfg.streamsRankTable[i] : std::vector<int>{};
             sub_cfg.streamExecutorConfig = IStreamsExecutor::Config{"CPUStreamsExecutor",
                                                                     1,
                                                                     1,
@@ -170,32 +214,80 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                     true,
                                                                     true,
                                                                     std::move(sub_streams_table),
-                                                                    sub_cfg.streamsRankTable[i]};
-            m_sub_compiled_models.push_back(
-                std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
+                                                                    std::move(rank)};
+            const auto& sub_model = m_pipeline_stages.empty() ? model : m_pipeline_stages[i].model;
+            m_sub_compiled_models.push_back(std::make_shared<CompiledModel>(sub_model,
+                                                                            plugin,
+                                                                            sub_cfg,
+                                                                            loaded_from_cache,
+                                                                            m_sub_memory_manager,
+                                                                            packed_weights));
+        }
+    }
+}
+
+void CompiledModel::init_dynamic_streams(const IStreamsExecutor::Config& narrow_config) {
+    // one wide stream per socket used by the narrow streams, so the wide streams do not cross the sockets
+    std::set<int> sockets;
+    for (const auto& row : narrow_config.get_streams_info_table()) {
+        if (row[NUMBER_OF_STREAMS] != 0) {
+            sockets.insert(row[STREAM_SOCKET_ID]);
         }
     }
+    const int wide_streams = std::max(1, static_cast<int>(sockets.size()));
+    auto narrow_executor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+    if (wide_streams >= narrow_config.get_streams() || !narrow_executor) {
+        return;
+    }
+    auto wide_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
+        IStreamsExecutor::Config{"CPUWideStreamsExecutor",
+                                 wide_streams,
+                                 std::max(1, narrow_config.get_threads() / wide_streams),
+                                 ov::hint::SchedulingCoreType::ANY_CORE,
+                                 false,
+                                 narrow_config.get_cpu_pinning()});
+    m_wide_task_executor = wide_executor;
+    // the load has to stay low for as many inferences as the narrow streams before the cores are regrouped back
+    m_dynamic_streams = std::make_shared<DynamicStreamsExecutor>(std::move(narrow_executor),
+                                                                 std::move(wide_executor),
+                                                                 wide_streams,
+                                                                 narrow_config.get_streams());
+    m_wide_graphs.resize(wide_streams);
+    std::vector<Task> tasks(wide_streams, [this] {
+        CompiledModel::get_graph();
+    });
+    do {
+        m_dynamic_streams->run_wide_and_wait(tasks);
+    } while (!std::all_of(m_wide_graphs.begin(), m_wide_graphs.end(), [](Graph& graph) {
+        return graph.IsReady();
+    }));
+    set_task_executor(m_dynamic_streams);
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     int streamId = 0;
     int socketId = 0;
 
+    // the inferences dispatched to the wide streams use the graphs created for the wide streams
+    const bool wide = m_dynamic_streams && m_dynamic_streams->runs_wide_stream();
+    auto& graphs = wide ? m_wide_graphs : m_graphs;
+    const auto& task_executor = wide ? m_wide_task_executor : m_task_executor;
+
     size_t graph_idx = 0;
-    if (m_graphs.size() > 1) {
-        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+    if (graphs.size() > 1) {
+        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(task_executor);
         if (nullptr != streamsExecutor) {
             streamId = streamsExecutor->get_stream_id();
             socketId = std::max(0, streamsExecutor->get_socket_id());
         }
-        graph_idx = streamId % m_graphs.size();
+        graph_idx = streamId % graphs.size();
     }
 
-    auto graphLock = GraphGuard::Lock(m_graphs[graph_idx]);
+    auto graphLock = GraphGuard::Lock(graphs[graph_idx]);
 
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
-        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(task_executor);
         auto makeGraph = [&] {
             try {
                 GraphContext::Ptr ctx;
@@ -209,7 +301,8 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_memoryArenas);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -232,6 +325,9 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
 }
 
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
+    if (!m_pipeline_stages.empty()) {
+        return std::make_shared<PipelineInferRequest>(shared_from_this());
+    }
     return std::make_shared<SyncInferRequest>(
         CompiledModelHolder(std::static_pointer_cast<const CompiledModel>(shared_from_this())));
 }
@@ -239,7 +335,7 @@ std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request(
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     auto internal_request = create_sync_infer_request();
     auto async_infer_request =
-        std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
+        std::make_shared<AsyncInferRequest>(internal_request,
                                             get_task_executor(),
                                             get_callback_executor(),
                                             m_optimized_single_stream);
@@ -250,34 +346,80 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
             requests.push_back(model->create_infer_request());
         }
         async_infer_request->setSubInferRequest(requests);
-        async_infer_request->setSubInfer(true);
+        if (m_pipeline_stages.empty()) {
+            async_infer_request->setSubInfer(true);
+        } else {
+            std::static_pointer_cast<PipelineInferRequest>(internal_request)->setStageRequests(requests);
+            async_infer_request->setPipelineStages(m_pipeline_stages);
+        }
     }
     return async_infer_request;
 }
 
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
+    if (!m_pipeline_stages.empty()) {
+        // the runtime models of the stages side by side
+        ov::ResultVector results;
+        ov::ParameterVector parameters;
+        for (const auto& sub_model : m_sub_compiled_models) {
+            const auto stage = sub_model->get_runtime_model();
+            results.insert(results.end(), stage->get_results().begin(), stage->get_results().end());
+            parameters.insert(parameters.end(), stage->get_parameters().begin(), stage->get_parameters().end());
+        }
+        return std::make_shared<ov::Model>(results, parameters, m_name);
+    }
     OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
 
     return get_graph()._graph.dump();
 }
 
 ov::Any CompiledModel::get_property(const std::string& name) const {
-    OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
-
     if (name == ov::loaded_from_cache) {
         return m_loaded_from_cache;
     }
 
-    Config engConfig = get_graph()._graph.getConfig();
-    auto option = engConfig._config.find(name);
-    if (option != engConfig._config.end()) {
+    // the model split into the pipeline stages has no graph of its own, the statistics of the graphs are collected
+    // from the stages
+    std::optional<GraphGuard::Lock> graphLock;
+    if (m_pipeline_stages.empty()) {
+        OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
+        graphLock.emplace(get_graph());
+    }
+    // @todo Can't we just use local copy (_cfg) instead?
+    const auto& config = graphLock ? graphLock->_graph.getConfig() : m_cfg;
+    auto option = config._config.find(name);
+    if (option != config._config.end()) {
         return option->second;
     }
 
-    // @todo Can't we just use local copy (_cfg) instead?
-    auto graphLock = get_graph();
-    const auto& graph = graphLock._graph;
-    const auto& config = graph.getConfig();
+    auto stages_statistics = [&](const std::string& property) {
+        std::map<std::string, uint64_t> statistics;
+        for (const auto& sub_model : m_sub_compiled_models) {
+            for (const auto& [key, value] : sub_model->get_property(property).as<std::map<std::string, uint64_t>>()) {
+                statistics[key] += value;
+            }
+        }
+        return statistics;
+    };
+
+    // the statistics kept per graph are summed up over the graphs of all the streams
+    auto graphs_statistics = [&](const auto& get_statistics) {
+        // the graphs are locked one by one below
+        graphLock.reset();
+        std::map<std::string, uint64_t> statistics;
+        for (auto* graphs : {&m_graphs, &m_wide_graphs}) {
+            for (auto&& graph : *graphs) {
+                GraphGuard::Lock lock(graph);
+                if (!graph.IsReady()) {
+                    continue;
+                }
+                for (const auto& [key, value] : get_statistics(*graph.getGraphContext())) {
+                    statistics[key] += value;
+                }
+            }
+        }
+        return statistics;
+    };
 
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
@@ -312,16 +454,37 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::value_cache_precision.name()),
             RO_property(ov::key_cache_group_size.name()),
             RO_property(ov::value_cache_group_size.name()),
-            RO_property(ov::runtime_requirements.name())};
+            RO_property(ov::runtime_requirements.name()),
+            RO_property(ov::intel_cpu::cpu_shared_runtime_cache.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_budget.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_cache_packed_weights.name()),
+            RO_property(ov::intel_cpu::cpu_weights_cache_budget.name()),
+            RO_property(ov::intel_cpu::cpu_weights_cache_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_shape_buckets.name()),
+            RO_property(ov::intel_cpu::cpu_shape_buckets_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_shared_memory_arenas.name()),
+            RO_property(ov::intel_cpu::memory_solver.name()),
+            RO_property(ov::intel_cpu::cpu_memory_arenas_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_dynamic_streams.name()),
+            RO_property(ov::intel_cpu::cpu_dynamic_streams_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_kv_cache_offload_dir.name()),
+            RO_property(ov::intel_cpu::cpu_kv_cache_hot_tokens.name()),
+            RO_property(ov::intel_cpu::cpu_kv_cache_offload_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_llm_fusion_without_amx.name())};
 
         return ro_properties;
     }
 
     if (name == ov::model_name) {
-        std::string modelName = graph.GetName();
+        std::string modelName = graphLock ? graphLock->_graph.GetName() : m_name;
         return decltype(ov::model_name)::value_type(modelName);
     }
     if (name == ov::optimal_number_of_infer_requests) {
+        if (!m_pipeline_stages.empty()) {
+            // one request in flight per stage keeps all the sockets busy
+            return static_cast<decltype(ov::optimal_number_of_infer_requests)::value_type>(m_pipeline_stages.size());
+        }
         const auto streams = config.streamExecutorConfig.get_streams();
         return static_cast<decltype(ov::optimal_number_of_infer_requests)::value_type>(
             streams > 0 ? streams : 1);  // ov::optimal_number_of_infer_requests has no negative values
@@ -417,6 +580,76 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::runtime_requirements) {
         return static_cast<decltype(ov::runtime_requirements)::value_type>(m_runtime_requirements);
     }
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type(
+            graphLock ? graphLock->_graph.getGraphContext()->getParamsCache()->getStatistics()
+                      : stages_statistics(name));
+    }
+    if (name == ov::intel_cpu::cpu_shared_runtime_cache) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shared_runtime_cache)::value_type>(m_cfg.sharedRuntimeCache);
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_budget) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_budget)::value_type>(m_cfg.runtimeCacheBudget);
+    }
+    if (name == ov::intel_cpu::cpu_cache_packed_weights) {
+        return static_cast<decltype(ov::intel_cpu::cpu_cache_packed_weights)::value_type>(m_cfg.cachePackedWeights);
+    }
+    if (name == ov::intel_cpu::cpu_weights_cache_budget) {
+        return static_cast<decltype(ov::intel_cpu::cpu_weights_cache_budget)::value_type>(m_cfg.weightsCacheBudget);
+    }
+    if (name == ov::intel_cpu::cpu_weights_cache_statistics) {
+        return decltype(ov::intel_cpu::cpu_weights_cache_statistics)::value_type(
+            m_socketWeights.getEvictionStatistics());
+    }
+    if (name == ov::intel_cpu::cpu_shape_buckets) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shape_buckets)::value_type>(m_cfg.shapeBuckets);
+    }
+    if (name == ov::intel_cpu::cpu_shape_buckets_statistics) {
+        if (!graphLock) {
+            return decltype(ov::intel_cpu::cpu_shape_buckets_statistics)::value_type(stages_statistics(name));
+        }
+        return decltype(ov::intel_cpu::cpu_shape_buckets_statistics)::value_type(
+            graphs_statistics([](const GraphContext& context) {
+                return context.getAuxiliaryNetworkMemoryControl()->getShapeBucketsStatistics();
+            }));
+    }
+    if (name == ov::intel_cpu::cpu_shared_memory_arenas) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shared_memory_arenas)::value_type>(m_cfg.sharedMemoryArenas);
+    }
+    if (name == ov::intel_cpu::memory_solver) {
+        return static_cast<decltype(ov::intel_cpu::memory_solver)::value_type>(m_cfg.memorySolver);
+    }
+    if (name == ov::intel_cpu::cpu_memory_arenas_statistics) {
+        return decltype(ov::intel_cpu::cpu_memory_arenas_statistics)::value_type(
+            m_memoryArenas ? m_memoryArenas->getStatistics() : std::map<std::string, uint64_t>{});
+    }
+    if (name == ov::intel_cpu::cpu_dynamic_streams) {
+        return static_cast<decltype(ov::intel_cpu::cpu_dynamic_streams)::value_type>(m_dynamic_streams != nullptr);
+    }
+    if (name == ov::intel_cpu::cpu_dynamic_streams_statistics) {
+        return decltype(ov::intel_cpu::cpu_dynamic_streams_statistics)::value_type(
+            m_dynamic_streams ? m_dynamic_streams->get_statistics() : std::map<std::string, uint64_t>{});
+    }
+    if (name == ov::intel_cpu::cpu_kv_cache_offload_dir) {
+        return decltype(ov::intel_cpu::cpu_kv_cache_offload_dir)::value_type(m_cfg.kvCacheOffloadDir);
+    }
+    if (name == ov::intel_cpu::cpu_kv_cache_hot_tokens) {
+        return static_cast<decltype(ov::intel_cpu::cpu_kv_cache_hot_tokens)::value_type>(m_cfg.kvCacheHotTokens);
+    }
+    if (name == ov::intel_cpu::cpu_llm_fusion_without_amx) {
+        return static_cast<decltype(ov::intel_cpu::cpu_llm_fusion_without_amx)::value_type>(m_cfg.llmFusionWithoutAmx);
+    }
+    if (name == ov::intel_cpu::cpu_kv_cache_offload_statistics) {
+        if (!graphLock) {
+            return decltype(ov::intel_cpu::cpu_kv_cache_offload_statistics)::value_type(stages_statistics(name));
+        }
+        // every stream offloads the caches of its own graph
+        const auto statistics = graphs_statistics([](const GraphContext& context) {
+            const auto& offload = context.getKVCacheOffload();
+            return offload ? offload->getStatistics() : std::map<std::string, uint64_t>{};
+        });
+        return decltype(ov::intel_cpu::cpu_kv_cache_offload_statistics)::value_type(statistics);
+    }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
@@ -431,19 +664,27 @@ static void write_header(std::ostream& modelStream, const std::string& runtime_r
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
     write_header(modelStream, m_runtime_requirements);
+    // the model imported with the repacked weights keeps them on export, even if the property is not set again
+    if ((m_cfg.cachePackedWeights || m_socketWeights.hasPackedWeights()) &&
+        m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SPEED) {
+        // the repacked weights depend on the isa, so they are stored along with the runtime requirements
+        PackedWeights::write(modelStream, m_runtime_requirements, m_socketWeights.getPacked());
+    }
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
     serializer << m_model;
 }
 
 void CompiledModel::release_memory() {
-    for (auto&& graph : m_graphs) {
-        // try to lock mutex, since it may be already locked (e.g by an infer request)
-        std::unique_lock<std::mutex> lock(graph._mutex, std::try_to_lock);
-        OPENVINO_ASSERT(lock.owns_lock(),
-                        "Attempt to call release_memory() on a compiled model in a busy state. Please ensure that all "
-                        "infer requests are completed before releasing memory.");
-        auto ctx = graph.getGraphContext();
-        ctx->releaseMemory();
+    for (auto* graphs : {&m_graphs, &m_wide_graphs}) {
+        for (auto&& graph : *graphs) {
+            // try to lock mutex, since it may be already locked (e.g by an infer request)
+            std::unique_lock<std::mutex> lock(graph._mutex, std::try_to_lock);
+            OPENVINO_ASSERT(lock.owns_lock(),
+                            "Attempt to call release_memory() on a compiled model in a busy state. Please ensure that "
+                            "all infer requests are completed before releasing memory.");
+            auto ctx = graph.getGraphContext();
+            ctx->releaseMemory();
+        }
     }
 }
 
@@ -14,7 +14,9 @@
 #include <vector>
 
 #include "config.h"
+#include "dynamic_streams_executor.hpp"
 #include "graph.h"
+#include "memory_control.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -22,7 +24,10 @@
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "packed_weights.hpp"
+#include "pipeline_stages.hpp"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
 
@@ -44,7 +49,8 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  const PackedWeights::Ptr& packed_weights = nullptr);
 
     ~CompiledModel() override;
 
@@ -87,6 +93,12 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // intermediate memory shared by the graphs of all the streams, if enabled
+    MemoryArenaPool::Ptr m_memoryArenas;
+    // CPU_DYNAMIC_STREAMS: the wide streams and their graphs, the graphs of both executors are kept between switches
+    std::shared_ptr<ov::threading::ITaskExecutor> m_wide_task_executor = nullptr;
+    mutable std::deque<GraphGuard> m_wide_graphs;
+    DynamicStreamsExecutor::Ptr m_dynamic_streams = nullptr;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,12 +106,17 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    // creates the wide streams executor and its graphs for CPU_DYNAMIC_STREAMS
+    void init_dynamic_streams(const ov::threading::IStreamsExecutor::Config& narrow_config);
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
 
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
+    // stages run by the sub compiled models with MODEL_DISTRIBUTION_POLICY=PIPELINE_PARALLEL
+    std::vector<PipelineStage> m_pipeline_stages;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
     std::string m_runtime_requirements;
@@ -155,12 +155,14 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                "for property key ",
                                ov::hint::model_distribution_policy.name(),
-                               ". CPU plugin only support {ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL}");
+                               ". CPU plugin only support {ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL, "
+                               "ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL}");
             };
 
             try {
                 for (const auto& row : val.as<std::set<ov::hint::ModelDistributionPolicy>>()) {
-                    if ((row != ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL)) {
+                    if ((row != ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL) &&
+                        (row != ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL)) {
                         error_info();
                     }
                 }
@@ -285,6 +287,24 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_shared_runtime_cache.name() == key) {
+            try {
+                sharedRuntimeCache = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shared_runtime_cache.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_runtime_cache_budget.name() == key) {
+            try {
+                runtimeCacheBudget = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -495,6 +515,90 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::cpu_cache_packed_weights.name()) {
+            try {
+                cachePackedWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_cache_packed_weights.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::cpu_weights_cache_budget.name()) {
+            try {
+                weightsCacheBudget = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_weights_cache_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::cpu_shape_buckets.name()) {
+            try {
+                shapeBuckets = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_buckets.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::cpu_shared_memory_arenas.name()) {
+            try {
+                sharedMemoryArenas = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shared_memory_arenas.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::cpu_dynamic_streams.name()) {
+            try {
+                dynamicStreams = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_dynamic_streams.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::cpu_kv_cache_offload_dir.name()) {
+            try {
+                kvCacheOffloadDir = val.as<std::string>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_kv_cache_offload_dir.name(),
+                               ". Expected a directory path");
+            }
+        } else if (key == ov::intel_cpu::cpu_kv_cache_hot_tokens.name()) {
+            try {
+                kvCacheHotTokens = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_kv_cache_hot_tokens.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::cpu_llm_fusion_without_amx.name()) {
+            try {
+                llmFusionWithoutAmx = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_llm_fusion_without_amx.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::memory_solver.name()) {
+            try {
+                memorySolver = val.as<ov::intel_cpu::MemorySolverType>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::memory_solver.name(),
+                               ". Expected values: ov::intel_cpu::MemorySolverType::GREEDY/BEST_FIT");
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
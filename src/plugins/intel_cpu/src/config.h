@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -75,6 +76,8 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool sharedRuntimeCache = false;
+    uint64_t runtimeCacheBudget = 0;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -150,6 +153,15 @@ struct Config {
 
     ov::CacheMode m_cache_mode = ov::CacheMode::OPTIMIZE_SPEED;
     bool enableWeightless = false;
+    bool cachePackedWeights = false;
+    uint64_t weightsCacheBudget = 0;
+    bool shapeBuckets = false;
+    bool sharedMemoryArenas = false;
+    bool dynamicStreams = false;
+    std::string kvCacheOffloadDir;
+    uint64_t kvCacheHotTokens = 4096;
+    bool llmFusionWithoutAmx = false;
+    ov::intel_cpu::MemorySolverType memorySolver = ov::intel_cpu::MemorySolverType::GREEDY;
 
 #ifdef CPU_DEBUG_CAPS
     DebugCapsConfig debugCaps;
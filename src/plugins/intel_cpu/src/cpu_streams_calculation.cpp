@@ -592,6 +592,13 @@ struct StreamsInfoBuilder {
                hint_model_distribution_policy.end();
     }
 
+    // both distribution policies run one sub-stream per socket
+    [[nodiscard]] bool has_socket_distribution_policy() const {
+        return has_tensor_parallel_policy() ||
+               hint_model_distribution_policy.find(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) !=
+                   hint_model_distribution_policy.end();
+    }
+
     [[nodiscard]] bool is_latency_mode() const {
         return ((!input_streams_changed) &&
                 (input_perf_hint == ov::util::to_string(ov::hint::PerformanceMode::LATENCY))) ||
@@ -698,7 +705,7 @@ struct StreamsInfoBuilder {
 
         if (input_threads > 0) {
             handle_latency_with_explicit_threads();
-        } else if (has_tensor_parallel_policy() || (proc_type_table.size() == 1)) {
+        } else if (has_socket_distribution_policy() || (proc_type_table.size() == 1)) {
             handle_latency_tensor_parallel_or_single_socket();
         } else {
             handle_latency_multi_socket();
@@ -964,7 +971,7 @@ struct StreamsInfoBuilder {
         }
 
         if ((total_streams == 1) && (proc_type_table.size() == 1) && enable_tensor_parallel &&
-            has_tensor_parallel_policy()) {
+            has_socket_distribution_policy()) {
             streams_info_table.push_back(streams_info_table[0]);
             streams_info_table.push_back(streams_info_table[0]);
             streams_info_table[0][THREADS_PER_STREAM] = streams_info_table[0][THREADS_PER_STREAM] * 2;
@@ -1012,7 +1019,8 @@ struct StreamsInfoBuilder {
         int total_streams = n_streams;
 
         if (stream_info[PROC_TYPE] == INIT_VAL) {
-            bool is_multi_socket_tp = (n_streams == 1) && (proc_type_table.size() > 1) && has_tensor_parallel_policy();
+            bool is_multi_socket_tp =
+                (n_streams == 1) && (proc_type_table.size() > 1) && has_socket_distribution_policy();
 
             if (is_multi_socket_tp) {
                 populate_table_tensor_parallel();
@@ -1425,8 +1433,7 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
     config.tbbPartitioner =
         config.tbbPartitioner == TbbPartitioner::NONE ? TbbPartitioner::STATIC : config.tbbPartitioner;
     OPENVINO_ASSERT(!streams_info_table.empty(), "streams_info_table is empty!");
-    if (config.modelDistributionPolicy.find(ov::hint::ModelDistributionPolicy::TENSOR_PARALLEL) !=
-        config.modelDistributionPolicy.end()) {
+    if (!config.modelDistributionPolicy.empty()) {
         config.streamsRankTable =
             get_streams_rank_table(streams_info_table, config.streamsRankLevel, config.numSubStreams);
     }
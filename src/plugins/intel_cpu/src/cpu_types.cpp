@@ -260,6 +260,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"EmbeddingBagOffsets", Type::EmbeddingBagOffsets},
         {"LLMMLP", Type::LLMMLP},
         {"QKVProjection", Type::QKVProjection},
+        {"LMHeadSampling", Type::LMHeadSampling},
         {"RMS", Type::RMS},
         {"SearchSorted", Type::SearchSorted},
         {"LoraSubgraph", Type::LoRA},
@@ -399,6 +400,7 @@ std::string NameFromType(const Type type) {
         CASE(CausalMaskPreprocess);
         CASE(LLMMLP);
         CASE(QKVProjection);
+        CASE(LMHeadSampling);
         CASE(RMS);
         CASE(SearchSorted);
         CASE(SegmentMax);
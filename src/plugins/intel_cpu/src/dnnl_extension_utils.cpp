@@ -310,4 +310,10 @@ std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<c
     return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
 }
 
+std::string DnnlExtensionUtils::computeWeightsPersistentKey(const std::string& sourceName,
+                                                            const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    const auto desc_hash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+    return sourceName + "_" + std::to_string(desc_hash);
+}
+
 }  // namespace ov::intel_cpu
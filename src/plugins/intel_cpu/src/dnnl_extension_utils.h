@@ -130,6 +130,16 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes weights key which is stable between processes, so it can be used to store the repacked weights
+     * in the model cache
+     * @param sourceName identity of the original weights constant, see WeightsSharing::registerSource
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return string key
+     */
+    static std::string computeWeightsPersistentKey(const std::string& sourceName,
+                                                   const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_streams_executor.hpp"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+// the dynamic streams executor which dispatched the inference executed by the current thread to its wide executor
+thread_local const DynamicStreamsExecutor* t_wide_stream_owner = nullptr;
+
+// sets the owner of the wide stream run by the current thread (nullptr for a narrow stream) for the lifetime of the
+// guard, the previous owner is restored also when the task throws
+class WideStreamOwnerGuard {
+public:
+    explicit WideStreamOwnerGuard(const DynamicStreamsExecutor* owner) : m_previous(t_wide_stream_owner) {
+        t_wide_stream_owner = owner;
+    }
+    ~WideStreamOwnerGuard() {
+        t_wide_stream_owner = m_previous;
+    }
+    WideStreamOwnerGuard(const WideStreamOwnerGuard&) = delete;
+    WideStreamOwnerGuard& operator=(const WideStreamOwnerGuard&) = delete;
+
+private:
+    const DynamicStreamsExecutor* m_previous;
+};
+}  // namespace
+
+DynamicStreamsExecutor::DynamicStreamsExecutor(std::shared_ptr<ov::threading::IStreamsExecutor> narrow_executor,
+                                               std::shared_ptr<ov::threading::IStreamsExecutor> wide_executor,
+                                               int wide_streams,
+                                               int switch_to_wide)
+    : m_narrow_executor(std::move(narrow_executor)),
+      m_wide_executor(std::move(wide_executor)),
+      m_wide_streams(wide_streams),
+      m_switch_to_wide(switch_to_wide) {
+    OPENVINO_ASSERT(m_narrow_executor && m_wide_executor, "Both narrow and wide executors are required");
+    OPENVINO_ASSERT(m_wide_streams > 0, "The number of wide streams must be positive");
+}
+
+bool DynamicStreamsExecutor::dispatch() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const int in_flight = m_wide_in_flight + m_narrow_in_flight + 1;
+    if (in_flight > m_wide_streams) {
+        // the inferences queue up on the wide streams, regroup the cores into the narrow ones right away
+        m_low_load_dispatches = 0;
+        if (m_wide) {
+            m_wide = false;
+            m_switches++;
+        }
+    } else if (!m_wide && ++m_low_load_dispatches >= m_switch_to_wide && m_narrow_in_flight == 0) {
+        // the narrow streams are idle, so the wide ones do not compete with them for the cores
+        m_wide = true;
+        m_switches++;
+    }
+    if (m_wide) {
+        m_wide_in_flight++;
+        m_wide_inferences++;
+    } else {
+        m_narrow_in_flight++;
+        m_narrow_inferences++;
+    }
+    return m_wide;
+}
+
+ov::threading::Task DynamicStreamsExecutor::wrap(ov::threading::Task task, bool wide) {
+    return [this, wide, task = std::move(task)] {
+        // a failed inference completes as well, otherwise it would stay in flight and block the switch to wide streams
+        struct InFlightGuard {
+            DynamicStreamsExecutor* executor;
+            const bool wide;
+            ~InFlightGuard() {
+                executor->complete(wide);
+            }
+        } in_flight{this, wide};
+        WideStreamOwnerGuard owner(wide ? this : nullptr);
+        task();
+    };
+}
+
+void DynamicStreamsExecutor::complete(bool wide) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (wide) {
+        m_wide_in_flight--;
+    } else {
+        m_narrow_in_flight--;
+    }
+}
+
+void DynamicStreamsExecutor::run(ov::threading::Task task) {
+    const bool wide = dispatch();
+    (wide ? m_wide_executor : m_narrow_executor)->run(wrap(std::move(task), wide));
+}
+
+void DynamicStreamsExecutor::run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) {
+    const bool wide = dispatch();
+    (wide ? m_wide_executor : m_narrow_executor)->run_with_priority(wrap(std::move(task), wide), priority);
+}
+
+void DynamicStreamsExecutor::execute(ov::threading::Task task) {
+    // the task runs by the calling thread, but within the stream constraints (arena, pinning) of the selected executor
+    const bool wide = dispatch();
+    (wide ? m_wide_executor : m_narrow_executor)->execute(wrap(std::move(task), wide));
+}
+
+const std::shared_ptr<ov::threading::IStreamsExecutor>& DynamicStreamsExecutor::current() const {
+    return runs_wide_stream() ? m_wide_executor : m_narrow_executor;
+}
+
+int DynamicStreamsExecutor::get_stream_id() {
+    return current()->get_stream_id();
+}
+
+int DynamicStreamsExecutor::get_streams_num() {
+    return m_narrow_executor->get_streams_num();
+}
+
+int DynamicStreamsExecutor::get_numa_node_id() {
+    return current()->get_numa_node_id();
+}
+
+int DynamicStreamsExecutor::get_socket_id() {
+    return current()->get_socket_id();
+}
+
+std::vector<int> DynamicStreamsExecutor::get_rank() {
+    return current()->get_rank();
+}
+
+void DynamicStreamsExecutor::cpu_reset() {
+    m_narrow_executor->cpu_reset();
+    m_wide_executor->cpu_reset();
+}
+
+void DynamicStreamsExecutor::run_wide_and_wait(const std::vector<ov::threading::Task>& tasks) {
+    std::vector<ov::threading::Task> wide_tasks;
+    wide_tasks.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        wide_tasks.emplace_back([this, task] {
+            WideStreamOwnerGuard owner(this);
+            task();
+        });
+    }
+    m_wide_executor->run_and_wait(wide_tasks);
+}
+
+bool DynamicStreamsExecutor::runs_wide_stream() const {
+    return t_wide_stream_owner == this;
+}
+
+std::map<std::string, uint64_t> DynamicStreamsExecutor::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {{"wide_inferences", m_wide_inferences},
+            {"narrow_inferences", m_narrow_inferences},
+            {"switches", m_switches}};
+}
+
+}  // namespace ov::intel_cpu
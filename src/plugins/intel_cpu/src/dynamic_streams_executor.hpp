@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Task executor of the compiled model with CPU_DYNAMIC_STREAMS enabled.
+ *
+ * Dispatches the inferences either to the narrow executor (the streams computed from the hints) or to the wide
+ * executor (a few streams, each one using the threads of several narrow streams). The wide streams are used while
+ * the number of the inferences in flight does not exceed the number of the wide streams, the narrow streams are used
+ * as soon as the inferences start queuing. Each inference completes on the executor it was dispatched to, so the
+ * switch to the narrow streams does not wait for the inferences in flight. The switch back to the wide streams is
+ * done only when no inference runs on the narrow streams, since both executors use the same cores.
+ *
+ * The stream queries (stream, NUMA node and socket ids, rank) and `execute` are forwarded to the executor which runs
+ * the current inference, the priority of the task is passed to the executor it is dispatched to.
+ */
+class DynamicStreamsExecutor : public ov::threading::IStreamsExecutor {
+public:
+    using Ptr = std::shared_ptr<DynamicStreamsExecutor>;
+
+    /**
+     * @param narrow_executor executor with the streams computed from the hints
+     * @param wide_executor executor with fewer, wider streams
+     * @param wide_streams number of the streams of the wide executor
+     * @param switch_to_wide number of the consecutive inferences dispatched with at most `wide_streams` inferences in
+     * flight, after which the wide streams are used again. Prevents switching back and forth on the load bursts.
+     */
+    DynamicStreamsExecutor(std::shared_ptr<ov::threading::IStreamsExecutor> narrow_executor,
+                           std::shared_ptr<ov::threading::IStreamsExecutor> wide_executor,
+                           int wide_streams,
+                           int switch_to_wide);
+
+    void run(ov::threading::Task task) override;
+    void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override;
+    void execute(ov::threading::Task task) override;
+
+    int get_stream_id() override;
+    int get_streams_num() override;
+    int get_numa_node_id() override;
+    int get_socket_id() override;
+    std::vector<int> get_rank() override;
+    void cpu_reset() override;
+
+    // runs the tasks by the wide executor regardless of the load, e.g. to initialize the graphs of the wide streams
+    void run_wide_and_wait(const std::vector<ov::threading::Task>& tasks);
+
+    // true if the current thread executes an inference dispatched to the wide executor by this object
+    bool runs_wide_stream() const;
+
+    // wide_inferences, narrow_inferences, switches
+    std::map<std::string, uint64_t> get_statistics() const;
+
+private:
+    // selects the executor of a new inference, returns true for the wide one
+    bool dispatch();
+    ov::threading::Task wrap(ov::threading::Task task, bool wide);
+    // the inference dispatched to the wide or narrow executor is no longer in flight
+    void complete(bool wide);
+    const std::shared_ptr<ov::threading::IStreamsExecutor>& current() const;
+
+    std::shared_ptr<ov::threading::IStreamsExecutor> m_narrow_executor;
+    std::shared_ptr<ov::threading::IStreamsExecutor> m_wide_executor;
+    const int m_wide_streams;
+    const int m_switch_to_wide;
+
+    mutable std::mutex m_mutex;
+    int m_wide_in_flight = 0;
+    int m_narrow_in_flight = 0;
+    bool m_wide = true;
+    int m_low_load_dispatches = 0;
+    uint64_t m_wide_inferences = 0;
+    uint64_t m_narrow_inferences = 0;
+    uint64_t m_switches = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -75,6 +75,14 @@ struct BrgemmCompiledKernel {
     std::shared_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> brgemm_kernel = nullptr;
 };
 
+}  // namespace ov::intel_cpu::x64
+
+// the compiled kernels are not modified at execution time, so they are shared by the streams
+template <>
+struct ov::intel_cpu::SharedCacheValue<std::shared_ptr<ov::intel_cpu::x64::BrgemmCompiledKernel>> : std::true_type {};
+
+namespace ov::intel_cpu::x64 {
+
 class BrgemmKernelExecutor : public BrgemmBaseKernelExecutor,
                              public CPUKernelExecutor<BrgemmKernelConfig, BrgemmCompiledKernel> {
 public:
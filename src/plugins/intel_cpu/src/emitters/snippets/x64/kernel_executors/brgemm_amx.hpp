@@ -88,6 +88,21 @@ struct BrgemmAMXCompiledKernel {
     std::shared_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_a_t> brgemm_copy_a_kernel{nullptr};
 };
 
+}  // namespace ov::intel_cpu::x64
+
+// the compiled kernels are not modified at execution time, so they are shared by the streams
+template <>
+struct ov::intel_cpu::SharedCacheValue<std::shared_ptr<ov::intel_cpu::x64::BrgemmAMXCompiledKernel>>
+    : std::true_type {};
+template <>
+struct ov::intel_cpu::SharedCacheValue<std::shared_ptr<ov::intel_cpu::x64::BrgemmAMXCompiledKernel::BrgemmKernel>>
+    : std::true_type {};
+template <>
+struct ov::intel_cpu::SharedCacheValue<std::shared_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_a_t>>
+    : std::true_type {};
+
+namespace ov::intel_cpu::x64 {
+
 class BrgemmAMXKernelExecutor : public BrgemmBaseKernelExecutor,
                                 public CPUKernelExecutor<BrgemmAMXKernelConfig, BrgemmAMXCompiledKernel> {
 public:
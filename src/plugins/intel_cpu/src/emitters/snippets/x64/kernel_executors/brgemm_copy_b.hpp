@@ -221,6 +221,10 @@ private:
     std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t> dnnl_brgemm_copy_b_kernel = nullptr;
 };
 
+// the compiled kernel is not modified at execution time, so it is shared by the streams
+template <>
+struct SharedCacheValue<std::shared_ptr<BrgemmCopyBKernel>> : std::true_type {};
+
 class BrgemmCopyBKernelExecutor : public CPUKernelExecutor<BrgemmCopyBKernelConfig, BrgemmCopyBKernel> {
 public:
     BrgemmCopyBKernelExecutor(ov::intel_cpu::MultiCacheWeakPtr kernel_cache, BrgemmCopyBKernelConfig config);
@@ -114,6 +114,15 @@ struct BrgemmTppCompiledKernel {
     std::shared_ptr<libxsmm_gemmfunction> brgemm_kernel = nullptr;
 };
 
+}  // namespace ov::intel_cpu::tpp
+
+// the compiled kernels are not modified at execution time, so they are shared by the streams
+template <>
+struct ov::intel_cpu::SharedCacheValue<std::shared_ptr<ov::intel_cpu::tpp::BrgemmTppCompiledKernel>>
+    : std::true_type {};
+
+namespace ov::intel_cpu::tpp {
+
 class BrgemmKernelExecutor : public CPUKernelExecutor<BrgemmKernelConfig, BrgemmTppCompiledKernel> {
 public:
     BrgemmKernelExecutor(ov::intel_cpu::MultiCacheWeakPtr kernel_cache, BrgemmKernelConfig config);
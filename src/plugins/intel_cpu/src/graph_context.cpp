@@ -4,14 +4,18 @@
 #include "graph_context.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
 #include <utility>
 
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "kv_cache_offload.hpp"
 #include "memory_control.hpp"
 #include "nodes/memory.hpp"
 #include "openvino/runtime/system_conf.hpp"
@@ -22,23 +26,50 @@
 
 namespace ov::intel_cpu {
 
+namespace {
+// the process-wide caches are accessed by all the streams, so they are split into shards to reduce lock contention
+constexpr size_t sharedCacheShards = 16;
+
+MultiCachePtr createParamsCache(const std::string& name, size_t capacity, bool shared, uint64_t budget) {
+    if (shared && capacity > 0) {
+        // the executors with scratch memory or other state mutable at execution time are kept per stream
+        const auto sharedName = name + "_" + std::to_string(capacity) + "_" + std::to_string(budget);
+        return std::make_shared<MultiCache>(
+            capacity,
+            MultiCache::getShared(sharedName, capacity, sharedCacheShards, static_cast<size_t>(budget)));
+    }
+    return std::make_shared<MultiCache>(capacity);
+}
+}  // namespace
+
 GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MemoryArenaPool::Ptr memoryArenas)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_rtParamsCache(createParamsCache("rt_params",
+                                       m_config.rtCacheCapacity,
+                                       m_config.sharedRuntimeCache,
+                                       m_config.runtimeCacheBudget)),
+      m_snippetsParamsCache(
+          createParamsCache("snippets_params",
+                            m_config.snippetsCacheCapacity,
+                            m_config.sharedRuntimeCache,
+                            m_config.runtimeCacheBudget)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(
+          std::make_shared<NetworkMemoryControl>(m_config.shapeBuckets,
+                                                 std::move(memoryArenas),
+                                                 m_config.memorySolver)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
@@ -58,6 +89,10 @@ GraphContext::GraphContext(Config config,
     if (!m_cpuParallel) {
         m_cpuParallel = std::make_shared<CpuParallel>(m_config.tbbPartitioner);
     }
+
+    if (!m_config.kvCacheOffloadDir.empty() && KVCacheOffload::isSupported()) {
+        m_kvCacheOffload = std::make_shared<KVCacheOffload>(m_config.kvCacheOffloadDir, m_config.kvCacheHotTokens);
+    }
 }
 
 const dnnl::engine& GraphContext::getEngine() {
@@ -12,6 +12,7 @@
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "kv_cache_offload.hpp"
 #include "memory_control.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -37,7 +38,8 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MemoryArenaPool::Ptr memoryArenas = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -97,10 +99,19 @@ public:
         return m_auxiliaryNetworkMemoryControl;
     }
 
+    // nullptr when the KV caches are kept in RAM
+    [[nodiscard]] const KVCacheOffload::Ptr& getKVCacheOffload() const {
+        return m_kvCacheOffload;
+    }
+
     void releaseMemory() const {
         m_auxiliaryNetworkMemoryControl->releaseMemory();
     }
 
+    void releaseArenas() const {
+        m_auxiliaryNetworkMemoryControl->releaseArenas();
+    }
+
     void allocateMemory() const {
         for (const auto& controlUnit : m_auxiliaryNetworkMemoryControl->controlUnits()) {
             if (!controlUnit->allocated()) {
@@ -114,7 +125,7 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache, either per stream or shared by the whole process
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
     // global scratch pad
@@ -140,6 +151,8 @@ private:
     std::shared_ptr<NetworkMemoryControl> m_auxiliaryNetworkMemoryControl;
     // main memory control object, which is supposed to be globally reused
     MemoryControl::Ptr m_memoryControl;
+    // tiering of the stateful KV caches to the files
+    KVCacheOffload::Ptr m_kvCacheOffload;
 };
 
 }  // namespace ov::intel_cpu
@@ -22,6 +22,7 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "edge.h"
+#include "graph_context.h"
 #include "itt.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -44,10 +45,28 @@
 #include "proxy_mem_blk.h"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "weights_cache.hpp"
 
 using OvString = ov::element_type_traits<ov::element::string>::value_type;
 
 namespace ov::intel_cpu {
+namespace {
+// the intermediate memory is not needed till the next inference, so it may be used by another stream, whether the
+// inference succeeded or threw
+class ArenasGuard {
+public:
+    explicit ArenasGuard(GraphContext::CPtr context) : m_context(std::move(context)) {}
+    ArenasGuard(const ArenasGuard&) = delete;
+    ArenasGuard& operator=(const ArenasGuard&) = delete;
+    ~ArenasGuard() {
+        m_context->releaseArenas();
+    }
+
+private:
+    GraphContext::CPtr m_context;
+};
+}  // namespace
+
 SyncInferRequest::SyncInferRequest(CompiledModelHolder compiled_model)
     : ov::ISyncInferRequest(compiled_model.compiled_model()),
       m_compiled_model(std::move(compiled_model)) {
@@ -112,6 +131,8 @@ void SyncInferRequest::infer() {
         return;
     }
 
+    const ArenasGuard arenasGuard(graph.getGraphContext());
+
     convert_batched_tensors();
     if (!m_batched_tensors.empty()) {
         // batched_tensors will be updated for each infer, external_ptr should be update together
@@ -133,6 +154,10 @@ void SyncInferRequest::infer() {
 
     push_input_data(graph);
 
+    // restores the evicted weights, if any, and keeps them resident till the inference is done
+    const auto weightsCache = graph.getGraphContext()->getWeightsCache();
+    const auto weightsGuard = weightsCache ? weightsCache->use() : nullptr;
+
     graph.Infer(this);
 
     throw_if_canceled();
@@ -688,4 +713,47 @@ void SyncInferRequest::check_tensors() const {
     }
 }
 
+PipelineInferRequest::PipelineInferRequest(const std::shared_ptr<const ov::ICompiledModel>& compiled_model)
+    : ov::ISyncInferRequest(compiled_model) {
+    // the outputs of dynamic shapes are resized by the stages producing them
+    auto allocate = [this](const ov::Output<const ov::Node>& port) {
+        allocate_tensor(port, [&port](ov::SoPtr<ov::ITensor>& tensor) {
+            const auto& shape = port.get_partial_shape();
+            tensor = ov::make_tensor(port.get_element_type(), shape.is_static() ? shape.to_shape() : ov::Shape{0});
+        });
+    };
+    for (const auto& input : get_inputs()) {
+        allocate(input);
+    }
+    for (const auto& output : get_outputs()) {
+        allocate(output);
+    }
+}
+
+void PipelineInferRequest::infer() {
+    OPENVINO_THROW("The pipeline stages are run by the asynchronous infer request");
+}
+
+void PipelineInferRequest::setStageRequests(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests) {
+    m_stage_requests = requests;
+}
+
+std::vector<ov::ProfilingInfo> PipelineInferRequest::get_profiling_info() const {
+    std::vector<ov::ProfilingInfo> info;
+    for (const auto& request : m_stage_requests) {
+        auto stage_info = request->get_profiling_info();
+        info.insert(info.end(), stage_info.begin(), stage_info.end());
+    }
+    return info;
+}
+
+std::vector<ov::SoPtr<ov::IVariableState>> PipelineInferRequest::query_state() const {
+    std::vector<ov::SoPtr<ov::IVariableState>> states;
+    for (const auto& request : m_stage_requests) {
+        auto stage_states = request->query_state();
+        states.insert(states.end(), stage_states.begin(), stage_states.end());
+    }
+    return states;
+}
+
 }  // namespace ov::intel_cpu
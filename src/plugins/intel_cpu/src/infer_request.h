@@ -20,6 +20,8 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/itt.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
@@ -134,4 +136,25 @@ private:
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_outputs;
 };
 
+/**
+ * Request of the model split into the pipeline stages: it only keeps the tensors of the model inputs and outputs,
+ * which are passed to the requests of the stages running the graphs, so the compiled model builds no graph of the
+ * whole model.
+ */
+class PipelineInferRequest : public ov::ISyncInferRequest {
+public:
+    explicit PipelineInferRequest(const std::shared_ptr<const ov::ICompiledModel>& compiled_model);
+
+    void infer() override;
+
+    std::vector<ov::ProfilingInfo> get_profiling_info() const override;
+
+    std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
+
+    void setStageRequests(const std::vector<std::shared_ptr<ov::IAsyncInferRequest>>& requests);
+
+private:
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> m_stage_requests;
+};
+
 }  // namespace ov::intel_cpu
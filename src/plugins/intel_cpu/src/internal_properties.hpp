@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,159 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether the CPU runtime parameters cache is shared by all the streams and compiled models in the
+ * process instead of being created per stream. Only the cached values immutable at execution time are shared, the
+ * executors with working buffers are still cached per stream.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_shared_runtime_cache{"CPU_SHARED_RUNTIME_CACHE"};
+
+/**
+ * @brief Defines the budget (in bytes) of the compiled oneDNN primitives held by the shared CPU runtime parameters
+ * cache. When the budget is exceeded, the least recently used primitives are evicted. The budget is common for all the
+ * streams and compiled models sharing the cache. Zero value (default) means no budget.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_runtime_cache_budget{"CPU_RUNTIME_CACHE_BUDGET"};
+
+/**
+ * @brief Read-only property to get the lookup counters (hits, misses, evictions, deduplicated) and the bytes of the
+ * compiled primitives of the CPU runtime parameters cache used by the compiled model. When the cache is shared, the
+ * values are process-wide, i.e. accumulated over all the streams and compiled models sharing the cache, and
+ * "process_wide" is set to 1.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Defines whether the repacked weights of the compiled graph are stored in the exported blob, so the model
+ * imported from the cache skips weights repacking.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_cache_packed_weights{"CPU_CACHE_PACKED_WEIGHTS"};
+
+/**
+ * @brief Defines the budget (in bytes) of the resident repacked weights of the compiled model. When no inference of
+ * the compiled model is running and its repacked weights exceed the budget, the weights over the budget are evicted
+ * and repacked again on the next inference. The budget applies to the weights of every socket separately. Zero value
+ * (default) disables the eviction of the model weights.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_weights_cache_budget{"CPU_WEIGHTS_CACHE_BUDGET"};
+
+/**
+ * @brief Read-only property to get the counters (resident_bytes, evictable_bytes, packs, repacks, evictions) of the
+ * repacked weights of the compiled model.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_weights_cache_statistics{
+    "CPU_WEIGHTS_CACHE_STATISTICS"};
+
+/**
+ * @brief Defines whether the dynamic shape intermediate tensors are allocated with the size rounded up to the shape
+ * bucket upper bound, so the inferences with the shapes falling into the already allocated buckets do not reallocate
+ * the memory.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief Read-only property to get the counters of the dynamic memory blocks: block_reuses (a block took another size
+ * within its allocated bucket) and block_reallocations (a block was reallocated for a new bucket). The counters are
+ * per memory block, so one inference with new shapes counts every block it resizes, and they are summed up over the
+ * graphs of all the streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_shape_buckets_statistics{
+    "CPU_SHAPE_BUCKETS_STATISTICS"};
+
+/**
+ * @brief Defines whether the static intermediate memory of the graphs is borrowed from the arena pool shared by all
+ * the streams of the compiled model only for the time of the inference.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_shared_memory_arenas{"CPU_SHARED_MEMORY_ARENAS"};
+
+/**
+ * @brief Read-only property to get the counters (arenas, arena_bytes, borrows) of the shared memory arena pool.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_memory_arenas_statistics{
+    "CPU_MEMORY_ARENAS_STATISTICS"};
+
+/**
+ * @brief Defines whether the compiled model regroups the cores at runtime: the inferences are executed by fewer, wider
+ * streams while few requests are in flight and by the streams computed from the hints when the requests queue up.
+ * Applies to the compiled models with several streams only. Enables the shared memory arenas, so both sets of graphs
+ * use the same intermediate memory.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_dynamic_streams{"CPU_DYNAMIC_STREAMS"};
+
+/**
+ * @brief Read-only property to get the counters (wide_inferences, narrow_inferences, switches) of the dynamic streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_dynamic_streams_statistics{
+    "CPU_DYNAMIC_STREAMS_STATISTICS"};
+
+/**
+ * @brief Defines the directory of the files holding the cold tokens of the stateful KV caches. The cold tokens are
+ * dropped from RAM after the attention of every layer and read back in the background ahead of it, so the resident
+ * part of a long KV cache is bounded by CPU_KV_CACHE_HOT_TOKENS per layer. Empty value (default) keeps the KV caches in
+ * RAM. Supported on Linux only, the directory should be on a disk-backed file system.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_kv_cache_offload_dir{"CPU_KV_CACHE_OFFLOAD_DIR"};
+
+/**
+ * @brief Defines the number of the latest tokens of every KV cache which always stay in RAM when
+ * CPU_KV_CACHE_OFFLOAD_DIR is set.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_kv_cache_hot_tokens{"CPU_KV_CACHE_HOT_TOKENS"};
+
+/**
+ * @brief Read-only property to get the counters (spills, spilled_bytes, prefetches, prefetched_bytes, prefetch_us) of
+ * the KV cache offload.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_kv_cache_offload_statistics{
+    "CPU_KV_CACHE_OFFLOAD_STATISTICS"};
+
+/**
+ * @brief Defines whether the MLP and QKV projections of the LLMs are fused on the CPUs without AMX, where the fused
+ * nodes run the AVX-512/AVX2 kernels made for the token generation instead of the FullyConnected nodes. Only the f16
+ * and i8 compressed weights are fused. Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_llm_fusion_without_amx{"CPU_LLM_FUSION_WITHOUT_AMX"};
+
+/**
+ * @brief Enum to define the solver of the static intermediate memory layout.
+ */
+enum class MemorySolverType : uint8_t {
+    GREEDY = 0,    //!<  Greedy box packing (ov::MemorySolver)
+    BEST_FIT = 1,  //!<  Best fit placement with several placement orders, bounded in solve time
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemorySolverType& type) {
+    switch (type) {
+    case MemorySolverType::GREEDY:
+        return os << "GREEDY";
+    case MemorySolverType::BEST_FIT:
+        return os << "BEST_FIT";
+    default:
+        OPENVINO_THROW("Unsupported memory solver type value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemorySolverType& type) {
+    std::string str;
+    is >> str;
+    if (str == "GREEDY") {
+        type = MemorySolverType::GREEDY;
+    } else if (str == "BEST_FIT") {
+        type = MemorySolverType::BEST_FIT;
+    } else {
+        OPENVINO_THROW("Unsupported memory solver type: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines the solver used to lay out the static intermediate memory of the graph.
+ */
+static constexpr Property<MemorySolverType, PropertyMutability::RW> memory_solver{"CPU_MEMORY_SOLVER"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
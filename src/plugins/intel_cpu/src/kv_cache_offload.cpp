@@ -0,0 +1,265 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_offload.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+#    include <cstdlib>
+#endif
+
+namespace ov::intel_cpu {
+
+MappedFile::MappedFile(std::string dir) : m_dir(std::move(dir)) {
+    OPENVINO_ASSERT(KVCacheOffload::isSupported(), "KV cache offload to a file is supported on Linux only");
+}
+
+MappedFile::~MappedFile() {
+#if defined(__linux__)
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    if (m_fd >= 0) {
+        close(m_fd);
+    }
+#endif
+}
+
+bool MappedFile::resize(size_t size) {
+#if defined(__linux__)
+    if (size <= m_size) {
+        return false;
+    }
+    if (m_fd < 0) {
+        // the file is removed as soon as it is closed
+        std::string path = m_dir + "/ov_kv_cache_XXXXXX";
+        m_fd = mkstemp(path.data());
+        OPENVINO_ASSERT(m_fd >= 0, "Cannot create the KV cache file in ", m_dir);
+        unlink(path.c_str());
+    }
+    const auto pagesize = static_cast<size_t>(getpagesize());
+    size = (size + pagesize - 1) & ~(pagesize - 1);
+    OPENVINO_ASSERT(ftruncate(m_fd, static_cast<off_t>(size)) == 0,
+                    "Cannot grow the KV cache file in ",
+                    m_dir,
+                    " to ",
+                    size,
+                    " bytes");
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    OPENVINO_ASSERT(data != MAP_FAILED, "Cannot map ", size, " bytes of the KV cache file");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    m_data = data;
+    m_size = size;
+    return true;
+#else
+    (void)size;
+    OPENVINO_THROW("KV cache offload to a file is supported on Linux only");
+#endif
+}
+
+size_t MappedFile::spill(size_t bytes) const {
+#if defined(__linux__)
+    const auto pagesize = static_cast<size_t>(getpagesize());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bytes = std::min(bytes, m_size) & ~(pagesize - 1);
+    if (bytes == 0) {
+        return 0;
+    }
+    // the pages become clean and unmapped, so they can be dropped from the page cache
+    if (msync(m_data, bytes, MS_SYNC) != 0 || madvise(m_data, bytes, MADV_DONTNEED) != 0) {
+        return 0;
+    }
+    posix_fadvise(m_fd, 0, static_cast<off_t>(bytes), POSIX_FADV_DONTNEED);
+    return bytes;
+#else
+    (void)bytes;
+    return 0;
+#endif
+}
+
+size_t MappedFile::prefetch(size_t bytes) const {
+#if defined(__linux__)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bytes = std::min(bytes, m_size);
+    if (bytes == 0) {
+        return 0;
+    }
+#    if defined(MADV_POPULATE_READ)
+    // reads and maps the pages, so the attention does not fault on them
+    if (madvise(m_data, bytes, MADV_POPULATE_READ) == 0) {
+        return bytes;
+    }
+#    endif
+    // older kernels: asynchronous readahead, the pages are mapped on the first access
+    if (madvise(m_data, bytes, MADV_WILLNEED) != 0) {
+        return 0;
+    }
+    return bytes;
+#else
+    (void)bytes;
+    return 0;
+#endif
+}
+
+KVCacheOffload::KVCacheOffload(std::string dir, size_t hot_tokens)
+    : m_dir(std::move(dir)),
+      m_hot_tokens(hot_tokens),
+      m_worker([this] {
+          worker();
+      }) {}
+
+KVCacheOffload::~KVCacheOffload() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_worker.join();
+}
+
+bool KVCacheOffload::isSupported() {
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::shared_ptr<MappedFile> KVCacheOffload::allocate(size_t capacity) const {
+    if (capacity <= m_hot_tokens) {
+        return nullptr;
+    }
+    return std::make_shared<MappedFile>(m_dir);
+}
+
+size_t KVCacheOffload::registerCache() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_caches.emplace_back();
+    return m_caches.size() - 1;
+}
+
+void KVCacheOffload::acquire(size_t id) {
+    std::vector<Region> next;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        OPENVINO_ASSERT(id < m_caches.size(), "KV cache offload: unknown cache id ", id);
+        next = m_caches[(id + 1) % m_caches.size()];
+    }
+    if (next.empty()) {
+        return;
+    }
+    auto prefetch = [this, next = std::move(next)] {
+        const auto start = std::chrono::steady_clock::now();
+        size_t bytes = 0;
+        for (const auto& region : next) {
+            bytes += region.file->prefetch(region.bytes);
+        }
+        const auto time = std::chrono::steady_clock::now() - start;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_prefetches++;
+        m_prefetched_bytes += bytes;
+        m_prefetch_us += std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+    };
+    enqueue({true, std::move(prefetch)});
+}
+
+void KVCacheOffload::release(size_t id, std::vector<Region> regions) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        OPENVINO_ASSERT(id < m_caches.size(), "KV cache offload: unknown cache id ", id);
+        m_caches[id] = regions;
+    }
+    if (regions.empty()) {
+        return;
+    }
+    auto spill = [this, regions = std::move(regions)] {
+        size_t bytes = 0;
+        for (const auto& region : regions) {
+            bytes += region.file->spill(region.bytes);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_spills++;
+        m_spilled_bytes += bytes;
+    };
+    enqueue({false, std::move(spill)});
+}
+
+void KVCacheOffload::wait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle_cv.wait(lock, [&] {
+        return m_tasks.empty() && !m_busy;
+    });
+}
+
+std::map<std::string, uint64_t> KVCacheOffload::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {{"spills", m_spills},
+            {"spilled_bytes", m_spilled_bytes},
+            {"prefetches", m_prefetches},
+            {"prefetched_bytes", m_prefetched_bytes},
+            {"prefetch_us", m_prefetch_us}};
+}
+
+void KVCacheOffload::enqueue(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (task.prefetch) {
+            // the prefetches still queued are late: their nodes have already started
+            m_tasks.erase(std::remove_if(m_tasks.begin(),
+                                         m_tasks.end(),
+                                         [](const Task& queued) {
+                                             return queued.prefetch;
+                                         }),
+                          m_tasks.end());
+        }
+        m_tasks.push_back(std::move(task));
+    }
+    m_cv.notify_one();
+}
+
+void KVCacheOffload::worker() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [&] {
+                return m_stop || !m_tasks.empty();
+            });
+            if (m_stop) {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            m_busy = true;
+        }
+        task.run();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_busy = false;
+        }
+        m_idle_cv.notify_all();
+    }
+}
+
+}  // namespace ov::intel_cpu
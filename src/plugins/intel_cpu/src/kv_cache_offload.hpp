@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * Memory of a KV cache backed by an unlinked temporary file mapped in the shared mode. The pages of the mapping can be
+ * written back to the file and dropped from RAM, and are read back on access. The content is kept when the mapping
+ * grows. Available on Linux only.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(std::string dir);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // data() and size() are for the thread which resizes the file
+    [[nodiscard]] void* data() const {
+        return m_data;
+    }
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+    // grows the mapping to at least size bytes, returns true when the mapping was moved; the old mapping is unmapped
+    // only once the spill or the prefetch running on it is done
+    bool resize(size_t size);
+
+    // writes the dirty pages of [0, bytes) back to the file and drops them from RAM, returns the spilled bytes
+    size_t spill(size_t bytes) const;
+
+    // reads the pages of [0, bytes) from the file, returns the prefetched bytes
+    size_t prefetch(size_t bytes) const;
+
+private:
+    std::string m_dir;
+    // guards the mapping against the spills and the prefetches of the background thread
+    mutable std::mutex m_mutex;
+    int m_fd = -1;
+    void* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+/**
+ * Tiering of the KV caches of the stateful attention nodes of a graph. The latest hot_tokens tokens of every cache
+ * stay in RAM, the older (cold) tokens are kept in a MappedFile: they are spilled once the attention of the node is
+ * done and prefetched by a background thread while the attention of the preceding node is running, so only the cold
+ * tokens of about two nodes are resident at a time.
+ *
+ * The caches are registered in the order of the execution, the cold tokens of the cache following the current one
+ * are read ahead. The memories are expected to keep the tokens in the outermost dimension.
+ */
+class KVCacheOffload {
+public:
+    using Ptr = std::shared_ptr<KVCacheOffload>;
+
+    // cold bytes at the beginning of the file of a cache memory
+    struct Region {
+        std::shared_ptr<MappedFile> file;
+        size_t bytes;
+    };
+
+    KVCacheOffload(std::string dir, size_t hot_tokens);
+    ~KVCacheOffload();
+
+    KVCacheOffload(const KVCacheOffload&) = delete;
+    KVCacheOffload& operator=(const KVCacheOffload&) = delete;
+
+    static bool isSupported();
+
+    [[nodiscard]] size_t hotTokens() const {
+        return m_hot_tokens;
+    }
+
+    // file-backed storage for a cache which can hold capacity tokens, nullptr when all of them are hot
+    [[nodiscard]] std::shared_ptr<MappedFile> allocate(size_t capacity) const;
+
+    // registers the caches of an attention node, returns the id of the node in the order of the execution
+    size_t registerCache();
+
+    // the attention of the node id starts: the cold regions of the next node are prefetched in the background
+    void acquire(size_t id);
+
+    // the attention of the node id is done: the cold regions of its caches are spilled in the background and are
+    // prefetched again when the preceding node starts
+    void release(size_t id, std::vector<Region> regions);
+
+    // waits for the spills and the prefetches in flight
+    void wait();
+
+    // spills, spilled_bytes, prefetches, prefetched_bytes, prefetch_us
+    [[nodiscard]] std::map<std::string, uint64_t> getStatistics() const;
+
+private:
+    struct Task {
+        bool prefetch;
+        std::function<void()> run;
+    };
+
+    void enqueue(Task task);
+    void worker();
+
+    const std::string m_dir;
+    const size_t m_hot_tokens;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_idle_cv;
+    std::deque<Task> m_tasks;
+    bool m_busy = false;
+    bool m_stop = false;
+    // cold regions of every registered node from its last release
+    std::vector<std::vector<Region>> m_caches;
+
+    uint64_t m_spills = 0;
+    uint64_t m_spilled_bytes = 0;
+    uint64_t m_prefetches = 0;
+    uint64_t m_prefetched_bytes = 0;
+    uint64_t m_prefetch_us = 0;
+
+    std::thread m_worker;
+};
+
+}  // namespace ov::intel_cpu
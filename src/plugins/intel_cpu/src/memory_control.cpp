@@ -5,10 +5,13 @@
 #include "memory_control.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -20,7 +23,9 @@
 #    include <unordered_set>
 #endif
 
+#include "best_fit_memory_solver.hpp"
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 #include "utils/debug_capabilities.h"
@@ -30,6 +35,24 @@ namespace ov::intel_cpu {
 
 namespace {
 
+/**
+ * Rounds the size up to the upper bound of the shape bucket. The buckets split each power of two range into four
+ * equal parts, so no more than a quarter of the allocated memory is wasted.
+ */
+size_t shapeBucketUpperBound(size_t size) {
+    constexpr size_t minBucketSize = 4096;
+    constexpr size_t bucketsPerRange = 4;
+    if (size <= minBucketSize) {
+        return minBucketSize;
+    }
+    size_t range = minBucketSize;
+    while (range < (size - 1) / 2 + 1) {
+        range <<= 1;
+    }
+    const size_t step = range / bucketsPerRange;
+    return rnd_up(size, step);
+}
+
 class StaticPartitionMemoryBlock : public IMemoryBlockObserver {
 public:
     StaticPartitionMemoryBlock(MemoryBlockPtr pBlock, ptrdiff_t offset)
@@ -69,7 +92,8 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
+    explicit MemoryBlockWithRelease(std::shared_ptr<ShapeBucketsStatistics> shapeBuckets = nullptr)
+        : m_shapeBuckets(std::move(shapeBuckets)) {
         auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
@@ -82,7 +106,19 @@ public:
         m_pBlock->setExtBuff(ptr, size);
     }
     bool resize(size_t size) override {
-        return m_pBlock->resize(size);
+        if (!m_shapeBuckets) {
+            return m_pBlock->resize(size);
+        }
+        if (size > m_pInternalMem->size()) {
+            m_shapeBuckets->reallocations.fetch_add(1, std::memory_order_relaxed);
+            m_lastSize = size;
+            return m_pBlock->resize(shapeBucketUpperBound(size));
+        }
+        if (size != m_lastSize) {
+            m_shapeBuckets->reuses.fetch_add(1, std::memory_order_relaxed);
+            m_lastSize = size;
+        }
+        return false;
     }
     [[nodiscard]] bool hasExtBuffer() const noexcept override {
         return m_pBlock->hasExtBuffer();
@@ -95,6 +131,7 @@ public:
     }
     void free() {
         m_pInternalMem->free();
+        m_lastSize = 0;
     }
 
     [[nodiscard]] size_t size() const {
@@ -104,6 +141,8 @@ public:
 private:
     MemoryBlockPtr m_pBlock;
     MemoryBlockWithReuse* m_pInternalMem;
+    std::shared_ptr<ShapeBucketsStatistics> m_shapeBuckets;
+    size_t m_lastSize = 0;
 };
 
 #ifdef CPU_DEBUG_CAPS
@@ -160,6 +199,9 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    virtual void releaseArena() {
+        // nothing to do
+    }
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -207,6 +249,11 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    explicit MemoryManagerStatic(MemoryArenaPool::Ptr arenas = nullptr,
+                                 MemorySolverType solverType = MemorySolverType::GREEDY)
+        : m_arenas(std::move(arenas)),
+          m_solverType(solverType) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -229,27 +276,51 @@ private:
             box.size = div_up(box.size, alignment);
         });
 
-        ov::MemorySolver staticMemSolver(boxes_to_process);
-        m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+        if (MemorySolverType::BEST_FIT == m_solverType) {
+            BestFitMemorySolver staticMemSolver(boxes_to_process);
+            m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+            createBlocks(boxes_to_process, staticMemSolver, alignment);
+        } else {
+            ov::MemorySolver staticMemSolver(boxes_to_process);
+            m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+            createBlocks(boxes_to_process, staticMemSolver, alignment);
+        }
+    }
 
+    template <typename Solver>
+    void createBlocks(const std::vector<MemorySolver::Box>& boxes, const Solver& solver, size_t alignment) {
         m_workspace = std::make_shared<MemoryBlockWithRelease>();
 
-        for (const auto& box : boxes_to_process) {
-            int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
+        for (const auto& box : boxes) {
+            int64_t offset = solver.get_offset(static_cast<int>(box.id));
             auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
     }
 
     void allocate() override {
-        if (m_workspace) {
-            m_workspace->resize(m_totalSize);
+        if (!m_workspace) {
+            return;
+        }
+        if (m_arenas) {
+            if (!m_arena) {
+                m_arena = m_arenas->acquire(m_totalSize);
+                m_workspace->setExtBuff(m_arena->getRawPtr(), m_totalSize);
+            }
+            return;
         }
+        m_workspace->resize(m_totalSize);
     }
     void release() override {
         if (m_workspace) {
             m_workspace->free();
         }
+        m_arena.reset();
+    }
+    void releaseArena() override {
+        if (m_arena) {
+            release();
+        }
     }
 
     static const char* getClassName() {
@@ -259,6 +330,9 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
+    MemoryArenaPool::Ptr m_arenas;
+    std::shared_ptr<MemoryBlockWithReuse> m_arena;
+    MemorySolverType m_solverType = MemorySolverType::GREEDY;
     size_t m_totalSize = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
@@ -266,6 +340,9 @@ private:
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    explicit MemoryManagerNonOverlappingSets(std::shared_ptr<ShapeBucketsStatistics> shapeBuckets = nullptr)
+        : m_shapeBuckets(std::move(shapeBuckets)) {}
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
         if (-1 != reg.finish) {
@@ -333,7 +410,7 @@ private:
             }
         }
         for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
+            auto unique_block = std::make_shared<MemoryBlockWithRelease>(m_shapeBuckets);
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
             }
@@ -356,6 +433,7 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
+    std::shared_ptr<ShapeBucketsStatistics> m_shapeBuckets;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
@@ -487,6 +565,10 @@ public:
         m_memManager->release();
     }
 
+    void releaseArena() {
+        m_memManager->releaseArena();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -525,18 +607,28 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id,
+                             bool shapeBuckets,
+                             const std::shared_ptr<ShapeBucketsStatistics>& statistics,
+                             const MemoryArenaPool::Ptr& arenas,
+                             MemorySolverType solverType)
+    : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        arenas,
+        solverType));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        shapeBuckets ? statistics : nullptr));
 
     // handler for I/O tensors, so far simply individual blocks
     m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
@@ -545,6 +637,7 @@ MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
 }
 
 void MemoryControl::insert(const MemoryRegion& region, const std::vector<size_t>& syncInds) {
+    CPU_DEBUG_CAP_ENABLE(m_regions.push_back(region);)
     for (auto&& handler : m_handlers) {
         if (handler->insert(region, syncInds)) {
             return;
@@ -587,6 +680,14 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+void MemoryControl::releaseArenas() {
+    for (auto&& handler : m_handlers) {
+        handler->releaseArena();
+    }
+    // the arenas are borrowed again on the next allocation
+    m_allocated = false;
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -595,10 +696,78 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
     }
     return profileData;
 }
+
+const MemoryRegions& MemoryControl::dumpRegions() const {
+    return m_regions;
+}
 #endif  // CPU_DEBUG_CAPS
 
+NetworkMemoryControl::NetworkMemoryControl(bool shapeBuckets, MemoryArenaPool::Ptr arenas, MemorySolverType solverType)
+    : m_shapeBuckets(shapeBuckets),
+      m_shapeBucketsStatistics(std::make_shared<ShapeBucketsStatistics>()),
+      m_arenas(std::move(arenas)),
+      m_solverType(solverType) {}
+
+std::shared_ptr<MemoryBlockWithReuse> MemoryArenaPool::acquire(size_t size) {
+    std::unique_ptr<MemoryBlockWithReuse> arena;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_borrows++;
+        // prefer the smallest arena which fits the size, otherwise grow the largest one
+        auto found = m_free.end();
+        for (auto itr = m_free.begin(); itr != m_free.end(); ++itr) {
+            if (found == m_free.end()) {
+                found = itr;
+                continue;
+            }
+            const bool fits = (*itr)->size() >= size;
+            const bool foundFits = (*found)->size() >= size;
+            if ((fits && (!foundFits || (*itr)->size() < (*found)->size())) ||
+                (!fits && !foundFits && (*itr)->size() > (*found)->size())) {
+                found = itr;
+            }
+        }
+        if (found != m_free.end()) {
+            arena = std::move(*found);
+            m_free.erase(found);
+        } else {
+            m_arenas++;
+        }
+    }
+    if (!arena) {
+        arena = std::make_unique<MemoryBlockWithReuse>();
+    }
+
+    const auto sizeBefore = arena->size();
+    arena->resize(size);
+    const auto sizeAfter = arena->size();
+    if (sizeAfter != sizeBefore) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bytes = m_bytes - sizeBefore + sizeAfter;
+    }
+
+    std::weak_ptr<MemoryArenaPool> weakPool = weak_from_this();
+    return {arena.release(), [weakPool](MemoryBlockWithReuse* ptr) {
+                std::unique_ptr<MemoryBlockWithReuse> arena(ptr);
+                if (auto pool = weakPool.lock()) {
+                    pool->putBack(std::move(arena));
+                }
+            }};
+}
+
+void MemoryArenaPool::putBack(std::unique_ptr<MemoryBlockWithReuse> arena) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.push_back(std::move(arena));
+}
+
+std::map<std::string, uint64_t> MemoryArenaPool::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {{"arenas", m_arenas}, {"arena_bytes", m_bytes}, {"borrows", m_borrows}};
+}
+
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(
+        new MemoryControl(std::move(id), m_shapeBuckets, m_shapeBucketsStatistics, m_arenas, m_solverType)));
     return m_controlUnits.back();
 }
 
@@ -614,6 +783,33 @@ void NetworkMemoryControl::releaseMemory() {
     }
 }
 
+void NetworkMemoryControl::releaseArenas() {
+    if (!m_arenas) {
+        return;
+    }
+    for (auto&& item : m_controlUnits) {
+        item->releaseArenas();
+    }
+}
+
+std::vector<std::pair<std::string, MemoryRegions>> NetworkMemoryControl::dumpRegions() const {
+#ifdef CPU_DEBUG_CAPS
+    std::vector<std::pair<std::string, MemoryRegions>> retVal;
+    retVal.reserve(m_controlUnits.size());
+    for (auto&& item : m_controlUnits) {
+        retVal.emplace_back(item->getId(), item->dumpRegions());
+    }
+    return retVal;
+#else
+    return {};
+#endif  // CPU_DEBUG_CAPS
+}
+
+std::map<std::string, uint64_t> NetworkMemoryControl::getShapeBucketsStatistics() const {
+    return {{"block_reuses", m_shapeBucketsStatistics->reuses.load()},
+            {"block_reallocations", m_shapeBucketsStatistics->reallocations.load()}};
+}
+
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
 #ifdef CPU_DEBUG_CAPS
     std::vector<std::pair<std::string, MemoryStatistics>> retVal;
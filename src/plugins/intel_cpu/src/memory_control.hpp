@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -14,6 +17,8 @@
 
 #include "cpu_memory.h"
 #include "edge.h"
+#include "internal_properties.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
 
@@ -42,6 +47,44 @@ struct MemoryStatisticsRecord {
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
 
+/**
+ * Counters of the dynamic memory blocks resize requests when the shape buckets are enabled
+ */
+struct ShapeBucketsStatistics {
+    // a dynamic memory block took another size within its already allocated bucket
+    std::atomic<uint64_t> reuses{0};
+    // a dynamic memory block was reallocated for a new bucket
+    std::atomic<uint64_t> reallocations{0};
+};
+
+/**
+ * Pool of the memory arenas for the intermediate tensors shared by the graphs of a compiled model.
+ * A graph borrows an arena only for the time of the inference, so the peak intermediate memory scales with the number
+ * of concurrently executing graphs instead of the number of the created ones.
+ *
+ * Is a thread safe
+ */
+class MemoryArenaPool : public std::enable_shared_from_this<MemoryArenaPool> {
+public:
+    using Ptr = std::shared_ptr<MemoryArenaPool>;
+
+    /**
+     * @brief Borrows an arena of at least the given size. The arena is returned to the pool, when the last reference
+     * to it is released.
+     */
+    std::shared_ptr<MemoryBlockWithReuse> acquire(size_t size);
+    [[nodiscard]] std::map<std::string, uint64_t> getStatistics() const;
+
+private:
+    void putBack(std::unique_ptr<MemoryBlockWithReuse> arena);
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<MemoryBlockWithReuse>> m_free;
+    uint64_t m_arenas = 0;
+    uint64_t m_bytes = 0;
+    uint64_t m_borrows = 0;
+};
+
 class MemoryControl {
 public:
     class RegionHandler;
@@ -61,32 +104,51 @@ public:
 
     void allocateMemory();
     void releaseMemory();
+    // returns the borrowed arenas, if any, to the pool
+    void releaseArenas();
 
     [[nodiscard]] const std::string& getId() const {
         return m_id;
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id,
+                  bool shapeBuckets,
+                  const std::shared_ptr<ShapeBucketsStatistics>& statistics,
+                  const MemoryArenaPool::Ptr& arenas,
+                  MemorySolverType solverType);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
+    [[nodiscard]] const MemoryRegions& dumpRegions() const;
 
     friend class NetworkMemoryControl;
 
     std::string m_id;
     std::vector<RegionHandlerPtr> m_handlers;
     bool m_allocated = false;
+    CPU_DEBUG_CAP_ENABLE(MemoryRegions m_regions;)
 };
 
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    /**
+     * @param shapeBuckets defines whether the dynamic memory blocks are allocated with the size rounded up to the
+     * shape bucket upper bound, so the requests with the shapes falling into the same bucket reuse the allocated memory
+     * @param arenas is an optional pool the static intermediate memory is borrowed from for the time of the inference
+     * @param solverType is the solver used to lay out the static intermediate memory
+     */
+    explicit NetworkMemoryControl(bool shapeBuckets = false,
+                                  MemoryArenaPool::Ptr arenas = nullptr,
+                                  MemorySolverType solverType = MemorySolverType::GREEDY);
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
     void releaseMemory();
+    void releaseArenas();
 
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
+    [[nodiscard]] std::vector<std::pair<std::string, MemoryRegions>> dumpRegions() const;
+    [[nodiscard]] std::map<std::string, uint64_t> getShapeBucketsStatistics() const;
 
     [[nodiscard]] const std::vector<MemoryControl::Ptr>& controlUnits() const {
         return m_controlUnits;
@@ -94,6 +156,10 @@ public:
 
 private:
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    bool m_shapeBuckets = false;
+    std::shared_ptr<ShapeBucketsStatistics> m_shapeBucketsStatistics;
+    MemoryArenaPool::Ptr m_arenas;
+    MemorySolverType m_solverType = MemorySolverType::GREEDY;
 };
 
 }  // namespace ov::intel_cpu
@@ -937,6 +937,53 @@ struct ConvertFrom2BitPrecision<std::tuple<src_t, dst_t>> {
     }
 };
 
+#define INTEL_CPU_CVT_FROM_SPLIT_BIT_LIST                                                             \
+    INTEL_CPU_CVT(u3, f32), INTEL_CPU_CVT(u3, f16), INTEL_CPU_CVT(u3, bf16), INTEL_CPU_CVT(u3, i32),  \
+        INTEL_CPU_CVT(u3, u8), INTEL_CPU_CVT(u3, i8), INTEL_CPU_CVT(u6, f32), INTEL_CPU_CVT(u6, f16), \
+        INTEL_CPU_CVT(u6, bf16), INTEL_CPU_CVT(u6, i32), INTEL_CPU_CVT(u6, u8), INTEL_CPU_CVT(u6, i8)
+
+template <typename LoopPolicy>
+struct ConvertFromSplitBitContext {
+    using loop_policy = LoopPolicy;
+
+    ov::element::Type_t inType;
+    const void* srcPtr;
+    void* dstPtr;
+    size_t size;
+    bool converted;
+};
+
+template <typename T>
+struct ConvertFromSplitBitPrecision;
+
+// u3/u6 keep 8/4 values in 3 bytes: the low bits in the first two bytes (big endian, the first value in the most
+// significant bits) and the high bits in the third byte
+[[maybe_unused]] static uint8_t get_split_bit(const uint8_t* src, size_t i, bool u6) {
+    const size_t values = u6 ? 4 : 8;
+    const uint8_t* bytes = src + (i / values) * 3;
+    const size_t shift = values - 1 - i % values;
+    const auto low_bits = static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
+    if (u6) {
+        return static_cast<uint8_t>(((low_bits >> (4 * shift)) & 0xF) | (((bytes[2] >> (2 * shift)) & 0x3) << 4));
+    }
+    return static_cast<uint8_t>(((low_bits >> (2 * shift)) & 0x3) | (((bytes[2] >> shift) & 0x1) << 2));
+}
+
+template <typename src_t, typename dst_t>
+struct ConvertFromSplitBitPrecision<std::tuple<src_t, dst_t>> {
+    template <typename Ctx>
+    void operator()(Ctx& ctx) {
+        using LoopPolicy = typename Ctx::loop_policy;
+        const auto* src = static_cast<const uint8_t*>(ctx.srcPtr);
+        auto dst = static_cast<dst_t*>(ctx.dstPtr);
+        const bool u6 = ctx.inType == ov::element::u6;
+        LoopPolicy::run(ctx.size, [&](size_t i) {
+            dst[i] = static_cast<dst_t>(get_split_bit(src, i, u6));
+        });
+        ctx.converted = true;
+    }
+};
+
 #define INTEL_CPU_CVT_FROM_4BIT_LIST                                                                                 \
     INTEL_CPU_CVT(u4, f32), INTEL_CPU_CVT(u4, i32), INTEL_CPU_CVT(u4, bf16), INTEL_CPU_CVT(u4, f16),                 \
         INTEL_CPU_CVT(u4, i8), INTEL_CPU_CVT(u4, u8), INTEL_CPU_CVT(i4, f32), INTEL_CPU_CVT(i4, i32),                \
@@ -1178,6 +1225,14 @@ static void do_cpu_convert(const void* srcPtr,
         ConvertFrom2BitContext<LoopPolicy> ctx{srcPtr, dstPtr, size, false};
         OV_SWITCH(intel_cpu, ConvertFrom2BitPrecision, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_FROM_2BIT_LIST);
         OPENVINO_ASSERT(ctx.converted, "cpu_convert can't convert from: ", srcPrc, " precision to: ", dstPrc);
+    } else if (any_of(srcPrc, ov::element::u3, ov::element::u6)) {
+        ConvertFromSplitBitContext<LoopPolicy> ctx{srcPrc, srcPtr, dstPtr, size, false};
+        OV_SWITCH(intel_cpu,
+                  ConvertFromSplitBitPrecision,
+                  ctx,
+                  std::tie(srcPrc, dstPrc),
+                  INTEL_CPU_CVT_FROM_SPLIT_BIT_LIST);
+        OPENVINO_ASSERT(ctx.converted, "cpu_convert can't convert from: ", srcPrc, " precision to: ", dstPrc);
     } else if (srcPrc.bitwidth() == 4U) {
         ConvertFrom4BitContext<LoopPolicy> ctx{srcPrc, srcPtr, dstPtr, size, false};
         OV_SWITCH(intel_cpu, ConvertFrom4BitPrecision, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_FROM_4BIT_LIST);
@@ -1259,6 +1314,7 @@ bool is_supported_convert([[maybe_unused]] ov::element::Type srcPrc, [[maybe_unu
     OV_SWITCH(intel_cpu, isSupported, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_LIST);
     OV_SWITCH(intel_cpu, isSupported, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_FROM_BIN_LIST);
     OV_SWITCH(intel_cpu, isSupported, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_FROM_2BIT_LIST);
+    OV_SWITCH(intel_cpu, isSupported, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_FROM_SPLIT_BIT_LIST);
     OV_SWITCH(intel_cpu, isSupported, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_FROM_4BIT_LIST);
     OV_SWITCH(intel_cpu, isSupported, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_FROM_BYTE_FP_LIST);
     OV_SWITCH(intel_cpu, isSupported, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_TO_4BIT_LIST);
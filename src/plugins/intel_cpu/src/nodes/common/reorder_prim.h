@@ -6,11 +6,16 @@
 
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <type_traits>
 
 #include "cache/multi_cache.h"
 
 namespace ov::intel_cpu {
 
+// the reorder primitives are stateless, the streams may execute the same primitive concurrently
+template <>
+struct SharedCacheValue<dnnl::reorder> : std::true_type {};
+
 dnnl::reorder getReorderPrim(const MultiCachePtr& cache,
                              const dnnl::engine& engine,
                              const dnnl::memory::desc& src,
@@ -0,0 +1,165 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tensor_parallel.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <utility>
+#include <vector>
+
+#include "common/cpu_memcpy.h"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/threading/cpu_message.hpp"
+
+namespace ov::intel_cpu {
+
+TensorParallelComm::TensorParallelComm(const GraphContext::CPtr& context) {
+    const auto& executor = context->getCPUStreamExecutor();
+    if (!executor || executor->get_rank().empty()) {
+        return;
+    }
+    m_rank = executor->get_rank()[0];
+    m_size = ov::threading::message_manager()->get_num_sub_streams();
+    m_sub_memory = context->getSubMemory();
+    m_cpu_parallel = context->getCpuParallel();
+    if (!m_sub_memory) {
+        m_size = 1;
+    }
+}
+
+std::pair<size_t, size_t> TensorParallelComm::part(size_t len, size_t unit) const {
+    return part_of(m_rank, len, unit);
+}
+
+std::pair<size_t, size_t> TensorParallelComm::part_of(int rank_id, size_t len, size_t unit) const {
+    const auto size = static_cast<size_t>(m_size);
+    const auto rank = static_cast<size_t>(rank_id);
+    // spread the units evenly, the parts of two ranks differ by one unit at most and only the last unit may be partial
+    const size_t units = (len + unit - 1) / unit;
+    const size_t begin = std::min(len, units * rank / size * unit);
+    const size_t end = std::min(len, units * (rank + 1) / size * unit);
+    return {begin, end};
+}
+
+void TensorParallelComm::exchange(const void* send_buf,
+                                  const std::function<void(const std::vector<const void*>&)>& consume) {
+    const int id = m_sub_memory->get_memory_id(m_rank);
+    OPENVINO_ASSERT(id >= 0, "Tensor Parallel Config ID cannot be negative.");
+    m_sub_memory->set_memory_used(id, m_rank);
+    // wait until all the ranks consumed the previous exchange using the same buffer id
+    while (true) {
+        std::lock_guard<std::mutex> lock(m_sub_memory->_flagMutex);
+        if (m_sub_memory->_use_count[id] == m_size) {
+            m_sub_memory->_use_count[id] = 0;
+            for (int i = 0; i < m_size; i++) {
+                m_sub_memory->_memorys_table[id][i].flag = false;
+            }
+        }
+        if (m_sub_memory->_use_count[id] == 0) {
+            break;
+        }
+    }
+
+    auto& table = m_sub_memory->_memorys_table[id];
+    {
+        std::lock_guard<std::mutex> lock(m_sub_memory->_flagMutex);
+        table[m_rank].send_buf = const_cast<void*>(send_buf);
+        table[m_rank].flag = true;
+    }
+
+    std::vector<const void*> bufs(m_size, nullptr);
+    while (true) {
+        std::lock_guard<std::mutex> lock(m_sub_memory->_flagMutex);
+        int ready = 0;
+        for (int i = 0; i < m_size; i++) {
+            if (table[i].flag) {
+                bufs[i] = table[i].send_buf;
+                ready++;
+            }
+        }
+        if (ready == m_size) {
+            break;
+        }
+    }
+
+    consume(bufs);
+
+    std::lock_guard<std::mutex> lock(m_sub_memory->_flagMutex);
+    m_sub_memory->_use_count[id]++;
+}
+
+void TensorParallelComm::all_gather(const void* src,
+                                    void* dst,
+                                    size_t outer,
+                                    size_t items,
+                                    size_t unit,
+                                    size_t item_bytes) {
+    const size_t row_bytes = items * item_bytes;
+    exchange(src, [&](const std::vector<const void*>& bufs) {
+        for (int r = 0; r < m_size; r++) {
+            const auto [begin, end] = part_of(r, items, unit);
+            const size_t copy_bytes = (end - begin) * item_bytes;
+            const auto* src_ptr = static_cast<const uint8_t*>(bufs[r]);
+            auto* dst_ptr = static_cast<uint8_t*>(dst) + begin * item_bytes;
+            m_cpu_parallel->parallel_for(outer, [&](size_t i) {
+                cpu_memcpy(dst_ptr + i * row_bytes, src_ptr + i * copy_bytes, copy_bytes);
+            });
+        }
+    });
+}
+
+MemoryPtr slice_memory_view(const dnnl::engine& eng, const MemoryPtr& mem, size_t axis, size_t begin, size_t end) {
+    const auto desc = mem->getDescWithType<BlockedMemoryDesc>();
+    auto dims = mem->getStaticDims();
+    const auto& order = desc->getOrder();
+    const auto& strides = desc->getStrides();
+    OPENVINO_ASSERT(order.size() == dims.size() && axis < dims.size() && begin <= end && end <= dims[axis],
+                    "Cannot slice [",
+                    begin,
+                    ", ",
+                    end,
+                    ") along axis ",
+                    axis,
+                    " of a blocked memory");
+
+    dims[axis] = end - begin;
+    VectorDims blocked_dims(order.size());
+    size_t offset = 0;
+    for (size_t i = 0; i < order.size(); i++) {
+        blocked_dims[i] = dims[order[i]];
+        if (order[i] == axis) {
+            offset = begin * strides[i];
+        }
+    }
+    const auto prec = desc->getPrecision();
+    // strides are in elements, sub-byte precisions (u4/u3 caches) pack several elements per byte
+    const size_t offset_bits = offset * prec.bitwidth();
+    OPENVINO_ASSERT(offset_bits % 8 == 0,
+                    "Cannot slice [",
+                    begin,
+                    ", ",
+                    end,
+                    ") along axis ",
+                    axis,
+                    " of a ",
+                    prec,
+                    " memory at a non byte aligned offset");
+    auto new_desc =
+        std::make_shared<CpuBlockedMemoryDesc>(prec, Shape(dims), blocked_dims, order, 0, VectorDims{}, strides);
+    auto* data = static_cast<uint8_t*>(mem->getData()) + offset_bits / 8;
+    return std::make_shared<Memory>(eng, new_desc, data, false);
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_parallel.hpp"
+#include "graph_context.h"
+#include "sub_memory_manager.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Communicator of a node run by the sub-streams of MODEL_DISTRIBUTION_POLICY=TENSOR_PARALLEL, one sub-stream (rank)
+ * per socket. Every rank executes the whole graph, a node using the communicator computes only the part of the result
+ * owned by its rank and exchanges the parts with the other ranks through the double-buffered table of
+ * SubMemoryManager, following the same protocol as FullyConnected.
+ */
+class TensorParallelComm {
+public:
+    TensorParallelComm() = default;
+    explicit TensorParallelComm(const GraphContext::CPtr& context);
+
+    [[nodiscard]] bool enabled() const {
+        return m_size > 1;
+    }
+    [[nodiscard]] int rank() const {
+        return m_rank;
+    }
+    [[nodiscard]] int size() const {
+        return m_size;
+    }
+    [[nodiscard]] const CpuParallelPtr& cpu_parallel() const {
+        return m_cpu_parallel;
+    }
+
+    // Range [begin, end) of the rank in `len` items split evenly in units of `unit` items, the parts differ by one unit
+    // at most and only the last one may end with a partial unit. Ranks get an empty range when there are fewer units
+    // than ranks.
+    [[nodiscard]] std::pair<size_t, size_t> part(size_t len, size_t unit = 1) const;
+
+    // Publishes `send_buf` of the rank and calls `consume` with the buffers of all the ranks, indexed by rank, once all
+    // of them are published. `send_buf` must stay valid until the next exchange of the rank.
+    void exchange(const void* send_buf, const std::function<void(const std::vector<const void*>&)>& consume);
+
+    // Concatenates the parts of all the ranks into `dst` viewed as dense [outer, items, item_bytes]. The rank owns the
+    // items part(items, unit) and provides them in `src` as dense [outer, part size, item_bytes].
+    void all_gather(const void* src, void* dst, size_t outer, size_t items, size_t unit, size_t item_bytes);
+
+private:
+    [[nodiscard]] std::pair<size_t, size_t> part_of(int rank, size_t len, size_t unit) const;
+
+    std::shared_ptr<SubMemoryManager> m_sub_memory;
+    CpuParallelPtr m_cpu_parallel;
+    int m_rank = 0;
+    int m_size = 1;
+};
+
+// View of the [begin, end) slice of the plain `mem` along `axis`, shares the data of `mem`
+MemoryPtr slice_memory_view(const dnnl::engine& eng, const MemoryPtr& mem, size_t axis, size_t begin, size_t end);
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <common/primitive_hashing.hpp>
+#include <common/utils.hpp>
+#include <cstddef>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "cache/multi_cache.h"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief oneDNN primitive compiled for a primitive descriptor. The primitive takes a user provided scratchpad and is
+ * executed on the stream of the caller, so one compiled primitive may be executed by several streams at a time.
+ */
+struct DnnlCompiledPrimitive {
+    dnnl::primitive_desc primDesc;
+    dnnl::primitive prim;
+};
+
+using DnnlCompiledPrimitivePtr = std::shared_ptr<const DnnlCompiledPrimitive>;
+
+template <>
+struct SharedCacheValue<DnnlCompiledPrimitivePtr> : std::true_type {};
+
+template <>
+struct CacheValueBytes<DnnlCompiledPrimitivePtr> {
+    static size_t get(const DnnlCompiledPrimitivePtr& value) {
+        const auto bytes = value->primDesc.query_s64(dnnl::query::memory_consumption_s64);
+        return bytes > 0 ? static_cast<size_t>(bytes) : 0;
+    }
+};
+
+/**
+ * @brief Key of a compiled primitive. The implementation priorities are a part of the key, since the compiled
+ * primitives are shared by the compiled models which may be configured with different priorities.
+ * @tparam Key is the key of the executor primitive, which describes the primitive descriptor
+ */
+template <typename Key>
+struct DnnlCompiledPrimitiveKey {
+    Key key;
+    std::vector<impl_desc_type> implPriorities;
+    impl_desc_type defaultImplType = impl_desc_type::undef;
+
+    [[nodiscard]] size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+
+        size_t seed = key.hash();
+        for (const auto implType : implPriorities) {
+            seed = hash_combine(seed, implType);
+        }
+        seed = hash_combine(seed, defaultImplType);
+
+        return seed;
+    }
+
+    bool operator==(const DnnlCompiledPrimitiveKey& rhs) const {
+        return key == rhs.key && implPriorities == rhs.implPriorities && defaultImplType == rhs.defaultImplType;
+    }
+};
+
+/**
+ * @brief Returns the compiled primitive from the cache or compiles it for the primitive descriptor created by the
+ * builder. The compiled primitives are kept in the shared cache when the runtime cache is shared.
+ */
+template <typename Key, typename PrimDescBuilder>
+DnnlCompiledPrimitivePtr getCompiledPrimitive(const MultiCachePtr& cache,
+                                              const Key& key,
+                                              const std::vector<impl_desc_type>& implPriorities,
+                                              impl_desc_type defaultImplType,
+                                              PrimDescBuilder createPrimDesc) {
+    auto builder = [&createPrimDesc](const DnnlCompiledPrimitiveKey<Key>& /*key*/) {
+        const dnnl::primitive_desc primDesc = createPrimDesc();
+        return std::make_shared<const DnnlCompiledPrimitive>(DnnlCompiledPrimitive{primDesc, dnnl::primitive(primDesc)});
+    };
+
+    const auto result = cache->getOrCreate(DnnlCompiledPrimitiveKey<Key>{key, implPriorities, defaultImplType}, builder);
+    return result.first;
+}
+
+}  // namespace ov::intel_cpu
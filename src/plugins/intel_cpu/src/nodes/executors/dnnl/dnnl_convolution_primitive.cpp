@@ -25,6 +25,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "dnnl_postops_composer.h"
@@ -33,6 +34,7 @@
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/convolution_config.hpp"
 #include "nodes/executors/dnnl/dnnl_aliases.hpp"
+#include "nodes/executors/dnnl/dnnl_compiled_primitive.hpp"
 #include "nodes/executors/dnnl/dnnl_fullyconnected_primitive.hpp"
 #include "nodes/executors/dnnl/dnnl_post_op_data.hpp"
 #include "nodes/executors/dnnl/dnnl_shape_agnostic_data.hpp"
@@ -890,7 +892,8 @@ std::shared_ptr<DnnlConvolutionPrimitive> DnnlConvolutionPrimitive::create(
                                                           context->getEngine(),
                                                           context->getThreadPool(),
                                                           context->getImplPriorities(),
-                                                          defaultImplType);
+                                                          defaultImplType,
+                                                          context->getRuntimeCache());
     };
 
     auto runtimeCache = context->getRuntimeCache();
@@ -1036,9 +1039,11 @@ DnnlConvolutionPrimitive::DnnlConvolutionPrimitive(const Key& key,
                                                    const dnnl::engine& engine,
                                                    const std::shared_ptr<ThreadPool>& threadPool,
                                                    const std::vector<impl_desc_type>& implPriorities,
-                                                   const impl_desc_type defaultImplType)
+                                                   const impl_desc_type defaultImplType,
+                                                   const MultiCachePtr& cache)
     : m_stream(make_stream(engine, threadPool)),
-      m_primDesc(createPrimitiveDesc(key.src->getDnnlDesc(),
+      m_compiled(getCompiledPrimitive(cache, key, implPriorities, defaultImplType, [&]() {
+          return createPrimitiveDesc(key.src->getDnnlDesc(),
                                      key.wei->getDnnlDesc(),
                                      key.bias->getDnnlDesc(),
                                      key.dst->getDnnlDesc(),
@@ -1050,13 +1055,15 @@ DnnlConvolutionPrimitive::DnnlConvolutionPrimitive(const Key& key,
                                      engine,
                                      key.fcSemantic,
                                      implPriorities,
-                                     defaultImplType)),
+                                     defaultImplType);
+      })),
+      m_primDesc(m_compiled->primDesc),
       m_implType(parse_impl_name(m_primDesc.impl_info_str())),
       m_srcDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.src_desc())),
       m_weiDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.weights_desc())),
       m_dstDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.dst_desc())),
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
-      m_prim(primitive(m_primDesc)),
+      m_prim(m_compiled->prim),
       m_intermediateReorders(key, m_primDesc, engine) {}
 
 }  // namespace ov::intel_cpu
@@ -18,6 +18,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_memory.h"
 #include "cpu_types.h"
@@ -28,6 +29,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/dnnl/dnnl_aliases.hpp"
+#include "nodes/executors/dnnl/dnnl_compiled_primitive.hpp"
 #include "nodes/executors/dnnl/dnnl_shape_agnostic_data.hpp"
 #include "nodes/executors/dnnl/dnnl_utils.hpp"
 #include "nodes/executors/executor.hpp"
@@ -111,7 +113,8 @@ std::shared_ptr<DnnlFCPrimitive> DnnlFCPrimitive::create(const MemoryArgs& memor
         return std::make_shared<DnnlFCPrimitive>(dnnlKey,
                                                  context->getEngine(),
                                                  context->getThreadPool(),
-                                                 context->getImplPriorities());
+                                                 context->getImplPriorities(),
+                                                 context->getRuntimeCache());
     };
 
     auto runtimeCache = context->getRuntimeCache();
@@ -496,24 +499,28 @@ static impl_desc_type implTypeFromPrimDesc(const dnnl::primitive_desc& primDesc)
 DnnlFCPrimitive::DnnlFCPrimitive(const Key& key,
                                  const dnnl::engine& engine,
                                  const std::shared_ptr<ThreadPool>& threadPool,
-                                 const std::vector<impl_desc_type>& implPriorities)
+                                 const std::vector<impl_desc_type>& implPriorities,
+                                 const MultiCachePtr& cache)
     : m_stream(make_stream(engine, threadPool)),
-      m_primDesc(createPrimitiveDesc(
-          key.src->getDnnlDesc(),
-          key.wei->getDnnlDesc(),
-          key.bias->getDnnlDesc(),
-          key.dst->getDnnlDesc(),
-          key.attr,
-          engine,
-          implPriorities,
-          key.sparseWeights,
-          useWeightsDecompressionImpl(key.src->getPrecision(), key.wei->getPrecision(), key.modelType))),
+      m_compiled(getCompiledPrimitive(cache, key, implPriorities, impl_desc_type::undef, [&]() {
+          return createPrimitiveDesc(
+              key.src->getDnnlDesc(),
+              key.wei->getDnnlDesc(),
+              key.bias->getDnnlDesc(),
+              key.dst->getDnnlDesc(),
+              key.attr,
+              engine,
+              implPriorities,
+              key.sparseWeights,
+              useWeightsDecompressionImpl(key.src->getPrecision(), key.wei->getPrecision(), key.modelType));
+      })),
+      m_primDesc(m_compiled->primDesc),
       m_implType(implTypeFromPrimDesc(m_primDesc)),
       m_srcDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.src_desc())),
       m_weiDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.weights_desc())),
       m_dstDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.dst_desc())),
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
-      m_prim(primitive(m_primDesc)) {}
+      m_prim(m_compiled->prim) {}
 
 void DnnlFCPrimitive::execute(const dnnl_primitive_args& primArgs) const {
     m_prim.execute(m_stream, primArgs);
@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
@@ -28,6 +29,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/dnnl/dnnl_aliases.hpp"
+#include "nodes/executors/dnnl/dnnl_compiled_primitive.hpp"
 #include "nodes/executors/dnnl/dnnl_shape_agnostic_data.hpp"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/fullyconnected_config.hpp"
@@ -139,7 +141,8 @@ std::shared_ptr<DnnlMatMulPrimitive> DnnlMatMulPrimitive::create(const MemoryArg
                                                      context->getEngine(),
                                                      context->getThreadPool(),
                                                      context->getImplPriorities(),
-                                                     defaultImplType);
+                                                     defaultImplType,
+                                                     context->getRuntimeCache());
     };
 
     auto runtimeCache = context->getRuntimeCache();
@@ -607,9 +610,11 @@ DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
                                          const dnnl::engine& engine,
                                          const std::shared_ptr<ThreadPool>& threadPool,
                                          const std::vector<impl_desc_type>& implPriorities,
-                                         const impl_desc_type defaultImplType)
+                                         const impl_desc_type defaultImplType,
+                                         const MultiCachePtr& cache)
     : m_stream(make_stream(engine, threadPool)),
-      m_primDesc(createPrimitiveDesc(key.src->getDnnlDesc(),
+      m_compiled(getCompiledPrimitive(cache, key, implPriorities, defaultImplType, [&]() {
+          return createPrimitiveDesc(key.src->getDnnlDesc(),
                                      key.wei->getDnnlDesc(),
                                      key.bias->getDnnlDesc(),
                                      key.dst->getDnnlDesc(),
@@ -621,13 +626,15 @@ DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
                                      key.transposeB,
                                      false,
                                      useWeightsDecompressionImpl(key.src->getPrecision(), key.wei->getPrecision()),
-                                     key.fcSemantic)),
+                                     key.fcSemantic);
+      })),
+      m_primDesc(m_compiled->primDesc),
       m_implType(implTypeFromPrimDesc(m_primDesc)),
       m_srcDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.src_desc())),
       m_weiDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.weights_desc())),
       m_dstDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.dst_desc())),
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
-      m_prim(primitive(m_primDesc)) {}
+      m_prim(m_compiled->prim) {}
 
 void DnnlMatMulPrimitive::execute(const dnnl_primitive_args& primArgs) const {
     m_prim.execute(m_stream, primArgs);
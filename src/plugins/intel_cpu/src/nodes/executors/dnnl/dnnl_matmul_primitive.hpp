@@ -10,8 +10,10 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "nodes/executors/dnnl/dnnl_aliases.hpp"
+#include "nodes/executors/dnnl/dnnl_compiled_primitive.hpp"
 #include "nodes/executors/dnnl/dnnl_shape_agnostic_data.hpp"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/fullyconnected_config.hpp"
@@ -44,7 +46,8 @@ public:
                         const dnnl::engine& engine,
                         const std::shared_ptr<ThreadPool>& threadPool,
                         const std::vector<impl_desc_type>& implPriorities,
-                        impl_desc_type defaultImplType);
+                        impl_desc_type defaultImplType,
+                        const MultiCachePtr& cache);
 
     void execute(const dnnl_primitive_args& primArgs) const;
 
@@ -91,6 +94,8 @@ public:
 
 private:
     dnnl::stream m_stream;
+    // shared by the streams, when the runtime cache is shared
+    DnnlCompiledPrimitivePtr m_compiled;
     dnnl::primitive_desc m_primDesc;
     impl_desc_type m_implType;
     DnnlMemoryDescPtr m_srcDesc;
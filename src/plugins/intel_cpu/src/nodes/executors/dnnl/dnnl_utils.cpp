@@ -7,6 +7,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -22,6 +23,7 @@
 #include "nodes/reorder.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "packed_weights.hpp"
 #include "thread_pool_imp.hpp"
 #include "weights_cache.hpp"
 
@@ -63,7 +65,11 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
         }
     }
 
-    auto create = [&]() {
+    // captures by value, since it is also used to restore the evicted weights (see WeightsSharing::use)
+    auto fill = [eng, srcWeightDesc, dstWeightDesc, weightsMem, needShiftSignedToUnsigned](
+                    const IMemory& dst,
+                    const MultiCachePtr& cache,
+                    const std::shared_ptr<ThreadPool>& pool) {
         // https://oneapi-src.github.io/oneDNN/dev_guide_int8_computations.html?highlight=128#inputs-of-the-same-type-s8
         auto src_wdt = srcWeightDesc->getPrecision();
         auto dst_wdt = dstWeightDesc->getPrecision();
@@ -73,18 +79,17 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
             // prevent reorderData from doing conversion
             Memory srcMemory{eng, srcWeightDesc->cloneWithNewPrecision(dst_wdt), weightsMem->getData()};
-            MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
-            node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
+            node::Reorder::reorderData(srcMemory, dst, cache, pool);
 
             // do shift
-            auto count = _ptr->getSize() / _ptr->getDesc().getPrecision().size();
+            auto count = dst.getSize() / dst.getDesc().getPrecision().size();
             if (dst_wdt == ov::element::u8) {
-                auto* data = _ptr->getDataAs<uint8_t>();
+                auto* data = dst.getDataAs<uint8_t>();
                 for (size_t i = 0; i < count; i++) {
                     data[i] = data[i] + 128;
                 }
             } else if (dst_wdt == ov::element::u4) {
-                auto* data = _ptr->getDataAs<uint8_t>();
+                auto* data = dst.getDataAs<uint8_t>();
                 for (size_t i = 0; i < count; i++) {
                     auto low = (data[i] & 0xF) + 8;
                     auto high = (data[i] >> 4) + 8;
@@ -93,13 +98,49 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
             } else {
                 OPENVINO_THROW("Unsupported data type for shiftting sign to unsign");
             }
-            return _ptr;
+            return;
         }
 
         Memory srcMemory{eng, srcWeightDesc, weightsMem->getData()};
+        node::Reorder::reorderData(srcMemory, dst, cache, pool);
+    };
+
+    auto create = [&]() {
         MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
+        fill(*_ptr, rtCache, threadPool);
+        return _ptr;
+    };
 
+    // the shared weights may be evicted under the weights cache budget and restored by repacking them again
+    auto createEvictable = [&]() {
+        auto _ptr = create();
+        globalWeightCache->registerEvictable(_ptr, [fill](const IMemory& dst) {
+            fill(dst, nullptr, nullptr);
+        });
+        return _ptr;
+    };
+
+    // reuses the weights repacked in advance and stored in the model cache, if any
+    auto createOrLoad = [&]() -> MemoryPtr {
+        const auto sourceName = globalWeightCache->getSourceName(weightsMem->getData());
+        if (sourceName.empty()) {
+            return createEvictable();
+        }
+        const auto key = DnnlExtensionUtils::computeWeightsPersistentKey(sourceName, dstWeightDesc);
+        const auto size = dstWeightDesc->getCurrentMemSize();
+        MemoryPtr _ptr;
+        if (const auto* packed = globalWeightCache->findPacked(key, size)) {
+            if (reinterpret_cast<uintptr_t>(packed) % PackedWeights::alignment == 0) {
+                _ptr = std::make_shared<Memory>(eng, dstWeightDesc, packed, false);
+            } else {
+                _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
+                std::memcpy(_ptr->getData(), packed, size);
+            }
+        } else {
+            _ptr = createEvictable();
+        }
+        // the loaded weights are remembered too, so the model exported again keeps them
+        globalWeightCache->addPacked(sourceName, key, _ptr);
         return _ptr;
     };
 
@@ -107,7 +148,7 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
         ptr = MemoryPtr(
             *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+                                             createOrLoad));
     } else {
         ptr = create();
     }
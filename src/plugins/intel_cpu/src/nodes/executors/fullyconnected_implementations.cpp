@@ -27,6 +27,9 @@
 #include "nodes/executors/precision_matcher.hpp"
 #include "nodes/executors/precision_translation.hpp"
 #include "nodes/executors/type_mask.hpp"
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/decompression_fullyconnected.hpp"
+#endif
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "utils/arch_macros.h"
@@ -93,6 +96,11 @@ static const TypeMapping dnnlFCTypeMapping {
     // @todo explicitly cover configuration limitations for oneDNN on ARM
 };
 
+static const TypeMapping decompressionFCTypeMapping {
+    // {src, wei, bia, dst}                                    pt<src, wei, bias, dst>
+    {{_any, _u3 | _u6 | _f8e4m3 | _f8e5m2, _any, _any},        {just<f32>(), bypass(), just<f32>(), just<f32>()}},
+};
+
 static const TypeMapping aclFCTypeMapping {
     // {src, wei, bia, dst}                  pt<src, wei, bias, dst>
     {{_f32 | _f16, _f32 | _f16, _any, _any}, {bypass(), bypass(), use<0>(), use<0>()}},
@@ -186,6 +194,26 @@ struct CreateOptimalConfigDefault {
 template <>
 const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<FCAttrs>> fullyconnectedImplementations {
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_decompression",
+            ExecutorType::Jit,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(any_of(weiType(config), u3, u6, f8e4m3, f8e5m2), UNSUPPORTED_WEI_PRECISIONS);
+                VERIFY(DecompressionFCExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+                return true;
+            },
+            // createOptimalConfig
+            [](const FCConfig& config) -> std::optional<executor::Config<FCAttrs>> {
+                return createOptimalConfigCommon(config,
+                                                 decompressionFCTypeMapping,
+                                                 dnnlFCLayoutConfig,
+                                                 fcMappingNotation);
+            },
+            AcceptsAnyShape<FCAttrs>,
+            CreateDefault<DecompressionFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_MLAS_X64(
             "fullyconnected_mlas",
             ExecutorType::Mlas,
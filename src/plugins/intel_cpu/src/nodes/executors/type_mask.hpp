@@ -36,6 +36,8 @@ struct TypeMask {
         _f4e2m1 = 1 << 21,
         _f8e8m0 = 1 << 22,
         _u2 = 1 << 23,
+        _u3 = 1 << 24,
+        _u6 = 1 << 25,
     };
 
     explicit TypeMask(const ov::element::Type precision) : value(generateMask(precision)), precision(precision) {}
@@ -84,6 +86,8 @@ private:
             CASE(f4e2m1)
             CASE(f8e8m0)
             CASE(u2)
+            CASE(u3)
+            CASE(u6)
         default:
             return _dynamic;
         }
@@ -119,6 +123,8 @@ DEFINE_TYPE_ALIAS(_string);
 DEFINE_TYPE_ALIAS(_f4e2m1);
 DEFINE_TYPE_ALIAS(_f8e8m0);
 DEFINE_TYPE_ALIAS(_u2);
+DEFINE_TYPE_ALIAS(_u3);
+DEFINE_TYPE_ALIAS(_u6);
 constexpr auto _any_float = _f64 | _f32 | _f16 | _bf16;
 constexpr auto _hw_float = _f32 | _f16 | _bf16;
 constexpr auto _half_float = _f16 | _bf16;
@@ -0,0 +1,290 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "decompression_fullyconnected.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "dnnl_scratch_pad.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/fc_weights_decompression.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float8_e4m3.hpp"
+#include "openvino/core/type/float8_e5m2.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace executor;
+using namespace ov::element;
+
+// the kernels decompress the weights by blocks of 64 values and dequantize them by chunks of 16 values
+static constexpr size_t weightsBlock = 64;
+static constexpr size_t groupSizeAlignment = 16;
+// starting from this number of tokens the weights are decompressed by tiles for the blocked GEMM
+static constexpr size_t blockedGemmMinM = 8;
+// the decompressed tile is sized for L2, its rows are a multiple of the output channels of the GEMM micro tile
+static constexpr size_t tileBytes = 256 * 1024;
+static constexpr size_t tileRowsAlignment = 4;
+static constexpr size_t maxTileRows = 64;
+
+static Dim batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1U, Dim{1}, std::multiplies<>());
+}
+
+static bool isSplitBit(const ov::element::Type& type) {
+    return any_of(type, u3, u6);
+}
+
+static size_t rowBytes(const ov::element::Type& type, size_t K) {
+    return K * type.bitwidth() / 8;
+}
+
+static MemoryCPtr prepareWeightMemory(const MemoryPtr& weightsMemory, const ExecutorContext::CPtr& context) {
+    const auto precision = weightsMemory->getPrecision();
+    if (!isSplitBit(precision)) {
+        return weightsMemory;
+    }
+
+    const auto& wgtDims = weightsMemory->getStaticDims();
+    const Dim K = wgtDims.back();
+    const Dim N = batchDim(wgtDims);
+    const size_t bytes = rowBytes(precision, K);
+
+    auto create = [&]() {
+        DEBUG_LOG("DecompressionFCExecutor: cache miss, perform packing");
+        MemoryPtr packed =
+            std::make_shared<Memory>(context->getEngine(), CpuBlockedMemoryDesc(u8, intel_cpu::Shape{N * bytes}));
+        const auto* src = weightsMemory->getDataAs<const uint8_t>();
+        auto* dst = packed->getDataAs<uint8_t>();
+        context->getCpuParallel()->parallel_for(N, [&](size_t n) {
+            ov::Extensions::Cpu::XARCH::fc_pack_split_bit(src + n * bytes, precision, K, dst + n * bytes);
+        });
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = "decompression_fc_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                        std::to_string(weightsMemory->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        DEBUG_LOG("DecompressionFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    DEBUG_LOG("DecompressionFCExecutor: Weights cache is not available");
+    return create();
+}
+
+static std::vector<float> toF32(const MemoryCPtr& memory) {
+    const size_t count = memory->getShape().getElementsCount();
+    std::vector<float> values(count);
+    cpu_convert(memory->getData(), values.data(), memory->getPrecision(), f32, count);
+    return values;
+}
+
+bool DecompressionFCExecutor::supports(const FCConfig& config) {
+    VERIFY(any_of(weiType(config), u3, u6, f8e4m3, f8e5m2), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(config.attrs.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(config.attrs.dqScales.empty(), UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(!config.attrs.weightsNonTransposed, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+    const auto& weiDims = config.descs.at(ARG_WEI)->getShape().getDims();
+    VERIFY(weiDims.back() != Shape::UNDEFINED_DIM && weiDims.back() % weightsBlock == 0, UNSUPPORTED_BY_EXECUTOR);
+    return true;
+}
+
+DecompressionFCExecutor::DecompressionFCExecutor([[maybe_unused]] const FCAttrs& attrs,
+                                                 const MemoryArgs& memory,
+                                                 const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      m_context(context),
+      m_weiType(memory.at(ARG_WEI)->getPrecision()),
+      m_weights(prepareWeightMemory(memory.at(ARG_WEI), context)),
+      N(batchDim(memory.at(ARG_WEI)->getStaticDims())),
+      K(memory.at(ARG_WEI)->getStaticDims().back()),
+      m_nthreads(parallel_get_max_threads()) {
+    if (auto it = memory.find(ARG_WEI | ARG_ATTR_SCALES); it != memory.end()) {
+        m_scales = toF32(it->second);
+    } else {
+        m_scales.assign(N, 1.0F);
+    }
+    if (m_scales.size() == 1) {
+        m_scales.assign(N, m_scales.front());
+    }
+    OPENVINO_ASSERT(m_scales.size() % N == 0,
+                    "DecompressionFCExecutor: unexpected number of the decompression scales");
+    const size_t groups = m_scales.size() / N;
+    OPENVINO_ASSERT(K % groups == 0 && (K / groups) % groupSizeAlignment == 0,
+                    "DecompressionFCExecutor: unsupported decompression group size");
+    m_groupSize = K / groups;
+
+    if (auto it = memory.find(ARG_WEI | ARG_ATTR_ZERO_POINTS); it != memory.end()) {
+        OPENVINO_ASSERT(isSplitBit(m_weiType),
+                        "DecompressionFCExecutor: zero points are not supported for ",
+                        m_weiType,
+                        " weights");
+        auto zeroPoints = toF32(it->second);
+        if (zeroPoints.size() == 1) {
+            m_zeroPoints = std::move(zeroPoints);
+            m_zpStride = 0;
+        } else {
+            // align the zero points with the groups of the scales
+            OPENVINO_ASSERT(zeroPoints.size() % N == 0 && groups % (zeroPoints.size() / N) == 0,
+                            "DecompressionFCExecutor: unsupported decompression zero points shape");
+            const size_t zpGroups = zeroPoints.size() / N;
+            m_zeroPoints.resize(N * groups);
+            for (size_t n = 0; n < N; n++) {
+                for (size_t g = 0; g < groups; g++) {
+                    m_zeroPoints[n * groups + g] = zeroPoints[n * zpGroups + g * zpGroups / groups];
+                }
+            }
+            m_zpStride = 1;
+        }
+    }
+
+    if (m_weiType == f8e4m3) {
+        for (size_t code = 0; code < m_lut.size(); code++) {
+            m_lut[code] = static_cast<float>(ov::float8_e4m3::from_bits(static_cast<uint8_t>(code)));
+        }
+    } else if (m_weiType == f8e5m2) {
+        for (size_t code = 0; code < m_lut.size(); code++) {
+            m_lut[code] = static_cast<float>(ov::float8_e5m2::from_bits(static_cast<uint8_t>(code)));
+        }
+    }
+
+    const size_t tileRows = tileBytes / (K * sizeof(float));
+    m_tileRows = std::clamp(tileRows - tileRows % tileRowsAlignment, tileRowsAlignment, maxTileRows);
+}
+
+bool DecompressionFCExecutor::update(const MemoryArgs& memory) {
+    const auto& outDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = batchDim(outDims);
+    // a few tokens need only one decompressed row per thread
+    const size_t rows = M < blockedGemmMinM ? 1 : m_tileRows;
+    auto scratchDesc =
+        std::make_shared<CpuBlockedMemoryDesc>(f32, intel_cpu::Shape{static_cast<size_t>(m_nthreads), rows * K});
+    m_scratchMem = m_context->getScratchPad()->createScratchPadMem(scratchDesc);
+    return true;
+}
+
+void DecompressionFCExecutor::decompressRow(size_t n, float* dst) const {
+    const auto* weights = m_weights->getDataAs<const uint8_t>() + n * rowBytes(m_weiType, K);
+    const size_t groups = K / m_groupSize;
+    const float* scales = m_scales.data() + n * groups;
+    if (!isSplitBit(m_weiType)) {
+        ov::Extensions::Cpu::XARCH::fc_decompress_lut(weights, m_lut.data(), K, m_groupSize, scales, dst);
+        return;
+    }
+    const float* zeroPoints = m_zeroPoints.empty() ? nullptr : m_zeroPoints.data() + n * groups * m_zpStride;
+    ov::Extensions::Cpu::XARCH::fc_decompress_split_bit(weights,
+                                                        m_weiType,
+                                                        K,
+                                                        m_groupSize,
+                                                        scales,
+                                                        zeroPoints,
+                                                        m_zpStride,
+                                                        dst);
+}
+
+void DecompressionFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto& biasMemory = memory.at(ARG_BIAS);
+    const auto* bias = biasMemory->getDesc().empty() ? nullptr : biasMemory->getDataAs<const float>();
+
+    auto* scratch = m_scratchMem->getDataAs<float>();
+
+    if (M < blockedGemmMinM) {
+        executeByRows(src, bias, dst, scratch);
+    } else {
+        executeByTiles(src, bias, dst, scratch);
+    }
+}
+
+void DecompressionFCExecutor::executeByRows(const float* src, const float* bias, float* dst, float* scratch) {
+    parallel_nt_static(m_nthreads, [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(N, nthr, ithr, start, end);
+        float* row = scratch + static_cast<size_t>(ithr) * K;
+        for (size_t n = start; n < end; n++) {
+            // the row is decompressed once and reused by all the tokens
+            decompressRow(n, row);
+            const float b = bias ? bias[n] : 0.0F;
+            for (size_t m = 0; m < M; m++) {
+                dst[m * N + n] = ov::Extensions::Cpu::XARCH::fc_dot(src + m * K, row, K) + b;
+            }
+        }
+    });
+}
+
+void DecompressionFCExecutor::executeByTiles(const float* src, const float* bias, float* dst, float* scratch) {
+    const size_t tiles = div_up(N, m_tileRows);
+    parallel_nt_static(m_nthreads, [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(tiles, nthr, ithr, start, end);
+        float* tile = scratch + static_cast<size_t>(ithr) * m_tileRows * K;
+        for (size_t t = start; t < end; t++) {
+            const size_t n0 = t * m_tileRows;
+            const size_t rows = std::min(m_tileRows, N - n0);
+            for (size_t r = 0; r < rows; r++) {
+                decompressRow(n0 + r, tile + r * K);
+            }
+            ov::Extensions::Cpu::XARCH::fc_gemm(src, tile, M, rows, K, dst + n0, N);
+            if (bias) {
+                for (size_t m = 0; m < M; m++) {
+                    for (size_t r = 0; r < rows; r++) {
+                        dst[m * N + n0 + r] += bias[n0 + r];
+                    }
+                }
+            }
+        }
+    });
+}
+
+impl_desc_type DecompressionFCExecutor::implType() const {
+    if (ov::with_cpu_x86_avx512f()) {
+        return impl_desc_type::gemm_avx512;
+    }
+    if (ov::with_cpu_x86_avx2()) {
+        return impl_desc_type::gemm_avx2;
+    }
+    return impl_desc_type::gemm_any;
+}
+
+void DecompressionFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(m_weights, numaNodeID);
+    if (!m_memoryArgs.at(ARG_BIAS)->getDesc().empty()) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * FullyConnected with the compressed weights which oneDNN cannot decompress on the fly:
+ * - u3/u6, the native path for the GGUF K-quants (Q3_K, Q5_K, Q6_K)
+ * - f8e4m3/f8e5m2 with per-channel or per-block scales, including the f8e8m0 block scales of the MX formats
+ * The weights of every output channel are decompressed into f32 right before use, so the weights are read from
+ * memory in their compressed precision. A few tokens are multiplied by one decompressed output channel at a time, a
+ * larger batch by the tiles of the output channels which are decompressed once and stay in the cache for the blocked
+ * GEMM over all the tokens.
+ */
+class DecompressionFCExecutor : public Executor {
+public:
+    DecompressionFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    void decompressRow(size_t n, float* dst) const;
+    void executeByRows(const float* src, const float* bias, float* dst, float* scratch);
+    void executeByTiles(const float* src, const float* bias, float* dst, float* scratch);
+
+    const MemoryArgs& m_memoryArgs;
+    const ExecutorContext::CPtr m_context;
+    const ov::element::Type m_weiType;
+    // u3/u6 weights are repacked into the blocked layout, f8 weights are used as is
+    const MemoryCPtr m_weights;
+    const size_t N;
+    const size_t K;
+    size_t M = 0;
+    size_t m_groupSize = 0;
+    // decompression scales [N, groups] and zero points: [N, groups], per tensor or none
+    std::vector<float> m_scales;
+    std::vector<float> m_zeroPoints;
+    size_t m_zpStride = 0;
+    // f8 values of all the 256 codes
+    std::array<float, 256> m_lut{};
+    const int m_nthreads;
+    // output channels of the tile decompressed for the blocked GEMM
+    size_t m_tileRows = 1;
+    // decompressed weights per thread, one row by rows or one tile by tiles, in the scratchpad shared by the graph
+    MemoryPtr m_scratchMem;
+    int curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
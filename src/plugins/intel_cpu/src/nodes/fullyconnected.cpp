@@ -71,8 +71,15 @@ ov::element::TypeVector FullyConnected::getSupportedCompressedWeightsTypes([[may
         return {Type_t::u8, Type_t::i8};
     }
 #if defined(OPENVINO_ARCH_X86_64)
-    ov::element::TypeVector supportedDataTypes =
-        {Type_t::u8, Type_t::i8, Type_t::u4, Type_t::i4, Type_t::nf4, Type_t::f4e2m1, Type_t::u2};
+    ov::element::TypeVector supportedDataTypes = {Type_t::u8,
+                                                  Type_t::i8,
+                                                  Type_t::u4,
+                                                  Type_t::i4,
+                                                  Type_t::nf4,
+                                                  Type_t::f4e2m1,
+                                                  Type_t::u2,
+                                                  Type_t::u3,
+                                                  Type_t::u6};
     if (apply_fp8) {
         supportedDataTypes.insert(supportedDataTypes.end(), {Type_t::f8e4m3, Type_t::f8e5m2});
     }
@@ -178,6 +185,20 @@ bool FullyConnected::isSupportedCompressedOperation([[maybe_unused]] const std::
         if (op->get_input_partial_shape(WEIGHTS).rank().get_length() == 3) {
             return false;
         }
+
+        // u3/u6 and f8 weights are decompressed by blocks of 64 values and by groups of a multiple of 16 values
+        const auto weightsType = op->get_input_element_type(WEIGHTS);
+        if (any_of(weightsType, ov::element::u3, ov::element::u6, ov::element::f8e4m3, ov::element::f8e5m2) &&
+            (IC % 64 != 0 || (IC / G) % 16 != 0)) {
+            return false;
+        }
+
+        // f8 weights are dequantized by scales only
+        const bool hasZeroPoints = op->get_input_size() > WEIGHT_ZERO_POINTS &&
+                                   op->input(WEIGHT_ZERO_POINTS).get_element_type() != ov::element::dynamic;
+        if (any_of(weightsType, ov::element::f8e4m3, ov::element::f8e5m2) && hasZeroPoints) {
+            return false;
+        }
     } catch (...) {
         return false;
     }
@@ -437,6 +458,14 @@ void FullyConnected::executeDynamicImpl(const dnnl::stream& strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the executor of u3/u6 and f8 compressed weights does not support post ops
+    if (any_of(getOriginalInputPrecisionAtPort(WEIGHTS),
+               ov::element::u3,
+               ov::element::u6,
+               ov::element::f8e4m3,
+               ov::element::f8e5m2)) {
+        return false;
+    }
     if (node->getType() == Type::FakeQuantize) {
         auto* fq = dynamic_cast<FakeQuantize*>(node.get());
         if (!fq) {
@@ -34,6 +34,7 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/read_value.hpp"
@@ -41,6 +42,7 @@
 #include "shape_inference/shape_inference_pass_through.hpp"
 #include "transformations/cpu_opset/common/op/read_value_with_subgraph.hpp"
 #include "utils/general_utils.h"
+#include "weights_cache.hpp"
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include <xbyak/xbyak.h>
@@ -587,6 +589,21 @@ void Input::cloneBlobIfRequired() {
                     ? std::make_shared<Memory>(getEngine(), memDesc, m_constOp->get_data_ptr())
                     : std::const_pointer_cast<const IMemory>(
                           weightCache ? MemoryPtr(*weightCache->findOrCreate(blobKey(), cloneBlob)) : cloneBlob());
+    // the repacked weights stored in the model cache are identified by the origin of the constant data in the weights
+    // file, as the friendly names are not unique. The origin is kept by the exported model, while the source id is
+    // not stable: the data is read from the weights file on export and from the cache blob on import. The constants
+    // created by the transformations have no origin, so their weights are repacked on import.
+    if (weightCache && prec != element::string &&
+        (context->getConfig().cachePackedWeights || weightCache->hasPackedWeights())) {
+        if (const auto origin = ov::weight_sharing::Extension::get_constant_origin(*m_constOp)) {
+            std::string source = std::to_string(origin->m_offset) + "_" + std::to_string(origin->m_size) + "_" +
+                                 origin->m_type.to_string() + "_" + m_constOp->get_element_type().to_string();
+            for (const auto dim : m_constOp->get_shape()) {
+                source += "_" + std::to_string(dim);
+            }
+            weightCache->registerSource(memoryPtr, source);
+        }
+    }
 }
 
 static std::vector<Shape> createInputShapes(const Shape& shape, const Type type) {
@@ -0,0 +1,341 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "fc_weights_decompression.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/type/element_type.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+constexpr size_t block_size = 64;
+
+// The OpenVINO layout keeps 4 u6 (8 u3) values in 3 bytes: the low bits of the values in the first two bytes, read
+// as big endian with the first value in the most significant bits, and the high bits in the third byte.
+uint8_t get_split_bit(const uint8_t* src, size_t i, bool u6) {
+    const size_t values = u6 ? 4 : 8;
+    const uint8_t* bytes = src + (i / values) * 3;
+    const size_t shift = values - 1 - i % values;
+    const auto low_bits = static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
+    if (u6) {
+        return static_cast<uint8_t>(((low_bits >> (4 * shift)) & 0xF) | (((bytes[2] >> (2 * shift)) & 0x3) << 4));
+    }
+    return static_cast<uint8_t>(((low_bits >> (2 * shift)) & 0x3) | (((bytes[2] >> shift) & 0x1) << 2));
+}
+
+void unpack_block_u6(const uint8_t* src, uint8_t* q) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    const __m256i high =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + block_size / 2)));
+    const __m256i mask_low = _mm256_set1_epi8(0x0F);
+    const __m256i mask_high = _mm256_set1_epi8(0x03);
+    // q[0..15], q[16..31] take the high bits from the bits 0-1, 2-3 of the high plane,
+    // q[32..47], q[48..63] from the bits 4-5, 6-7
+    const __m256i high0 =
+        _mm256_and_si256(_mm256_srlv_epi32(high, _mm256_setr_epi32(0, 0, 0, 0, 2, 2, 2, 2)), mask_high);
+    const __m256i high1 =
+        _mm256_and_si256(_mm256_srlv_epi32(high, _mm256_setr_epi32(4, 4, 4, 4, 6, 6, 6, 6)), mask_high);
+    const __m256i q0 = _mm256_or_si256(_mm256_and_si256(low, mask_low), _mm256_slli_epi16(high0, 4));
+    const __m256i q1 =
+        _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(low, 4), mask_low), _mm256_slli_epi16(high1, 4));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(q), q0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(q + block_size / 2), q1);
+#else
+    const uint8_t* high = src + block_size / 2;
+    for (size_t i = 0; i < block_size; i++) {
+        const uint8_t low_bits = (src[i % 32] >> (4 * (i / 32))) & 0xF;
+        const uint8_t high_bits = (high[i % 16] >> (2 * (i / 16))) & 0x3;
+        q[i] = static_cast<uint8_t>(low_bits | (high_bits << 4));
+    }
+#endif
+}
+
+void unpack_block_u3(const uint8_t* src, uint8_t* q) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i high8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 16));
+    // q[j + 8 * i] takes the high bit from the bit i of the byte j of the high plane: move the odd bits
+    // into the upper 8 bytes, so q[16 * t .. 16 * t + 15] take the bit 2 * t of each byte
+    const __m128i high = _mm_unpacklo_epi64(high8, _mm_srli_epi16(high8, 1));
+    const __m128i mask_low = _mm_set1_epi8(0x03);
+    const __m128i mask_high = _mm_set1_epi8(0x01);
+    auto store = [&](uint8_t* dst, __m128i low_bits, __m128i high_bits) {
+        const __m128i value = _mm_or_si128(_mm_and_si128(low_bits, mask_low),
+                                           _mm_slli_epi16(_mm_and_si128(high_bits, mask_high), 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value);
+    };
+    store(q, low, high);
+    store(q + 16, _mm_srli_epi16(low, 2), _mm_srli_epi16(high, 2));
+    store(q + 32, _mm_srli_epi16(low, 4), _mm_srli_epi16(high, 4));
+    store(q + 48, _mm_srli_epi16(low, 6), _mm_srli_epi16(high, 6));
+#else
+    const uint8_t* high = src + 16;
+    for (size_t i = 0; i < block_size; i++) {
+        const uint8_t low_bits = (src[i % 16] >> (2 * (i / 16))) & 0x3;
+        const uint8_t high_bit = (high[i % 8] >> (i / 8)) & 0x1;
+        q[i] = static_cast<uint8_t>(low_bits | (high_bit << 2));
+    }
+#endif
+}
+
+}  // namespace
+
+void fc_pack_split_bit(const uint8_t* src, ov::element::Type type, size_t K, uint8_t* dst) {
+    const bool u6 = type == ov::element::u6;
+    const size_t block_bytes = block_size * type.bitwidth() / 8;
+    uint8_t q[block_size];
+    for (size_t k0 = 0; k0 < K; k0 += block_size) {
+        for (size_t i = 0; i < block_size; i++) {
+            q[i] = get_split_bit(src, k0 + i, u6);
+        }
+        uint8_t* block = dst + (k0 / block_size) * block_bytes;
+        if (u6) {
+            uint8_t* high = block + block_size / 2;
+            for (size_t j = 0; j < block_size / 2; j++) {
+                block[j] = static_cast<uint8_t>((q[j] & 0xF) | ((q[j + 32] & 0xF) << 4));
+            }
+            for (size_t j = 0; j < block_size / 4; j++) {
+                high[j] = static_cast<uint8_t>((q[j] >> 4) | ((q[j + 16] >> 4) << 2) | ((q[j + 32] >> 4) << 4) |
+                                               ((q[j + 48] >> 4) << 6));
+            }
+        } else {
+            uint8_t* high = block + block_size / 4;
+            for (size_t j = 0; j < block_size / 4; j++) {
+                block[j] = static_cast<uint8_t>((q[j] & 0x3) | ((q[j + 16] & 0x3) << 2) | ((q[j + 32] & 0x3) << 4) |
+                                                ((q[j + 48] & 0x3) << 6));
+            }
+            for (size_t j = 0; j < block_size / 8; j++) {
+                uint8_t bits = 0;
+                for (size_t i = 0; i < 8; i++) {
+                    bits |= static_cast<uint8_t>(((q[j + 8 * i] >> 2) & 0x1) << i);
+                }
+                high[j] = bits;
+            }
+        }
+    }
+}
+
+void fc_decompress_split_bit(const uint8_t* packed,
+                             ov::element::Type type,
+                             size_t K,
+                             size_t group_size,
+                             const float* scales,
+                             const float* zero_points,
+                             size_t zp_stride,
+                             float* dst) {
+    const bool u6 = type == ov::element::u6;
+    const size_t block_bytes = block_size * type.bitwidth() / 8;
+    alignas(64) uint8_t q[block_size];
+    for (size_t k0 = 0; k0 < K; k0 += block_size) {
+        const uint8_t* block = packed + (k0 / block_size) * block_bytes;
+        if (u6) {
+            unpack_block_u6(block, q);
+        } else {
+            unpack_block_u3(block, q);
+        }
+        for (size_t c = 0; c < block_size; c += 16) {
+            const size_t k = k0 + c;
+            const size_t g = k / group_size;
+            const float scale = scales[g];
+            const float zp = zero_points ? zero_points[g * zp_stride] : 0.0F;
+#if defined(HAVE_AVX512F)
+            const __m512 v =
+                _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<__m128i*>(q + c))));
+            _mm512_storeu_ps(dst + k, _mm512_mul_ps(_mm512_sub_ps(v, _mm512_set1_ps(zp)), _mm512_set1_ps(scale)));
+#elif defined(HAVE_AVX2)
+            for (size_t h = 0; h < 16; h += 8) {
+                const __m256 v =
+                    _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i*>(q + c + h))));
+                _mm256_storeu_ps(dst + k + h,
+                                 _mm256_mul_ps(_mm256_sub_ps(v, _mm256_set1_ps(zp)), _mm256_set1_ps(scale)));
+            }
+#else
+            for (size_t i = 0; i < 16; i++) {
+                dst[k + i] = (static_cast<float>(q[c + i]) - zp) * scale;
+            }
+#endif
+        }
+    }
+}
+
+void fc_decompress_lut(const uint8_t* src,
+                       const float* lut,
+                       size_t K,
+                       size_t group_size,
+                       const float* scales,
+                       float* dst) {
+    for (size_t k = 0; k < K; k += 16) {
+        const float scale = scales[k / group_size];
+#if defined(HAVE_AVX512F)
+        const __m512i idx = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k)));
+        _mm512_storeu_ps(dst + k, _mm512_mul_ps(_mm512_i32gather_ps(idx, lut, 4), _mm512_set1_ps(scale)));
+#elif defined(HAVE_AVX2)
+        for (size_t h = 0; h < 16; h += 8) {
+            const __m256i idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + k + h)));
+            _mm256_storeu_ps(dst + k + h, _mm256_mul_ps(_mm256_i32gather_ps(lut, idx, 4), _mm256_set1_ps(scale)));
+        }
+#else
+        for (size_t i = 0; i < 16; i++) {
+            dst[k + i] = lut[src[k + i]] * scale;
+        }
+#endif
+    }
+}
+
+float fc_dot(const float* a, const float* b, size_t K) {
+#if defined(HAVE_AVX512F)
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    __m512 acc2 = _mm512_setzero_ps();
+    __m512 acc3 = _mm512_setzero_ps();
+    for (size_t k = 0; k < K; k += 64) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k), _mm512_loadu_ps(b + k), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k + 16), _mm512_loadu_ps(b + k + 16), acc1);
+        acc2 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k + 32), _mm512_loadu_ps(b + k + 32), acc2);
+        acc3 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k + 48), _mm512_loadu_ps(b + k + 48), acc3);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(_mm512_add_ps(acc0, acc1), _mm512_add_ps(acc2, acc3)));
+#elif defined(HAVE_AVX2)
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    __m256 acc2 = _mm256_setzero_ps();
+    __m256 acc3 = _mm256_setzero_ps();
+    for (size_t k = 0; k < K; k += 32) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k + 8), _mm256_loadu_ps(b + k + 8), acc1);
+        acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k + 16), _mm256_loadu_ps(b + k + 16), acc2);
+        acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k + 24), _mm256_loadu_ps(b + k + 24), acc3);
+    }
+    const __m256 acc = _mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3));
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
+#else
+    float sum = 0.0F;
+    for (size_t k = 0; k < K; k++) {
+        sum += a[k] * b[k];
+    }
+    return sum;
+#endif
+}
+
+namespace {
+
+#if defined(HAVE_AVX512F)
+using vec_f32 = __m512;
+constexpr size_t vec_len = 16;
+// 16 accumulators and 8 loaded vectors of the 32 registers
+constexpr size_t gemm_mr = 4;
+constexpr size_t gemm_nr = 4;
+inline vec_f32 vec_zero() {
+    return _mm512_setzero_ps();
+}
+inline vec_f32 vec_load(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+inline vec_f32 vec_fmadd(vec_f32 a, vec_f32 b, vec_f32 c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+inline float vec_reduce(vec_f32 v) {
+    return _mm512_reduce_add_ps(v);
+}
+#elif defined(HAVE_AVX2)
+using vec_f32 = __m256;
+constexpr size_t vec_len = 8;
+// 8 accumulators and 6 loaded vectors of the 16 registers
+constexpr size_t gemm_mr = 4;
+constexpr size_t gemm_nr = 2;
+inline vec_f32 vec_zero() {
+    return _mm256_setzero_ps();
+}
+inline vec_f32 vec_load(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+inline vec_f32 vec_fmadd(vec_f32 a, vec_f32 b, vec_f32 c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+inline float vec_reduce(vec_f32 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
+}
+#else
+using vec_f32 = float;
+constexpr size_t vec_len = 1;
+constexpr size_t gemm_mr = 4;
+constexpr size_t gemm_nr = 4;
+inline vec_f32 vec_zero() {
+    return 0.0F;
+}
+inline vec_f32 vec_load(const float* p) {
+    return *p;
+}
+inline vec_f32 vec_fmadd(vec_f32 a, vec_f32 b, vec_f32 c) {
+    return a * b + c;
+}
+inline float vec_reduce(vec_f32 v) {
+    return v;
+}
+#endif
+
+// every loaded row of the activations is used gemm_nr times and every row of the weights gemm_mr times
+void gemm_micro_tile(const float* a, const float* b, size_t K, float* c, size_t ldc) {
+    vec_f32 acc[gemm_mr][gemm_nr];
+    for (size_t m = 0; m < gemm_mr; m++) {
+        for (size_t n = 0; n < gemm_nr; n++) {
+            acc[m][n] = vec_zero();
+        }
+    }
+    for (size_t k = 0; k < K; k += vec_len) {
+        vec_f32 vb[gemm_nr];
+        for (size_t n = 0; n < gemm_nr; n++) {
+            vb[n] = vec_load(b + n * K + k);
+        }
+        for (size_t m = 0; m < gemm_mr; m++) {
+            const vec_f32 va = vec_load(a + m * K + k);
+            for (size_t n = 0; n < gemm_nr; n++) {
+                acc[m][n] = vec_fmadd(va, vb[n], acc[m][n]);
+            }
+        }
+    }
+    for (size_t m = 0; m < gemm_mr; m++) {
+        for (size_t n = 0; n < gemm_nr; n++) {
+            c[m * ldc + n] = vec_reduce(acc[m][n]);
+        }
+    }
+}
+
+}  // namespace
+
+void fc_gemm(const float* a, const float* b, size_t M, size_t N, size_t K, float* c, size_t ldc) {
+    const size_t M_tiles = M - M % gemm_mr;
+    const size_t N_tiles = N - N % gemm_nr;
+    for (size_t m = 0; m < M_tiles; m += gemm_mr) {
+        for (size_t n = 0; n < N_tiles; n += gemm_nr) {
+            gemm_micro_tile(a + m * K, b + n * K, K, c + m * ldc + n, ldc);
+        }
+        for (size_t mm = m; mm < m + gemm_mr; mm++) {
+            for (size_t n = N_tiles; n < N; n++) {
+                c[mm * ldc + n] = fc_dot(a + mm * K, b + n * K, K);
+            }
+        }
+    }
+    for (size_t m = M_tiles; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            c[m * ldc + n] = fc_dot(a + m * K, b + n * K, K);
+        }
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+/**
+ * The kernels below decompress the weights of one output channel of a FullyConnected, which oneDNN cannot
+ * decompress on the fly, into f32. K must be a multiple of 64.
+ *
+ * u3/u6 weights are repacked into blocks of 64 weights, which keep the low and the high bits of the weights in
+ * separate planes, so they are unpacked with a few shifts and masks:
+ *   u6: 32 bytes of low nibbles (q[j] | q[j + 32] << 4), then 16 bytes of the high 2 bits of q[j + 16 * i] << 2 * i
+ *   u3: 16 bytes of the low 2 bits of q[j + 16 * i] << 2 * i, then 8 bytes of the high bit of q[j + 8 * i] << i
+ * The block takes as much memory as in the OpenVINO layout.
+ */
+
+// repacks K weights of one output channel from the OpenVINO u3/u6 layout into the blocked one
+void fc_pack_split_bit(const uint8_t* src, ov::element::Type type, size_t K, uint8_t* dst);
+
+// dst[k] = (q[k] - zero_points[g * zp_stride]) * scales[g], g = k / group_size, group_size is a multiple of 16.
+// zero_points may be nullptr, zp_stride is 0 for the per-tensor zero point and 1 for the per-group ones.
+void fc_decompress_split_bit(const uint8_t* packed,
+                             ov::element::Type type,
+                             size_t K,
+                             size_t group_size,
+                             const float* scales,
+                             const float* zero_points,
+                             size_t zp_stride,
+                             float* dst);
+
+// dst[k] = lut[src[k]] * scales[k / group_size] for the byte wide weights (f8e4m3, f8e5m2) whose values are
+// looked up in a 256 entries table, group_size is a multiple of 16
+void fc_decompress_lut(const uint8_t* src,
+                       const float* lut,
+                       size_t K,
+                       size_t group_size,
+                       const float* scales,
+                       float* dst);
+
+float fc_dot(const float* a, const float* b, size_t K);
+
+// c[m * ldc + n] = dot(a[m * K], b[n * K]) for the M rows of the activations and the N decompressed output channels,
+// the tile of the output is kept in registers while the K dimension is reduced
+void fc_gemm(const float* a, const float* b, size_t M, size_t N, size_t K, float* c, size_t ldc);
+
+}  // namespace ov::Extensions::Cpu::XARCH
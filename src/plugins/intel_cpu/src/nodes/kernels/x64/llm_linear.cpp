@@ -0,0 +1,334 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "llm_linear.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/type/float16.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+
+#    include "nodes/kernels/scaled_attn/common.hpp"
+#    include "nodes/kernels/scaled_attn/softmax_kernel.hpp"
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+// register blocking: every weight vector loaded is used by kBlockM rows of the activations,
+// and every activation vector by kBlockN output channels
+#if defined(HAVE_AVX512F)
+constexpr int kBlockM = 4;
+#else
+constexpr int kBlockM = 2;
+#endif
+constexpr int kBlockN = 4;
+
+// cache blocking: a tile of the weights of this size stays in L2 while all the rows of the activations are processed
+constexpr int kTileBytes = 128 * 1024;
+
+#if defined(HAVE_AVX2) && !defined(HAVE_AVX512F)
+inline int32_t hsum_epi32(__m256i v) {
+    auto s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_hadd_epi32(s, s);
+    s = _mm_hadd_epi32(s, s);
+    return _mm_cvtsi128_si32(s);
+}
+#endif
+
+struct LinearF16 {
+    template <int MB, int NB>
+    static void run(const float* src,
+                    int src_stride,
+                    const ov::float16* wei,
+                    int wei_stride,
+                    float* dst,
+                    int dst_stride,
+                    int K) {
+#if defined(HAVE_AVX512F)
+        __m512 acc[MB][NB];
+        for (auto& row : acc) {
+            for (auto& v : row) {
+                v = _mm512_setzero_ps();
+            }
+        }
+        int k = 0;
+        for (; k + 16 <= K; k += 16) {
+            __m512 w[NB];
+            for (int n = 0; n < NB; n++) {
+                w[n] = mm512_uni_loadu_ps(wei + n * wei_stride + k);
+            }
+            for (int m = 0; m < MB; m++) {
+                const auto a = _mm512_loadu_ps(src + m * src_stride + k);
+                for (int n = 0; n < NB; n++) {
+                    acc[m][n] = _mm512_fmadd_ps(a, w[n], acc[m][n]);
+                }
+            }
+        }
+        if (k < K) {
+            const auto tail = static_cast<size_t>(K - k);
+            __m512 w[NB];
+            for (int n = 0; n < NB; n++) {
+                w[n] = mm512_uni_loadu_tail_ps(wei + n * wei_stride + k, tail);
+            }
+            for (int m = 0; m < MB; m++) {
+                const auto a = mm512_uni_loadu_tail_ps(src + m * src_stride + k, tail);
+                for (int n = 0; n < NB; n++) {
+                    acc[m][n] = _mm512_fmadd_ps(a, w[n], acc[m][n]);
+                }
+            }
+        }
+        for (int m = 0; m < MB; m++) {
+            for (int n = 0; n < NB; n++) {
+                dst[m * dst_stride + n] = _mm512_reduce_add_ps(acc[m][n]);
+            }
+        }
+#elif defined(HAVE_AVX2)
+        __m256 acc[MB][NB];
+        for (auto& row : acc) {
+            for (auto& v : row) {
+                v = _mm256_setzero_ps();
+            }
+        }
+        int k = 0;
+        for (; k + 8 <= K; k += 8) {
+            __m256 w[NB];
+            for (int n = 0; n < NB; n++) {
+                w[n] = mm256_uni_loadu_ps(wei + n * wei_stride + k);
+            }
+            for (int m = 0; m < MB; m++) {
+                const auto a = _mm256_loadu_ps(src + m * src_stride + k);
+                for (int n = 0; n < NB; n++) {
+                    acc[m][n] = _mm256_fmadd_ps(a, w[n], acc[m][n]);
+                }
+            }
+        }
+        if (k < K) {
+            const auto tail = static_cast<size_t>(K - k);
+            __m256 w[NB];
+            for (int n = 0; n < NB; n++) {
+                w[n] = mm256_uni_loadu_tail_ps(wei + n * wei_stride + k, tail);
+            }
+            for (int m = 0; m < MB; m++) {
+                const auto a = mm256_uni_loadu_tail_ps(src + m * src_stride + k, tail);
+                for (int n = 0; n < NB; n++) {
+                    acc[m][n] = _mm256_fmadd_ps(a, w[n], acc[m][n]);
+                }
+            }
+        }
+        for (int m = 0; m < MB; m++) {
+            for (int n = 0; n < NB; n++) {
+                hsum(acc[m][n]);
+                dst[m * dst_stride + n] = _mm256_cvtss_f32(acc[m][n]);
+            }
+        }
+#else
+        for (int m = 0; m < MB; m++) {
+            for (int n = 0; n < NB; n++) {
+                float sum = 0.0F;
+                for (int k = 0; k < K; k++) {
+                    sum += src[m * src_stride + k] * static_cast<float>(wei[n * wei_stride + k]);
+                }
+                dst[m * dst_stride + n] = sum;
+            }
+        }
+#endif
+    }
+};
+
+struct LinearI8 {
+    template <int MB, int NB>
+    static void run(const int8_t* src,
+                    int src_stride,
+                    const int8_t* wei,
+                    int wei_stride,
+                    int32_t* dst,
+                    int dst_stride,
+                    int K) {
+        int32_t sum[MB][NB] = {};
+        int k = 0;
+#if defined(HAVE_AVX512F)
+        __m512i acc[MB][NB];
+        for (auto& row : acc) {
+            for (auto& v : row) {
+                v = _mm512_setzero_si512();
+            }
+        }
+        for (; k + 32 <= K; k += 32) {
+            __m512i w[NB];
+            for (int n = 0; n < NB; n++) {
+                w[n] = _mm512_cvtepi8_epi16(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(wei + n * wei_stride + k)));
+            }
+            for (int m = 0; m < MB; m++) {
+                const auto a = _mm512_cvtepi8_epi16(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + m * src_stride + k)));
+                for (int n = 0; n < NB; n++) {
+                    acc[m][n] = _mm512_add_epi32(acc[m][n], _mm512_madd_epi16(a, w[n]));
+                }
+            }
+        }
+        for (int m = 0; m < MB; m++) {
+            for (int n = 0; n < NB; n++) {
+                sum[m][n] = _mm512_reduce_add_epi32(acc[m][n]);
+            }
+        }
+#elif defined(HAVE_AVX2)
+        __m256i acc[MB][NB];
+        for (auto& row : acc) {
+            for (auto& v : row) {
+                v = _mm256_setzero_si256();
+            }
+        }
+        for (; k + 16 <= K; k += 16) {
+            __m256i w[NB];
+            for (int n = 0; n < NB; n++) {
+                w[n] = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(wei + n * wei_stride + k)));
+            }
+            for (int m = 0; m < MB; m++) {
+                const auto a =
+                    _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + m * src_stride + k)));
+                for (int n = 0; n < NB; n++) {
+                    acc[m][n] = _mm256_add_epi32(acc[m][n], _mm256_madd_epi16(a, w[n]));
+                }
+            }
+        }
+        for (int m = 0; m < MB; m++) {
+            for (int n = 0; n < NB; n++) {
+                sum[m][n] = hsum_epi32(acc[m][n]);
+            }
+        }
+#endif
+        for (int m = 0; m < MB; m++) {
+            for (int n = 0; n < NB; n++) {
+                for (int kk = k; kk < K; kk++) {
+                    sum[m][n] += static_cast<int32_t>(src[m * src_stride + kk]) * wei[n * wei_stride + kk];
+                }
+                dst[m * dst_stride + n] = sum[m][n];
+            }
+        }
+    }
+};
+
+template <class Kernel, int MB, typename TS, typename TW, typename TD>
+void linear_rows(const TS* src, int src_stride, const TW* wei, int wei_stride, TD* dst, int dst_stride, int n0, int n1, int K) {
+    int n = n0;
+    for (; n + kBlockN <= n1; n += kBlockN) {
+        Kernel::template run<MB, kBlockN>(src, src_stride, wei + n * wei_stride, wei_stride, dst + n, dst_stride, K);
+    }
+    for (; n < n1; n++) {
+        Kernel::template run<MB, 1>(src, src_stride, wei + n * wei_stride, wei_stride, dst + n, dst_stride, K);
+    }
+}
+
+template <class Kernel, typename TS, typename TW, typename TD>
+void linear(const TS* src, int src_stride, const TW* wei, int wei_stride, TD* dst, int dst_stride, int M, int N, int K) {
+    const int row_bytes = std::max(1, K * static_cast<int>(sizeof(TW)));
+    const int tile_n = std::max(kBlockN, kTileBytes / row_bytes / kBlockN * kBlockN);
+    for (int n0 = 0; n0 < N; n0 += tile_n) {
+        const int n1 = std::min(N, n0 + tile_n);
+        int m = 0;
+        for (; m + kBlockM <= M; m += kBlockM) {
+            linear_rows<Kernel, kBlockM>(src + m * src_stride,
+                                         src_stride,
+                                         wei,
+                                         wei_stride,
+                                         dst + m * dst_stride,
+                                         dst_stride,
+                                         n0,
+                                         n1,
+                                         K);
+        }
+        for (; m < M; m++) {
+            linear_rows<Kernel, 1>(src + m * src_stride,
+                                   src_stride,
+                                   wei,
+                                   wei_stride,
+                                   dst + m * dst_stride,
+                                   dst_stride,
+                                   n0,
+                                   n1,
+                                   K);
+        }
+    }
+}
+
+// silu(x) = x * sigmoid(x)
+// gelu_tanh(x) = 0.5 * x * (1 + tanh(y)) = x * sigmoid(2 * y), y = sqrt(2 / pi) * (x + 0.044715 * x^3)
+constexpr float gelu_c1 = 1.5957691216057308F;  // 2 * sqrt(2 / pi)
+constexpr float gelu_c3 = gelu_c1 * 0.044715F;
+
+}  // namespace
+
+void llm_linear_f32_f16(const float* src,
+                        int src_stride,
+                        const ov::float16* wei,
+                        int wei_stride,
+                        float* dst,
+                        int dst_stride,
+                        int M,
+                        int N,
+                        int K) {
+    linear<LinearF16>(src, src_stride, wei, wei_stride, dst, dst_stride, M, N, K);
+}
+
+void llm_linear_i8_i8(const int8_t* src,
+                      int src_stride,
+                      const int8_t* wei,
+                      int wei_stride,
+                      int32_t* dst,
+                      int dst_stride,
+                      int M,
+                      int N,
+                      int K) {
+    linear<LinearI8>(src, src_stride, wei, wei_stride, dst, dst_stride, M, N, K);
+}
+
+void llm_mlp_act_mul(const float* gate, const float* up, float* dst, int N, bool gelu) {
+    int n = 0;
+#if defined(HAVE_AVX512F)
+    const auto one = _mm512_set1_ps(1.0F);
+    const auto c1 = _mm512_set1_ps(gelu_c1);
+    const auto c3 = _mm512_set1_ps(gelu_c3);
+    for (; n + 16 <= N; n += 16) {
+        const auto x = _mm512_loadu_ps(gate + n);
+        auto z = x;
+        if (gelu) {
+            z = _mm512_mul_ps(x, _mm512_fmadd_ps(c3, _mm512_mul_ps(x, x), c1));
+        }
+        auto e = _mm512_sub_ps(_mm512_setzero_ps(), z);
+        exp_ps_avx512(e);
+        const auto sigmoid = _mm512_div_ps(one, _mm512_add_ps(one, e));
+        _mm512_storeu_ps(dst + n, _mm512_mul_ps(_mm512_mul_ps(x, sigmoid), _mm512_loadu_ps(up + n)));
+    }
+#elif defined(HAVE_AVX2)
+    const auto one = _mm256_set1_ps(1.0F);
+    const auto c1 = _mm256_set1_ps(gelu_c1);
+    const auto c3 = _mm256_set1_ps(gelu_c3);
+    for (; n + 8 <= N; n += 8) {
+        const auto x = _mm256_loadu_ps(gate + n);
+        auto z = x;
+        if (gelu) {
+            z = _mm256_mul_ps(x, _mm256_fmadd_ps(c3, _mm256_mul_ps(x, x), c1));
+        }
+        auto e = _mm256_sub_ps(_mm256_setzero_ps(), z);
+        exp_ps_avx2(e);
+        const auto sigmoid = _mm256_div_ps(one, _mm256_add_ps(one, e));
+        _mm256_storeu_ps(dst + n, _mm256_mul_ps(_mm256_mul_ps(x, sigmoid), _mm256_loadu_ps(up + n)));
+    }
+#endif
+    for (; n < N; n++) {
+        const float x = gate[n];
+        const float z = gelu ? x * (gelu_c1 + gelu_c3 * x * x) : x;
+        dst[n] = x / (1.0F + std::exp(-z)) * up[n];
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
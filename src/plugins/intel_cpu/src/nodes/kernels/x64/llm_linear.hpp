@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstdint>
+
+#include "openvino/core/type/float16.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+/**
+ * AVX-512/AVX2 kernels of the LLMMLP and QKVProjection nodes for the CPUs without AMX.
+ * The weights are kept in their original [N, K] layout, so every output channel is a dot product of two contiguous
+ * rows, which is the memory bound case of the token generation. Strides are in elements.
+ */
+
+// dst[m, n] = sum_k src[m, k] * wei[n, k] for the f32 activations [M, K] and the f16 weights [N, K]
+void llm_linear_f32_f16(const float* src,
+                        int src_stride,
+                        const ov::float16* wei,
+                        int wei_stride,
+                        float* dst,
+                        int dst_stride,
+                        int M,
+                        int N,
+                        int K);
+
+// dst[m, n] = sum_k src[m, k] * wei[n, k] for the per-token quantized activations [M, K] and the i8 weights [N, K]
+void llm_linear_i8_i8(const int8_t* src,
+                      int src_stride,
+                      const int8_t* wei,
+                      int wei_stride,
+                      int32_t* dst,
+                      int dst_stride,
+                      int M,
+                      int N,
+                      int K);
+
+// dst[n] = act(gate[n]) * up[n], act is silu or gelu (tanh approximation)
+void llm_mlp_act_mul(const float* gate, const float* up, float* dst, int N, bool gelu);
+
+}  // namespace ov::Extensions::Cpu::XARCH
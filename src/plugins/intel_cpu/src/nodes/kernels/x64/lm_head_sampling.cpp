@@ -0,0 +1,236 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lm_head_sampling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "llm_linear.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/float16.hpp"
+
+namespace ov::intel_cpu {
+
+LMHeadSampler::LMHeadSampler(const ov::float16* weight,
+                             int weight_stride,
+                             int vocab_size,
+                             int hidden_size,
+                             const Params& params)
+    : m_weight(weight),
+      m_weight_stride(weight_stride),
+      m_vocab_size(vocab_size),
+      m_hidden_size(hidden_size),
+      m_params(params) {
+    OPENVINO_ASSERT(m_params.temperature > 0.0F, "LMHeadSampler: temperature must be positive");
+    m_candidates = m_params.top_k;
+    if (m_params.sample && m_params.top_k == 0 && m_params.top_p < 1.0F) {
+        m_candidates = LM_HEAD_MAX_CANDIDATES;
+    }
+    m_candidates = std::min(m_candidates, m_vocab_size);
+    OPENVINO_ASSERT(m_params.sample || m_candidates > 0, "LMHeadSampler: top_k must be positive");
+    m_num_tiles = (m_vocab_size + LM_HEAD_BLK_N_SIZE - 1) / LM_HEAD_BLK_N_SIZE;
+}
+
+void LMHeadSampler::computeTile(const float* src,
+                                int src_stride,
+                                int M,
+                                int n0,
+                                int BN,
+                                float* dst,
+                                int dst_stride) const {
+    ov::Extensions::Cpu::XARCH::llm_linear_f32_f16(src,
+                                                   src_stride,
+                                                   m_weight + static_cast<size_t>(n0) * m_weight_stride,
+                                                   m_weight_stride,
+                                                   dst,
+                                                   dst_stride,
+                                                   M,
+                                                   BN,
+                                                   m_hidden_size);
+}
+
+void LMHeadSampler::push(std::vector<Candidate>& heap, const Candidate& c) const {
+    // heap front is the worst of the kept candidates
+    if (static_cast<int>(heap.size()) < m_candidates) {
+        heap.push_back(c);
+        std::push_heap(heap.begin(), heap.end(), better);
+    } else if (better(c, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), better);
+        heap.back() = c;
+        std::push_heap(heap.begin(), heap.end(), better);
+    }
+}
+
+LMHeadSampler::Candidate LMHeadSampler::drawFromVocab(const float* src,
+                                                      const float* tile_max,
+                                                      const float* tile_sum,
+                                                      float max,
+                                                      float target) const {
+    // find the tile which holds the target of the cumulative distribution, then only its logits are recomputed
+    float cdf = 0.0F;
+    int tile = 0;
+    for (; tile < m_num_tiles - 1; tile++) {
+        const float weight = tile_sum[tile] * std::exp(tile_max[tile] - max);
+        if (cdf + weight >= target) {
+            break;
+        }
+        cdf += weight;
+    }
+    const int n0 = tile * LM_HEAD_BLK_N_SIZE;
+    const int BN = std::min(LM_HEAD_BLK_N_SIZE, m_vocab_size - n0);
+    float logits[LM_HEAD_BLK_N_SIZE];
+    computeTile(src, 0, 1, n0, BN, logits, LM_HEAD_BLK_N_SIZE);
+    const float scale = 1.0F / m_params.temperature;
+    for (int n = 0; n < BN; n++) {
+        logits[n] *= scale;
+        cdf += std::exp(logits[n] - max);
+        if (cdf >= target) {
+            return {logits[n], n0 + n};
+        }
+    }
+    // rounding of the sums may leave the target slightly beyond the last token
+    return {logits[BN - 1], n0 + BN - 1};
+}
+
+LMHeadSampler::Candidate LMHeadSampler::drawFromCandidates(const std::vector<Candidate>& candidates,
+                                                           float max,
+                                                           float sum,
+                                                           float top_p,
+                                                           float random) {
+    // candidates are sorted, the nucleus is the shortest prefix which holds top_p of the probability
+    size_t count = candidates.size();
+    std::vector<float> probs(count);
+    float mass = 0.0F;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        probs[i] = std::exp(candidates[i].value - max) / sum;
+        mass += probs[i];
+        if (top_p < 1.0F && mass >= top_p) {
+            count = i + 1;
+            break;
+        }
+    }
+    float total = 0.0F;
+    for (size_t i = 0; i < count; i++) {
+        total += probs[i];
+    }
+    const float target = random * total;
+    float cdf = 0.0F;
+    for (size_t i = 0; i < count; i++) {
+        cdf += probs[i];
+        if (cdf >= target) {
+            return candidates[i];
+        }
+    }
+    return candidates[count - 1];
+}
+
+void LMHeadSampler::run(const float* src,
+                        int src_stride,
+                        int M,
+                        const float* random,
+                        float* values,
+                        int32_t* indices,
+                        float* logits,
+                        int logits_stride) {
+    const auto threads = static_cast<size_t>(parallel_get_max_threads());
+    const bool sample_from_vocab = m_params.sample && m_candidates == 0;
+    const float scale = 1.0F / m_params.temperature;
+
+    // the tile buffers do not depend on the rows, so they are only allocated by the first run
+    m_tiles.resize(threads * LM_HEAD_BLK_M_SIZE * LM_HEAD_BLK_N_SIZE);
+    if (m_params.sample) {
+        m_tile_max.resize(static_cast<size_t>(M) * m_num_tiles);
+        m_tile_sum.resize(static_cast<size_t>(M) * m_num_tiles);
+    }
+    m_heaps.resize(threads * M);
+    for (auto& heap : m_heaps) {
+        heap.clear();
+        heap.reserve(m_candidates);
+    }
+
+    ov::parallel_nt_static(threads, [&](const size_t ithr, const size_t nthr) {
+        size_t start{0};
+        size_t end{0};
+        splitter(static_cast<size_t>(m_num_tiles), nthr, ithr, start, end);
+        float* tile_logits = m_tiles.data() + ithr * LM_HEAD_BLK_M_SIZE * LM_HEAD_BLK_N_SIZE;
+        for (auto tile = start; tile < end; tile++) {
+            const int n0 = static_cast<int>(tile) * LM_HEAD_BLK_N_SIZE;
+            const int BN = std::min(LM_HEAD_BLK_N_SIZE, m_vocab_size - n0);
+            for (int m0 = 0; m0 < M; m0 += LM_HEAD_BLK_M_SIZE) {
+                const int BM = std::min(LM_HEAD_BLK_M_SIZE, M - m0);
+                computeTile(src + m0 * src_stride, src_stride, BM, n0, BN, tile_logits, LM_HEAD_BLK_N_SIZE);
+                for (int m = m0; m < m0 + BM; m++) {
+                    float* row = tile_logits + (m - m0) * LM_HEAD_BLK_N_SIZE;
+                    if (logits) {
+                        std::memcpy(logits + static_cast<size_t>(m) * logits_stride + n0, row, BN * sizeof(float));
+                    }
+                    for (int n = 0; n < BN; n++) {
+                        row[n] *= scale;
+                    }
+                    if (m_params.sample) {
+                        const float max = *std::max_element(row, row + BN);
+                        float sum = 0.0F;
+                        for (int n = 0; n < BN; n++) {
+                            sum += std::exp(row[n] - max);
+                        }
+                        m_tile_max[m * m_num_tiles + tile] = max;
+                        m_tile_sum[m * m_num_tiles + tile] = sum;
+                    }
+                    if (m_candidates > 0) {
+                        auto& heap = m_heaps[ithr * M + m];
+                        for (int n = 0; n < BN; n++) {
+                            push(heap, {row[n], n0 + n});
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    ov::parallel_for(static_cast<size_t>(M), [&](size_t m) {
+        std::vector<Candidate> candidates;
+        for (size_t ithr = 0; ithr < threads; ithr++) {
+            const auto& heap = m_heaps[ithr * M + m];
+            candidates.insert(candidates.end(), heap.begin(), heap.end());
+        }
+        std::sort(candidates.begin(), candidates.end(), better);
+        if (static_cast<int>(candidates.size()) > m_candidates) {
+            candidates.resize(m_candidates);
+        }
+
+        if (!m_params.sample) {
+            for (int i = 0; i < m_candidates; i++) {
+                values[m * m_candidates + i] = candidates[i].value;
+                indices[m * m_candidates + i] = candidates[i].index;
+            }
+            return;
+        }
+
+        // softmax denominator over the whole vocabulary from the per-tile reductions
+        const float* tile_max = m_tile_max.data() + m * m_num_tiles;
+        const float* tile_sum = m_tile_sum.data() + m * m_num_tiles;
+        const float max = *std::max_element(tile_max, tile_max + m_num_tiles);
+        float sum = 0.0F;
+        for (int tile = 0; tile < m_num_tiles; tile++) {
+            sum += tile_sum[tile] * std::exp(tile_max[tile] - max);
+        }
+
+        Candidate token{};
+        if (sample_from_vocab) {
+            token = drawFromVocab(src + m * src_stride, tile_max, tile_sum, max, random[m] * sum);
+        } else {
+            token = drawFromCandidates(candidates, max, sum, m_params.top_p, random[m]);
+        }
+        values[m] = token.value;
+        indices[m] = token.index;
+    });
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "openvino/core/type/float16.hpp"
+
+namespace ov::intel_cpu {
+
+// vocabulary tile of the LM head, the logits of a tile are reduced while they are in cache
+constexpr int LM_HEAD_BLK_N_SIZE = 128;
+
+// candidates kept per row at most, top_p sampling without top_k keeps that many
+constexpr int LM_HEAD_MAX_CANDIDATES = 256;
+
+// rows of a vocabulary tile computed at once, the weights of the tile are read from memory once per block of rows.
+// The kernel is made for the memory bound token generation, so the fusion is only used when the rows are known to be
+// that few or to be one token per sequence.
+constexpr int LM_HEAD_BLK_M_SIZE = 16;
+
+// LM head [vocab_size, hidden_size] followed by the selection of the next tokens. Logits are computed tile by tile
+// over the vocabulary and reduced to the running top-k of every row and the max & sum of exp of every tile, so the
+// [M, vocab_size] logits are only stored when requested.
+class LMHeadSampler {
+public:
+    struct Params {
+        bool sample = false;
+        int top_k = 1;  // sample: 0 draws from the whole vocabulary
+        float top_p = 1.0F;
+        float temperature = 1.0F;
+    };
+
+    LMHeadSampler(const ov::float16* weight, int weight_stride, int vocab_size, int hidden_size, const Params& params);
+
+    // number of the selected tokens per row
+    [[nodiscard]] int outputs() const {
+        return m_params.sample ? 1 : m_params.top_k;
+    }
+
+    // src [M, hidden_size]; random [M] are uniform in [0, 1] and used when sampling;
+    // values & indices [M, outputs()]; logits [M, vocab_size] are optional
+    void run(const float* src,
+             int src_stride,
+             int M,
+             const float* random,
+             float* values,
+             int32_t* indices,
+             float* logits,
+             int logits_stride);
+
+private:
+    struct Candidate {
+        float value;
+        int32_t index;
+    };
+
+    // larger logit first, the smaller index wins on ties like in TopK
+    static bool better(const Candidate& a, const Candidate& b) {
+        return a.value > b.value || (a.value == b.value && a.index < b.index);
+    }
+
+    void computeTile(const float* src, int src_stride, int M, int n0, int BN, float* dst, int dst_stride) const;
+    void push(std::vector<Candidate>& heap, const Candidate& c) const;
+    [[nodiscard]] Candidate drawFromVocab(const float* src,
+                                          const float* tile_max,
+                                          const float* tile_sum,
+                                          float max,
+                                          float target) const;
+    [[nodiscard]] static Candidate drawFromCandidates(const std::vector<Candidate>& candidates,
+                                                      float max,
+                                                      float sum,
+                                                      float top_p,
+                                                      float random);
+
+    const ov::float16* m_weight;
+    int m_weight_stride;
+    int m_vocab_size;
+    int m_hidden_size;
+    Params m_params;
+    // candidates kept per row
+    int m_candidates = 0;
+    int m_num_tiles = 0;
+
+    std::vector<float> m_tiles;                   // [nthr, LM_HEAD_BLK_M_SIZE, LM_HEAD_BLK_N_SIZE]
+    std::vector<float> m_tile_max;                // [M, num_tiles]
+    std::vector<float> m_tile_sum;                // [M, num_tiles], relative to m_tile_max
+    std::vector<std::vector<Candidate>> m_heaps;  // [nthr, M]
+};
+
+}  // namespace ov::intel_cpu
@@ -17,6 +17,7 @@
 #include <memory>
 #include <type_traits>
 
+#include "llm_linear.hpp"
 #include "mlp_utils.hpp"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
 #include "openvino/core/except.hpp"
@@ -575,6 +576,87 @@ void MatrixDynQuantPerRow::quantize(size_t BM, ov::float16* psrc, int src_stride
     });
 }
 
+void MatrixDynQuantPerRow::quantize(size_t BM, float* psrc, int src_stride) const {
+    assert(static_cast<int64_t>(BM) <= M);
+    parallel_nt_static(0, [&](const size_t ithr, const size_t nthr) {
+        size_t start{0};
+        size_t end{0};
+        splitter(BM, nthr, ithr, start, end);
+        ov::Extensions::Cpu::XARCH::llm_mlp_quantize_f32_i8(psrc + start * src_stride,
+                                                            src_stride,
+                                                            data + start * K,
+                                                            K,
+                                                            end - start,
+                                                            K,
+                                                            scale + start,
+                                                            zp + start,
+                                                            asym);
+    });
+}
+
+void LinearAvx::setup(const void* p_weight, int weight_stride, int n, int k, const float* p_wscale) {
+    weight = p_weight;
+    stride = weight_stride;
+    N = n;
+    K = k;
+    wscale = p_wscale;
+    if (quantized()) {
+        wsum.resize(N);
+        ov::parallel_for(static_cast<size_t>(N), [&](size_t oc) {
+            const auto* row = reinterpret_cast<const int8_t*>(weight) + oc * stride;
+            int32_t sum = 0;
+            for (int i = 0; i < K; i++) {
+                sum += row[i];
+            }
+            wsum[oc] = static_cast<float>(sum);
+        });
+    }
+}
+
+void LinearAvx::run(const float* src,
+                    int src_stride,
+                    const MatrixDynQuantPerRow& qsrc,
+                    int M,
+                    int n0,
+                    int BN,
+                    float* dst,
+                    int dst_stride) const {
+    if (!quantized()) {
+        ov::Extensions::Cpu::XARCH::llm_linear_f32_f16(src,
+                                                       src_stride,
+                                                       reinterpret_cast<const ov::float16*>(weight) + n0 * stride,
+                                                       stride,
+                                                       dst,
+                                                       dst_stride,
+                                                       M,
+                                                       BN,
+                                                       K);
+        return;
+    }
+    // i32 results are dequantized in place
+    auto* dst_i32 = reinterpret_cast<int32_t*>(dst);
+    ov::Extensions::Cpu::XARCH::llm_linear_i8_i8(qsrc.data,
+                                                 static_cast<int>(qsrc.stride()),
+                                                 reinterpret_cast<const int8_t*>(weight) + n0 * stride,
+                                                 stride,
+                                                 dst_i32,
+                                                 dst_stride,
+                                                 M,
+                                                 BN,
+                                                 K);
+    ov::Extensions::Cpu::XARCH::llm_mlp_dequantize_i32_f32(M,
+                                                           BN,
+                                                           dst_i32,
+                                                           dst_stride,
+                                                           dst,
+                                                           dst_stride,
+                                                           qsrc.scale,
+                                                           qsrc.zp,
+                                                           wsum.data() + n0,
+                                                           wscale + n0,
+                                                           qsrc.asym);
+}
+
 void GateUpCombine::generate() {
     Xbyak::Label loop_begin;
 
@@ -13,11 +13,13 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "cpu/x64/jit_generator.hpp"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "utils/general_utils.h"
@@ -496,6 +498,54 @@ struct MatrixDynQuantPerRow {
 
     void quantize(size_t BM, ov::bfloat16* psrc, int src_stride) const;
     void quantize(size_t BM, ov::float16* psrc, int src_stride) const;
+    void quantize(size_t BM, float* psrc, int src_stride) const;
+};
+
+// converts BM rows of the input into f32, the f32 input is used in place
+template <typename T>
+const float* rows_to_f32(const T* src, size_t strideSrc, int BM, size_t K, PlainTensor& buffer, int& strideDst) {
+    if constexpr (std::is_same_v<T, float>) {
+        strideDst = static_cast<int>(strideSrc);
+        return src;
+    } else {
+        ov::parallel_for(static_cast<size_t>(BM), [&](size_t m) {
+            auto* dst = buffer.ptr<float>(m);
+            for (size_t k = 0; k < K; k++) {
+                dst[k] = static_cast<float>(src[m * strideSrc + k]);
+            }
+        });
+        strideDst = static_cast<int>(buffer.stride(0));
+        return buffer.ptr<float>();
+    }
+}
+
+// projection [N, K] of the LLMMLP & QKVProjection executors for the CPUs without AMX, the weights are used in place:
+// f16, or i8 with the per-OC scales, then the activations are quantized per row by MatrixDynQuantPerRow
+struct LinearAvx {
+    const void* weight = nullptr;
+    int stride = 0;  // in elements
+    int N = 0;
+    int K = 0;
+    const float* wscale = nullptr;
+    // sum of the i8 weights per OC, compensates the zero points of the activations
+    std::vector<float> wsum;
+
+    // p_wscale is nullptr for the f16 weights
+    void setup(const void* p_weight, int weight_stride, int n, int k, const float* p_wscale);
+
+    [[nodiscard]] bool quantized() const {
+        return wscale != nullptr;
+    }
+
+    // dst[M, BN] = src[M, K] * weight[n0 : n0 + BN, K]^T in f32, src is f32 for the f16 weights and qsrc otherwise
+    void run(const float* src,
+             int src_stride,
+             const MatrixDynQuantPerRow& qsrc,
+             int M,
+             int n0,
+             int BN,
+             float* dst,
+             int dst_stride) const;
 };
 
 // combine gate_proj & up_proj using activation algo, then convert to bf16
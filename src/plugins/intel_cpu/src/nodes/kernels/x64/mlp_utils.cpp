@@ -143,6 +143,18 @@ void llm_mlp_quantize_f16_i8(ov::float16* psrc,
     llm_mlp_quantize_to_i8(psrc, src_stride, pdst, dst_stride, rows, cols, p_scales, p_zp, asym);
 }
 
+void llm_mlp_quantize_f32_i8(float* psrc,
+                             int src_stride,
+                             int8_t* pdst,
+                             int dst_stride,
+                             int rows,
+                             int cols,
+                             float* p_scales,
+                             float* p_zp,
+                             bool asym) {
+    llm_mlp_quantize_to_i8(psrc, src_stride, pdst, dst_stride, rows, cols, p_scales, p_zp, asym);
+}
+
 void llm_mlp_dequantize_i32_f32(int Batch,
                                 int OC,
                                 const int32_t* src,
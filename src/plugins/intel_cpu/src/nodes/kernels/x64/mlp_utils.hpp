@@ -28,6 +28,15 @@ void llm_mlp_quantize_f16_i8(ov::float16* psrc,
                              float* p_scales,
                              float* p_zp,
                              bool asym);
+void llm_mlp_quantize_f32_i8(float* psrc,
+                             int src_stride,
+                             int8_t* pdst,
+                             int dst_stride,
+                             int rows,
+                             int cols,
+                             float* p_scales,
+                             float* p_zp,
+                             bool asym);
 void llm_mlp_dequantize_i32_f32(int Batch,
                                 int OC,
                                 const int32_t* src,
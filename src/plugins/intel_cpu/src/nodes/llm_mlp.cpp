@@ -4,6 +4,8 @@
 
 #include "llm_mlp.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -11,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -46,6 +49,7 @@
 #endif
 
 #if defined(OPENVINO_ARCH_X86_64)
+#    include "kernels/x64/llm_linear.hpp"
 #    include "kernels/x64/mlp_kernel.hpp"
 #    include "kernels/x64/mlp_utils.hpp"
 #endif
@@ -144,10 +148,12 @@ public:
         DEBUG_LOG("   setup is done. weight @ ", static_cast<void*>(p_weight));
     }
 
+    // dstC is T, or f32 for the partial sums of a tensor parallel rank
+    template <typename D>
     void run(uint8_t* pA,
              int strideA,
              int M,
-             T* dstC,
+             D* dstC,
              int strideC,
              const LLMMLPNode::Config& config,
              MatrixDynQuantPerRow& src_dq,
@@ -185,8 +191,23 @@ public:
                     auto* p_peerC = works[peer_ithr].m_C.template ptr<float>();
                     // the other one has finished, we can do the reduce sum
                     auto* p_curC = workC.template ptr<float>();
-                    jit_reduce2cvt
-                        .call(p_curC, p_peerC, workC.stride(0), dstC + work.n0, strideC / sizeof(*dstC), M, work.BN);
+                    if constexpr (std::is_same_v<D, float>) {
+                        const auto strideW = workC.stride(0);
+                        for (int m = 0; m < M; m++) {
+                            auto* dst = dstC + m * strideC / sizeof(float) + work.n0;
+                            for (int n = 0; n < work.BN; n++) {
+                                dst[n] = p_curC[m * strideW + n] + p_peerC[m * strideW + n];
+                            }
+                        }
+                    } else {
+                        jit_reduce2cvt.call(p_curC,
+                                            p_peerC,
+                                            workC.stride(0),
+                                            dstC + work.n0,
+                                            strideC / sizeof(*dstC),
+                                            M,
+                                            work.BN);
+                    }
                 }
             }
         });
@@ -339,6 +360,45 @@ private:
     int m_threads_num = 0;
 };
 
+// sums the partial outputs [M, hidden_size] of the tensor parallel ranks into dst
+template <typename T>
+static void allReduce(TensorParallelComm& tp,
+                      const float* partial,
+                      T* dst,
+                      size_t strideDst,
+                      int M,
+                      size_t hidden_size) {
+    tp.exchange(partial, [&](const std::vector<const void*>& parts) {
+        // sum the f32 partials in the order of the ranks and round once, so every rank gets bitwise identical outputs
+        // rows are summed in blocks that stay in registers/L1, rank by rank so the inner loops vectorize
+        constexpr size_t blk = 256;
+        const size_t blocks = (hidden_size + blk - 1) / blk;
+        tp.cpu_parallel()->parallel_for2d(static_cast<size_t>(M), blocks, [&](size_t m, size_t b) {
+            const size_t k0 = b * blk;
+            const size_t n = std::min(blk, hidden_size - k0);
+            float acc[blk];
+            const auto* first = static_cast<const float*>(parts[0]) + m * hidden_size + k0;
+            for (size_t k = 0; k < n; k++) {
+                acc[k] = first[k];
+            }
+            for (size_t r = 1; r < parts.size(); r++) {
+                const auto* src = static_cast<const float*>(parts[r]) + m * hidden_size + k0;
+                for (size_t k = 0; k < n; k++) {
+                    acc[k] += src[k];
+                }
+            }
+            auto* out = dst + m * strideDst + k0;
+            for (size_t k = 0; k < n; k++) {
+                out[k] = static_cast<T>(acc[k]);
+            }
+        });
+    });
+}
+
+// intermediate channels are split across tensor parallel ranks in this unit,
+// it keeps both the N blocking of gate/up and the K blocking of (quantized) down valid
+constexpr size_t TP_BLK_N_SIZE = REG_BLK_K_SIZE_I8;
+
 template <typename T>
 struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
     LLMMLP* m_pnode;
@@ -363,6 +423,10 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
 
     bool m_rt_prec_f16;
 
+    // partial output of the rank reduced across ranks by all-reduce: [M, hidden_size]
+    bool m_tp_enabled = false;
+    PlainTensor m_tp_partial;
+
     // [M, K] x [N, K] => [M, N] x [K, N] => [M, K]
     // w_gate/w_up : [N, K]
     //     w_down  : [K, N]
@@ -379,19 +443,43 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
         auto K = w_gate.size(1);
         auto N = w_gate.size(0);
         OPENVINO_ASSERT(w_gate.stride_bytes(0) == w_up.stride_bytes(0));
+        size_t N_total = N;
+        if (m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
+            N_total = w_gate.size(0) / 2;
+        }
+        // tensor parallel: the rank owns the intermediate channels [n0, n0 + N) of gate/up
+        // and the same input channels of down, so its output is a partial sum over ranks
+        const auto& tp = pnode->m_tp;
+        size_t n0 = 0;
+        N = N_total;
+        if (tp.enabled() && N_total / TP_BLK_N_SIZE >= static_cast<size_t>(tp.size())) {
+            const auto [begin, end] = tp.part(N_total, TP_BLK_N_SIZE);
+            n0 = begin;
+            N = end - begin;
+            m_tp_enabled = true;
+        }
         if (m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
-            N = w_gate.size(0) / 2;
             if (m_config.gate_up_type == LLMMLPNode::GATE_UP_TYPE::COMBINED_UP_GATE) {
                 // COMBINED_UP_GATE: VariadicSplit output[0] connects to up, output[1] connects to gate
-                gate_up.setup(w_gate.ptr_v(N, 0), w_gate.ptr_v(), w_gate.stride_bytes(0), N * 2, K, config);
+                gate_up.setup(w_gate.ptr_v(N_total + n0, 0),
+                              w_gate.ptr_v(n0, 0),
+                              w_gate.stride_bytes(0),
+                              N * 2,
+                              K,
+                              config);
             } else {
                 // COMBINED_GATE_UP: VariadicSplit output[0] connects to gate, output[1] connects to up
-                gate_up.setup(w_gate.ptr_v(), w_gate.ptr_v(N, 0), w_gate.stride_bytes(0), N * 2, K, config);
+                gate_up.setup(w_gate.ptr_v(n0, 0),
+                              w_gate.ptr_v(N_total + n0, 0),
+                              w_gate.stride_bytes(0),
+                              N * 2,
+                              K,
+                              config);
             }
         } else {
-            gate_up.setup(w_gate.ptr_v(), w_up.ptr_v(), w_up.stride_bytes(0), N * 2, K, config);
+            gate_up.setup(w_gate.ptr_v(n0, 0), w_up.ptr_v(n0, 0), w_up.stride_bytes(0), N * 2, K, config);
         }
-        down.setup(w_down.ptr_v(), w_down.stride_bytes(0), K, N, config);
+        down.setup(w_down.ptr_v(0, n0), w_down.stride_bytes(0), K, N, config);
 
         if (m_config.gate_up_quantized) {
             m_w_scale_gateup.resize<float>({N * 2});
@@ -399,8 +487,10 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
             auto* w_scale_up = pnode->getSrcMemoryAtPort(5)->getDataAs<float>();
             auto* dst = m_w_scale_gateup.ptr<float>();
             if (m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
-                w_scale_up = w_scale_gate + N;
+                w_scale_up = w_scale_gate + N_total;
             }
+            w_scale_gate += n0;
+            w_scale_up += n0;
 
             // When gate_up_type is COMBINED_UP_GATE, we need to swap the scales
             // to match the swapped weight layout
@@ -455,7 +545,7 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
 
             if (m_config.down_quantized) {
                 m_quant_up_act.M = M;
-                m_quant_up_act.K = m_config.up_size;
+                m_quant_up_act.K = m_N;
                 allocator.register_allocation(m_quant_up_act.size(), [&](void* ptr) {
                     m_quant_up_act.setup(ptr);
                 });
@@ -484,6 +574,15 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
         auto* dstC = output->getDataAs<T>();
         const auto& dstStrides = output->getDescWithType<BlockedMemoryDesc>()->getStrides();
         int strideC = dstStrides[dstStrides.size() - 2] * sizeof(T);
+        const auto hidden_size = static_cast<size_t>(m_config.hidden_size);
+        // the partial sums of a tensor parallel rank are kept in f32 till the all-reduce
+        float* partialC = nullptr;
+        int stridePartial = 0;
+        if (m_tp_enabled) {
+            m_tp_partial.resize<float>({static_cast<size_t>(M), hidden_size});
+            partialC = m_tp_partial.ptr<float>();
+            stridePartial = m_tp_partial.stride_bytes(0);
+        }
 
         float* p_w_scale_down = nullptr;
         if (m_config.down_quantized) {
@@ -521,17 +620,284 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
                 stride_up_act = m_quant_up_act.stride();
             }
 
-            down.run(p_up_act, stride_up_act, BM, dstC, strideC, m_config, m_quant_up_act, p_w_scale_down);
+            if (m_tp_enabled) {
+                down.run(p_up_act,
+                         stride_up_act,
+                         BM,
+                         partialC,
+                         stridePartial,
+                         m_config,
+                         m_quant_up_act,
+                         p_w_scale_down);
+                partialC += BM * stridePartial / sizeof(float);
+            } else {
+                down.run(p_up_act, stride_up_act, BM, dstC, strideC, m_config, m_quant_up_act, p_w_scale_down);
+                dstC += BM * strideC / sizeof(T);
+            }
 
             m += BM;
             pA += BM * strideA_in_bytes;
-            dstC += BM * strideC / sizeof(T);
+        }
+
+        if (m_tp_enabled) {
+            allReduce(m_pnode->m_tp,
+                      m_tp_partial.ptr<float>(),
+                      output->getDataAs<T>(),
+                      dstStrides[dstStrides.size() - 2],
+                      M,
+                      hidden_size);
         }
     }
 
 private:
     size_t m_threads_num = 0LU;
 };
+
+// Copies the [rows, cols] weights of a tensor parallel rank into dst. The pages are first touched by the threads of
+// the rank, so the weights are placed in the memory of its socket. Returns the copy, its stride is cols.
+static const void* copyRankWeights(const CpuParallel& cpu_parallel,
+                                   PlainTensor& dst,
+                                   const void* src,
+                                   size_t rows,
+                                   size_t cols,
+                                   size_t stride,
+                                   size_t element_size) {
+    dst.resize<uint8_t>({rows, cols * element_size});
+    cpu_parallel.parallel_for(rows, [&](size_t r) {
+        std::memcpy(dst.ptr<uint8_t>(r), static_cast<const uint8_t*>(src) + r * stride * element_size, dst.stride(0));
+    });
+    return dst.ptr<uint8_t>();
+}
+
+// output channels of the AVX executor are computed in tiles of this size, so gate & up of a tile are still in cache
+// when the activation is applied
+constexpr int AVX_BLK_N_SIZE = REG_BLK_N_SIZE;
+
+// LLMMLP for the CPUs without AMX (AVX-512 or AVX2): gate & up are computed tile by tile over the intermediate
+// channels and combined by the activation while in cache, then down reads the activations of all the tiles
+template <typename T>
+struct LLMMLP::AvxExecutor : public LLMMLP::ExecutorBase {
+    LLMMLP* m_pnode;
+    const LLMMLPNode::Config m_config;
+    LinearAvx m_gate;
+    LinearAvx m_up;
+    LinearAvx m_down;
+    int m_N = 0;
+    int m_M = 0;
+    int m_threads_num = 0;
+
+    PlainTensor m_src;      // f32 input [M, hidden_size]
+    PlainTensor m_act;      // f32 act(gate) * up [M, N]
+    PlainTensor m_tiles;    // f32 tiles of each thread [nthr, 2, M, AVX_BLK_N_SIZE]
+    PlainTensor m_quant_buf[2];
+    MatrixDynQuantPerRow m_quant_act;
+    MatrixDynQuantPerRow m_quant_up_act;
+
+    bool m_tp_enabled = false;
+    PlainTensor m_tp_partial;
+    // gate, up and down weights of the tensor parallel rank
+    PlainTensor m_tp_weights[3];
+
+    AvxExecutor(LLMMLP* pnode, const LLMMLPNode::Config& config)
+        : m_pnode(pnode),
+          m_config(config),
+          m_threads_num(parallel_get_max_threads()) {
+        PlainTensor w_gate(pnode->getSrcMemoryAtPort(1));
+        PlainTensor w_up(pnode->getSrcMemoryAtPort(2));
+        PlainTensor w_down(pnode->getSrcMemoryAtPort(3));
+
+        const auto K = static_cast<int>(w_gate.size(1));
+        size_t N_total = w_gate.size(0);
+        if (m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
+            N_total /= 2;
+        }
+        // same tensor parallel split as the AMX executor
+        const auto& tp = pnode->m_tp;
+        size_t n0 = 0;
+        size_t N = N_total;
+        if (tp.enabled() && N_total / TP_BLK_N_SIZE >= static_cast<size_t>(tp.size())) {
+            const auto [begin, end] = tp.part(N_total, TP_BLK_N_SIZE);
+            n0 = begin;
+            N = end - begin;
+            m_tp_enabled = true;
+        }
+
+        const void* p_gate = w_gate.ptr_v(n0, 0);
+        const void* p_up = w_up.ptr_v(n0, 0);
+        if (m_config.gate_up_type == LLMMLPNode::GATE_UP_TYPE::COMBINED_GATE_UP) {
+            p_up = w_gate.ptr_v(N_total + n0, 0);
+        } else if (m_config.gate_up_type == LLMMLPNode::GATE_UP_TYPE::COMBINED_UP_GATE) {
+            p_up = w_gate.ptr_v(n0, 0);
+            p_gate = w_gate.ptr_v(N_total + n0, 0);
+        }
+
+        const float* w_scale_gate = nullptr;
+        const float* w_scale_up = nullptr;
+        if (m_config.gate_up_quantized) {
+            w_scale_gate = pnode->getSrcMemoryAtPort(4)->getDataAs<float>();
+            w_scale_up = pnode->getSrcMemoryAtPort(5)->getDataAs<float>();
+            if (m_config.gate_up_type != LLMMLPNode::GATE_UP_TYPE::SEPARATE) {
+                w_scale_up = w_scale_gate + N_total;
+            }
+            if (m_config.gate_up_type == LLMMLPNode::GATE_UP_TYPE::COMBINED_UP_GATE) {
+                std::swap(w_scale_gate, w_scale_up);
+            }
+            w_scale_gate += n0;
+            w_scale_up += n0;
+        }
+        const float* w_scale_down = nullptr;
+        if (m_config.down_quantized) {
+            w_scale_down = pnode->getSrcMemoryAtPort(6)->getDataAs<float>();
+        }
+
+        auto stride_gate_up = static_cast<int>(w_gate.stride(0));
+        const void* p_down = w_down.ptr_v(0, n0);
+        auto stride_down = static_cast<int>(w_down.stride(0));
+        if (m_tp_enabled) {
+            // the weights are used in place, keep the slice of the rank in the memory of its socket
+            const auto gate_up_size = m_config.gate_up_quantized ? sizeof(int8_t) : sizeof(ov::float16);
+            const auto down_size = m_config.down_quantized ? sizeof(int8_t) : sizeof(ov::float16);
+            const auto k = static_cast<size_t>(K);
+            p_gate = copyRankWeights(*tp.cpu_parallel(), m_tp_weights[0], p_gate, N, k, stride_gate_up, gate_up_size);
+            p_up = copyRankWeights(*tp.cpu_parallel(), m_tp_weights[1], p_up, N, k, stride_gate_up, gate_up_size);
+            p_down = copyRankWeights(*tp.cpu_parallel(), m_tp_weights[2], p_down, k, N, stride_down, down_size);
+            stride_gate_up = K;
+            stride_down = static_cast<int>(N);
+        }
+        m_N = static_cast<int>(N);
+        m_gate.setup(p_gate, stride_gate_up, m_N, K, w_scale_gate);
+        m_up.setup(p_up, stride_gate_up, m_N, K, w_scale_up);
+        m_down.setup(p_down, stride_down, K, m_N, w_scale_down);
+    }
+
+    void setM(int M) {
+        if (m_M >= M) {
+            return;
+        }
+        const auto K = static_cast<size_t>(m_config.hidden_size);
+        m_src.resize<float>({static_cast<size_t>(M), K});
+        m_act.resize<float>({static_cast<size_t>(M), static_cast<size_t>(m_N)});
+        m_tiles.resize<float>(
+            {static_cast<size_t>(m_threads_num), 2, static_cast<size_t>(M), static_cast<size_t>(AVX_BLK_N_SIZE)});
+        if (m_config.gate_up_quantized) {
+            m_quant_act.M = M;
+            m_quant_act.K = m_config.hidden_size;
+            m_quant_buf[0].resize<uint8_t>({m_quant_act.size()});
+            m_quant_act.setup(m_quant_buf[0].ptr<uint8_t>());
+        }
+        if (m_config.down_quantized) {
+            m_quant_up_act.M = M;
+            m_quant_up_act.K = m_N;
+            m_quant_buf[1].resize<uint8_t>({m_quant_up_act.size()});
+            m_quant_up_act.setup(m_quant_buf[1].ptr<uint8_t>());
+        }
+        m_M = M;
+    }
+
+    // m_act[BM, N] = act(src * gate^T) * (src * up^T)
+    void runGateUp(const float* src, int strideSrc, int BM) {
+        const bool gelu = m_config.act == LLMMLPNode::ACT_FN::GELU;
+        const int num_tiles = (m_N + AVX_BLK_N_SIZE - 1) / AVX_BLK_N_SIZE;
+        ov::parallel_nt_static(m_threads_num, [&](const size_t ithr, const size_t nthr) {
+            size_t start{0};
+            size_t end{0};
+            splitter(static_cast<size_t>(num_tiles), nthr, ithr, start, end);
+            auto* gate = m_tiles.ptr<float>(ithr, 0);
+            auto* up = m_tiles.ptr<float>(ithr, 1);
+            for (auto tile = start; tile < end; tile++) {
+                const int n0 = static_cast<int>(tile) * AVX_BLK_N_SIZE;
+                const int BN = std::min(AVX_BLK_N_SIZE, m_N - n0);
+                m_gate.run(src, strideSrc, m_quant_act, BM, n0, BN, gate, AVX_BLK_N_SIZE);
+                m_up.run(src, strideSrc, m_quant_act, BM, n0, BN, up, AVX_BLK_N_SIZE);
+                for (int m = 0; m < BM; m++) {
+                    ov::Extensions::Cpu::XARCH::llm_mlp_act_mul(gate + m * AVX_BLK_N_SIZE,
+                                                                up + m * AVX_BLK_N_SIZE,
+                                                                m_act.ptr<float>(m, n0),
+                                                                BN,
+                                                                gelu);
+                }
+            }
+        });
+    }
+
+    // dst[BM, hidden_size] = m_act * down^T, dst is T or f32 for the partial sums of a tensor parallel rank
+    template <typename D>
+    void runDown(D* dst, size_t strideDst, int BM) {
+        const float* act = m_act.ptr<float>();
+        const auto strideAct = static_cast<int>(m_act.stride(0));
+        if (m_config.down_quantized) {
+            m_quant_up_act.quantize(BM, m_act.ptr<float>(), strideAct);
+        }
+        const int hidden_size = m_config.hidden_size;
+        const int num_tiles = (hidden_size + AVX_BLK_N_SIZE - 1) / AVX_BLK_N_SIZE;
+        ov::parallel_nt_static(m_threads_num, [&](const size_t ithr, const size_t nthr) {
+            size_t start{0};
+            size_t end{0};
+            splitter(static_cast<size_t>(num_tiles), nthr, ithr, start, end);
+            auto* out = m_tiles.ptr<float>(ithr, 0);
+            for (auto tile = start; tile < end; tile++) {
+                const int n0 = static_cast<int>(tile) * AVX_BLK_N_SIZE;
+                const int BN = std::min(AVX_BLK_N_SIZE, hidden_size - n0);
+                m_down.run(act, strideAct, m_quant_up_act, BM, n0, BN, out, AVX_BLK_N_SIZE);
+                for (int m = 0; m < BM; m++) {
+                    for (int n = 0; n < BN; n++) {
+                        dst[m * strideDst + n0 + n] = static_cast<D>(out[m * AVX_BLK_N_SIZE + n]);
+                    }
+                }
+            }
+        });
+    }
+
+    void execute() override {
+        auto input = m_pnode->getSrcMemoryAtPort(0);
+        const auto& ishape = input->getStaticDims();
+        auto* pA = input->getDataAs<T>();
+        const auto& srcStrides = input->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const size_t strideA = srcStrides[srcStrides.size() - 2];
+        const int M = shape_size(ishape) / ishape[ishape.size() - 1];
+
+        auto output = m_pnode->getDstMemoryAtPort(0);
+        auto* dst = output->getDataAs<T>();
+        const auto& dstStrides = output->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const size_t strideDst = dstStrides[dstStrides.size() - 2];
+        const auto hidden_size = static_cast<size_t>(m_config.hidden_size);
+        auto* dstC = dst;
+        // the partial sums of a tensor parallel rank are kept in f32 till the all-reduce
+        float* partialC = nullptr;
+        if (m_tp_enabled) {
+            m_tp_partial.resize<float>({static_cast<size_t>(M), hidden_size});
+            partialC = m_tp_partial.ptr<float>();
+        }
+
+        for (int m = 0; m < M;) {
+            const int BM = std::min(M - m, CACHE_BLK_M_SIZE);
+            setM(BM);
+
+            int strideSrc = 0;
+            const float* src = nullptr;
+            if (m_config.gate_up_quantized) {
+                m_quant_act.quantize(BM, pA, static_cast<int>(strideA));
+            } else {
+                src = rows_to_f32(pA, strideA, BM, hidden_size, m_src, strideSrc);
+            }
+            runGateUp(src, strideSrc, BM);
+            if (m_tp_enabled) {
+                runDown(partialC, hidden_size, BM);
+                partialC += BM * hidden_size;
+            } else {
+                runDown(dstC, strideDst, BM);
+                dstC += BM * strideDst;
+            }
+
+            m += BM;
+            pA += BM * strideA;
+        }
+
+        if (m_tp_enabled) {
+            allReduce(m_pnode->m_tp, m_tp_partial.ptr<float>(), dst, strideDst, M, hidden_size);
+        }
+    }
+};
 #else
 template <typename T>
 struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
@@ -543,10 +909,21 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
 
     void execute() override {}
 };
+
+template <typename T>
+struct LLMMLP::AvxExecutor : public LLMMLP::ExecutorBase {
+    AvxExecutor(LLMMLP* node, const LLMMLPNode::Config& config) {
+        (void)node;
+        (void)config;
+    }
+
+    void execute() override {}
+};
 #endif
 
 LLMMLP::LLMMLP(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
-    : Node(op, context, NgraphShapeInferFactory(op)) {
+    : Node(op, context, NgraphShapeInferFactory(op)),
+      m_tp(context) {
     std::string errorMessage;
     const auto& config = context->getConfig();
     if (!isSupportedOperation(op, errorMessage, config.fcDynamicQuantizationGroupSize)) {
@@ -567,7 +944,7 @@ void LLMMLP::initSupportedPrimitiveDescriptors() {
     auto rtPrecision = getOriginalInputPrecisionAtPort(0);
 
     if (rtPrecision == ov::element::f32) {
-        // fallback to supported precision if possible
+        // fallback to supported precision if possible, the CPUs without AMX run f32 as is
         if (ov::with_cpu_x86_avx512_core_amx_fp16()) {
             rtPrecision = ov::element::f16;
         } else if (ov::with_cpu_x86_avx512_core_amx()) {
@@ -575,7 +952,9 @@ void LLMMLP::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    OPENVINO_ASSERT(any_of(rtPrecision, ov::element::bf16, ov::element::f16), "Unexpected rtPrecision:", rtPrecision);
+    OPENVINO_ASSERT(any_of(rtPrecision, ov::element::bf16, ov::element::f16, ov::element::f32),
+                    "Unexpected rtPrecision:",
+                    rtPrecision);
 
     if (m_mlp_config.gate_up_quantized) {
         auto weightPrecision = ov::element::i8;
@@ -627,10 +1006,16 @@ void LLMMLP::initSupportedPrimitiveDescriptors() {
 void LLMMLP::createPrimitive() {
     auto rtPrecision = getInputPrecisions()[0];
 #ifdef OPENVINO_ARCH_X86_64
-    if (rtPrecision == ov::element::bf16) {
+    if (rtPrecision == ov::element::bf16 && ov::with_cpu_x86_avx512_core_amx()) {
         m_executor = std::make_shared<Executor<ov::bfloat16>>(this, m_mlp_config, context->getScratchPad());
-    } else if (rtPrecision == ov::element::f16) {
+    } else if (rtPrecision == ov::element::f16 && ov::with_cpu_x86_avx512_core_amx_fp16()) {
         m_executor = std::make_shared<Executor<ov::float16>>(this, m_mlp_config, context->getScratchPad());
+    } else if (rtPrecision == ov::element::bf16) {
+        m_executor = std::make_shared<AvxExecutor<ov::bfloat16>>(this, m_mlp_config);
+    } else if (rtPrecision == ov::element::f16) {
+        m_executor = std::make_shared<AvxExecutor<ov::float16>>(this, m_mlp_config);
+    } else if (rtPrecision == ov::element::f32) {
+        m_executor = std::make_shared<AvxExecutor<float>>(this, m_mlp_config);
     }
 #endif
     if (!m_executor) {
@@ -647,6 +1032,10 @@ bool LLMMLP::isSupportedOperation([[maybe_unused]] const std::shared_ptr<const o
                                   [[maybe_unused]] uint64_t fcDynamicQuantizationGroupSize) noexcept {
 #if defined(OPENVINO_ARCH_X86_64)
     try {
+        if (!ov::with_cpu_x86_avx2()) {
+            errorMessage = "LLMMLPNode requires AVX2 at least";
+            return false;
+        }
         const auto node_mlp = ov::as_type_ptr<const LLMMLPNode>(op);
         if (node_mlp) {
             auto down_proj_w_pshape = op->input_value(1).get_partial_shape();
@@ -12,6 +12,7 @@
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
+#include "nodes/common/tensor_parallel.h"
 #include "openvino/core/node.hpp"
 #include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
 
@@ -46,7 +47,12 @@ private:
     std::shared_ptr<ExecutorBase> m_executor;
     template <typename T>
     struct Executor;
+    // the CPUs without AMX
+    template <typename T>
+    struct AvxExecutor;
     LLMMLPNode::Config m_mlp_config{};
+    // each tensor parallel rank computes its shard of the intermediate channels, the partial outputs are all-reduced
+    TensorParallelComm m_tp;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lm_head_sampling.h"
+
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "nodes/kernels/x64/lm_head_sampling.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/x64/op/lm_head_sampling.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+LMHeadSampling::LMHeadSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    m_config = ov::as_type_ptr<const LMHeadSamplingNode>(op)->get_config();
+}
+
+void LMHeadSampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs;
+    std::vector<PortConfigurator> outPortConfigs;
+
+    // the logits are accumulated in f32 from the f16 weights whatever the inference precision is
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(0), false, -1);  // input
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f16, getInputShapeAtPort(1), false, -1);  // weights
+
+    outPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getOutputShapeAtPort(0), false, -1);  // values
+    outPortConfigs.emplace_back(LayoutType::ncsp, ov::element::i32, getOutputShapeAtPort(1), false, -1);  // indices
+    if (m_config.with_logits) {
+        outPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getOutputShapeAtPort(2), false, -1);
+    }
+    addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
+}
+
+void LMHeadSampling::createPrimitive() {
+    LMHeadSampler::Params params;
+    params.sample = m_config.sample;
+    params.top_k = m_config.top_k;
+    params.top_p = m_config.top_p;
+    params.temperature = m_config.temperature;
+    m_sampler = std::make_shared<LMHeadSampler>(getSrcDataAtPortAs<const ov::float16>(1),
+                                                m_config.hidden_size,
+                                                m_config.vocab_size,
+                                                m_config.hidden_size,
+                                                params);
+}
+
+void LMHeadSampling::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const auto& ishape = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto M = static_cast<int>(shape_size(ishape) / ishape.back());
+
+    if (m_config.sample) {
+        // same random stream as Multinomial, so the fused graph draws the same tokens
+        std::mt19937 gen;
+        if (all_of(0U, m_config.global_seed, m_config.op_seed)) {
+            const auto t = static_cast<uint64_t>(std::time(nullptr));
+            std::seed_seq seed{static_cast<uint32_t>(t), static_cast<uint32_t>(t >> 32)};
+            gen.seed(seed);
+        } else {
+            std::seed_seq seed{m_config.global_seed, m_config.op_seed};
+            gen.seed(seed);
+        }
+        const auto gen_max = static_cast<float>(std::mt19937::max());
+        m_random.resize(M);
+        for (auto& random : m_random) {
+            random = static_cast<float>(gen()) / gen_max;
+        }
+    }
+
+    float* logits = m_config.with_logits ? getDstDataAtPortAs<float>(2) : nullptr;
+    m_sampler->run(getSrcDataAtPortAs<const float>(0),
+                   m_config.hidden_size,
+                   M,
+                   m_random.data(),
+                   getDstDataAtPortAs<float>(0),
+                   getDstDataAtPortAs<int32_t>(1),
+                   logits,
+                   m_config.vocab_size);
+}
+
+bool LMHeadSampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                          std::string& errorMessage) noexcept {
+    try {
+        const auto node = ov::as_type_ptr<const LMHeadSamplingNode>(op);
+        if (!node) {
+            errorMessage = "Only LMHeadSampling operation is supported";
+            return false;
+        }
+        if (!ov::with_cpu_x86_avx2()) {
+            errorMessage = "LMHeadSampling requires AVX2 at least";
+            return false;
+        }
+        const auto& config = node->get_config();
+        if (!op->get_input_partial_shape(1).is_static()) {
+            errorMessage = "LMHeadSampling weight shape is not static";
+            return false;
+        }
+        if (config.top_k > LM_HEAD_MAX_CANDIDATES) {
+            errorMessage = "LMHeadSampling top_k is too large";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace ov::intel_cpu::node
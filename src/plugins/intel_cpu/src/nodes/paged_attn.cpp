@@ -10,15 +10,21 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include "common/cpu_memcpy.h"
 #include "config.h"
 #include "cpu_memory.h"
+#include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
+#include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
 #include "nodes/common/blocked_desc_creator.h"
+#include "nodes/common/tensor_parallel.h"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
@@ -85,7 +91,8 @@ bool PagedAttentionKey::operator==(const PagedAttentionKey& rhs) const {
 }
 
 PagedAttention::PagedAttention(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
-    : Node(op, context, InternalDynShapeInferFactory()) {
+    : Node(op, context, InternalDynShapeInferFactory()),
+      m_tp(context) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
@@ -106,6 +113,12 @@ PagedAttention::PagedAttention(const std::shared_ptr<ov::Node>& op, const GraphC
                     "Runtime info k_head_size and num_k_heads are required for PagedAttention node.");
     m_head_size = rt.at("k_head_size").as<size_t>();
     m_num_kv_heads = rt.at("num_k_heads").as<size_t>();
+    // scores are summed over all the heads, keep the whole attention on every rank when they are requested
+    if (m_tp.enabled() && !m_hasScore && !m_has_adaptive_rkv_diversity_output &&
+        m_num_kv_heads >= static_cast<size_t>(m_tp.size())) {
+        m_tp_enabled = true;
+        std::tie(m_tp_kv_begin, m_tp_kv_end) = m_tp.part(m_num_kv_heads);
+    }
 }
 
 void PagedAttention::initSupportedPrimitiveDescriptors() {
@@ -286,7 +299,7 @@ void PagedAttention::createPrimitive() {
                              kCachePrecision,
                              vCachePrecision,
                              m_head_size,
-                             m_num_kv_heads,
+                             m_tp_enabled ? m_tp_kv_end - m_tp_kv_begin : m_num_kv_heads,
                              quantKeybyChannel,
                              quantValuebyChannel,
                              cpuConfig.enableSageAttn};
@@ -319,6 +332,30 @@ void PagedAttention::createPrimitive() {
     m_executor = result.first;
 }
 
+// Dense copy of the columns [begin, end) of the 2D `src` into `dst`
+static void copy_columns(const dnnl::engine& eng,
+                         const MemoryPtr& src,
+                         size_t begin,
+                         size_t end,
+                         MemoryPtr& dst,
+                         const CpuParallel& cpu_parallel) {
+    const auto& dims = src->getStaticDims();
+    const auto prec = src->getPrecision();
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(prec, Shape(VectorDims{dims[0], end - begin}));
+    if (dst) {
+        dst->redefineDesc(desc);
+    } else {
+        dst = std::make_shared<Memory>(eng, desc);
+    }
+    const size_t src_stride = src->getDescWithType<BlockedMemoryDesc>()->getStrides()[0] * prec.size();
+    const size_t row_bytes = (end - begin) * prec.size();
+    const auto* src_ptr = src->getDataAs<const uint8_t>() + begin * prec.size();
+    auto* dst_ptr = dst->getDataAs<uint8_t>();
+    cpu_parallel.parallel_for(dims[0], [&](size_t i) {
+        cpu_memcpy(dst_ptr + i * row_bytes, src_ptr + i * src_stride, row_bytes);
+    });
+}
+
 void PagedAttention::execute([[maybe_unused]] const dnnl::stream& strm) {
     auto orginInputNumber = getOriginalInputsNumber();
     std::vector<MemoryPtr> inputs(orginInputNumber);
@@ -407,7 +444,57 @@ void PagedAttention::execute([[maybe_unused]] const dnnl::stream& strm) {
         }
     }
 
+    if (!m_tp_enabled) {
+        m_executor->execute(inputs, outputs, m_write_kv_cache);
+        return;
+    }
+
+    // q: [B_token, H * S], k: [B_token, Hk * S], v: [B_token, Hk * SV], caches: [blocks, Hk, block_size, S]
+    const size_t Q_IDX = PagedAttentionExecutor::ID_Q;
+    const size_t K_IDX = PagedAttentionExecutor::ID_K;
+    const size_t V_IDX = PagedAttentionExecutor::ID_V;
+    const size_t K_CACHE_IDX = PagedAttentionExecutor::ID_KCACHE;
+    const size_t V_CACHE_IDX = PagedAttentionExecutor::ID_VCACHE;
+    const size_t ALIBI_IDX = PagedAttentionExecutor::ID_ALIBI_SLOPES;
+    const size_t SINKS_IDX = PagedAttentionExecutor::ID_SINKS;
+    const auto& cpu_parallel = *context->getCpuParallel();
+    const size_t H = inputs[Q_IDX]->getStaticDims()[1] / m_head_size;
+    const size_t SV = valueDims[1] / m_num_kv_heads;
+    const size_t group = H / m_num_kv_heads;
+    const size_t h0 = m_tp_kv_begin * group;
+    const size_t h1 = m_tp_kv_end * group;
+    CPU_NODE_ASSERT(inputs[K_CACHE_IDX]->getStaticDims()[1] == m_num_kv_heads,
+                    "expects ",
+                    m_num_kv_heads,
+                    " kv heads in the key cache");
+    const auto& eng = getEngine();
+    copy_columns(eng, inputs[Q_IDX], h0 * m_head_size, h1 * m_head_size, m_tp_q, cpu_parallel);
+    copy_columns(eng, inputs[K_IDX], m_tp_kv_begin * m_head_size, m_tp_kv_end * m_head_size, m_tp_k, cpu_parallel);
+    copy_columns(eng, inputs[V_IDX], m_tp_kv_begin * SV, m_tp_kv_end * SV, m_tp_v, cpu_parallel);
+    inputs[Q_IDX] = m_tp_q;
+    inputs[K_IDX] = m_tp_k;
+    inputs[V_IDX] = m_tp_v;
+    inputs[K_CACHE_IDX] = slice_memory_view(eng, inputs[K_CACHE_IDX], 1, m_tp_kv_begin, m_tp_kv_end);
+    inputs[V_CACHE_IDX] = slice_memory_view(eng, inputs[V_CACHE_IDX], 1, m_tp_kv_begin, m_tp_kv_end);
+    // alibi: [H|0], sinks: [1, H, 1, 1]
+    if (orginInputNumber > ALIBI_IDX && inputs[ALIBI_IDX]->getShape().getElementsCount() > 0) {
+        inputs[ALIBI_IDX] = slice_memory_view(eng, inputs[ALIBI_IDX], 0, h0, h1);
+    }
+    if (orginInputNumber > SINKS_IDX && inputs[SINKS_IDX]->getShape().getElementsCount() > 0) {
+        inputs[SINKS_IDX] = slice_memory_view(eng, inputs[SINKS_IDX], 1, h0, h1);
+    }
+
+    const auto prec = outputs[0]->getPrecision();
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(prec, Shape(VectorDims{outDims[0], (h1 - h0) * SV}));
+    if (m_tp_output) {
+        m_tp_output->redefineDesc(desc);
+    } else {
+        m_tp_output = std::make_shared<Memory>(eng, desc);
+    }
+    auto output = outputs[0];
+    outputs[0] = m_tp_output;
     m_executor->execute(inputs, outputs, m_write_kv_cache);
+    m_tp.all_gather(m_tp_output->getData(), output->getData(), outDims[0], H, group, SV * prec.size());
 }
 
 bool PagedAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
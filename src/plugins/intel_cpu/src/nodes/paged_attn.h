@@ -12,6 +12,7 @@
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
+#include "nodes/common/tensor_parallel.h"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -65,6 +66,18 @@ private:
     bool m_hasScore = false;
     bool m_has_adaptive_rkv_diversity_output = false;
     bool m_write_kv_cache = true;
+
+    // Tensor parallel: the rank attends with the kv heads [m_tp_kv_begin, m_tp_kv_end) only, so it reads and writes
+    // only their part of the kv cache blocks. q/k/v of the rank are dense copies, the output is all-gathered.
+    // The cache blocks are user tensors shared by all the ranks, they are not sharded in the memory of each socket.
+    TensorParallelComm m_tp;
+    bool m_tp_enabled = false;
+    size_t m_tp_kv_begin = 0;
+    size_t m_tp_kv_end = 0;
+    MemoryPtr m_tp_q;
+    MemoryPtr m_tp_k;
+    MemoryPtr m_tp_v;
+    MemoryPtr m_tp_output;
 };
 
 }  // namespace ov::intel_cpu::node
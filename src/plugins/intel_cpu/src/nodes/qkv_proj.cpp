@@ -327,6 +327,126 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
         }
     }
 };
+
+// QKVProjection for the CPUs without AMX (AVX-512 or AVX2): the output channels of the 3 projections are split into
+// tiles of REG_BLK_N_SIZE which are distributed over all the threads, so no core count is preferred
+template <typename T>
+struct QKVProjection::AvxExecutor : public QKVProjection::ExecutorBase {
+    QKVProjection* m_node;
+    LinearAvx m_proj[3];
+    int m_M = 0;
+    int m_threads_num = 0;
+
+    PlainTensor m_src;    // f32 input [M, hidden_size]
+    PlainTensor m_tiles;  // f32 tile of each thread [nthr, M, REG_BLK_N_SIZE]
+    PlainTensor m_quant_buf;
+    MatrixDynQuantPerRow m_quant_act;
+
+    explicit AvxExecutor(QKVProjection* pnode) : m_node(pnode), m_threads_num(parallel_get_max_threads()) {
+        const auto& config = m_node->m_config;
+        const int proj_size[3] = {config.proj_size0, config.proj_size1, config.proj_size2};
+        PlainTensor w0(pnode->getSrcMemoryAtPort(1));
+        const auto K = static_cast<int>(w0.size(1));
+        const auto stride = static_cast<int>(w0.stride(0));
+        const auto weight_element_size = config.quantized ? sizeof(int8_t) : sizeof(ov::float16);
+
+        const float* w_scale[3] = {nullptr, nullptr, nullptr};
+        if (config.quantized) {
+            w_scale[0] = pnode->getSrcMemoryAtPort(4)->getDataAs<float>();
+            if (config.weights_combined) {
+                w_scale[1] = w_scale[0] + config.proj_size0;
+                w_scale[2] = w_scale[1] + config.proj_size1;
+            } else {
+                w_scale[1] = pnode->getSrcMemoryAtPort(5)->getDataAs<float>();
+                w_scale[2] = pnode->getSrcMemoryAtPort(6)->getDataAs<float>();
+            }
+        }
+
+        auto* ptr_weights = reinterpret_cast<const uint8_t*>(w0.ptr_v());
+        for (int i = 0; i < 3; i++) {
+            if (!config.weights_combined) {
+                ptr_weights = reinterpret_cast<const uint8_t*>(pnode->getSrcMemoryAtPort(1 + i)->getData());
+            }
+            m_proj[i].setup(ptr_weights, stride, proj_size[i], K, w_scale[i]);
+            ptr_weights += proj_size[i] * stride * weight_element_size;
+        }
+    }
+
+    void setM(int M) {
+        if (m_M >= M) {
+            return;
+        }
+        const auto K = static_cast<size_t>(m_node->m_config.hidden_size);
+        m_src.resize<float>({static_cast<size_t>(M), K});
+        m_tiles.resize<float>(
+            {static_cast<size_t>(m_threads_num), static_cast<size_t>(M), static_cast<size_t>(REG_BLK_N_SIZE)});
+        if (m_node->m_config.quantized) {
+            m_quant_act.M = M;
+            m_quant_act.K = m_node->m_config.hidden_size;
+            m_quant_buf.resize<uint8_t>({m_quant_act.size()});
+            m_quant_act.setup(m_quant_buf.ptr<uint8_t>());
+        }
+        m_M = M;
+    }
+
+    void execute() override {
+        auto input = m_node->getSrcMemoryAtPort(0);
+        const auto& ishape = input->getStaticDims();
+        auto* pA = input->getDataAs<T>();
+        const int M = shape_size(ishape) / ishape[ishape.size() - 1];
+        const auto& srcStrides = input->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const size_t strideA = srcStrides[1];
+
+        T* dst[3];
+        size_t stride_dst[3];
+        int tiles_end[3];
+        int num_tiles = 0;
+        for (int i = 0; i < 3; i++) {
+            auto output = m_node->getDstMemoryAtPort(i);
+            dst[i] = output->getDataAs<T>();
+            stride_dst[i] = output->getDescWithType<BlockedMemoryDesc>()->getStrides()[1];
+            num_tiles += (m_proj[i].N + REG_BLK_N_SIZE - 1) / REG_BLK_N_SIZE;
+            tiles_end[i] = num_tiles;
+        }
+
+        for (int m = 0; m < M;) {
+            const int BM = std::min(M - m, CACHE_BLK_M_SIZE);
+            setM(BM);
+
+            int strideSrc = 0;
+            const float* src = nullptr;
+            if (m_node->m_config.quantized) {
+                m_quant_act.quantize(BM, pA, static_cast<int>(strideA));
+            } else {
+                src = rows_to_f32(pA, strideA, BM, m_node->m_config.hidden_size, m_src, strideSrc);
+            }
+
+            ov::parallel_nt_static(m_threads_num, [&](const size_t ithr, const size_t nthr) {
+                size_t start{0};
+                size_t end{0};
+                splitter(static_cast<size_t>(num_tiles), nthr, ithr, start, end);
+                auto* out = m_tiles.ptr<float>(ithr);
+                for (auto tile = static_cast<int>(start); tile < static_cast<int>(end); tile++) {
+                    const int id = tile < tiles_end[0] ? 0 : (tile < tiles_end[1] ? 1 : 2);
+                    const int n0 = (id == 0 ? tile : tile - tiles_end[id - 1]) * REG_BLK_N_SIZE;
+                    const int BN = std::min(REG_BLK_N_SIZE, m_proj[id].N - n0);
+                    m_proj[id].run(src, strideSrc, m_quant_act, BM, n0, BN, out, REG_BLK_N_SIZE);
+                    for (int mi = 0; mi < BM; mi++) {
+                        for (int n = 0; n < BN; n++) {
+                            dst[id][mi * stride_dst[id] + n0 + n] = static_cast<T>(out[mi * REG_BLK_N_SIZE + n]);
+                        }
+                    }
+                }
+            });
+
+            m += BM;
+            pA += BM * strideA;
+            for (int i = 0; i < 3; i++) {
+                dst[i] += BM * stride_dst[i];
+            }
+        }
+    }
+};
 #else
 template <typename T>
 struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
@@ -334,15 +454,28 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
     explicit Executor(QKVProjection* pnode) : m_pnode(pnode) {}
     void execute() override {}
 };
+
+template <typename T>
+struct QKVProjection::AvxExecutor : public QKVProjection::ExecutorBase {
+    QKVProjection* m_pnode;
+    explicit AvxExecutor(QKVProjection* pnode) : m_pnode(pnode) {}
+    void execute() override {}
+};
 #endif
 
 void QKVProjection::createPrimitive() {
     auto rtPrecision = getInputPrecisions()[0];
 #ifdef OPENVINO_ARCH_X86_64
-    if (rtPrecision == ov::element::bf16) {
+    if (rtPrecision == ov::element::bf16 && ov::with_cpu_x86_avx512_core_amx()) {
         m_executor = std::make_shared<Executor<ov::bfloat16>>(this, context->getScratchPad());
-    } else if (rtPrecision == ov::element::f16) {
+    } else if (rtPrecision == ov::element::f16 && ov::with_cpu_x86_avx512_core_amx_fp16()) {
         m_executor = std::make_shared<Executor<ov::float16>>(this, context->getScratchPad());
+    } else if (rtPrecision == ov::element::bf16) {
+        m_executor = std::make_shared<AvxExecutor<ov::bfloat16>>(this);
+    } else if (rtPrecision == ov::element::f16) {
+        m_executor = std::make_shared<AvxExecutor<ov::float16>>(this);
+    } else if (rtPrecision == ov::element::f32) {
+        m_executor = std::make_shared<AvxExecutor<float>>(this);
     }
 #endif
     if (!m_executor) {
@@ -382,7 +515,7 @@ void QKVProjection::initSupportedPrimitiveDescriptors() {
     auto rtPrecision = getOriginalInputPrecisionAtPort(0);
 
     if (rtPrecision == ov::element::f32) {
-        // fallback to supported precision if possible
+        // fallback to supported precision if possible, the CPUs without AMX run f32 as is
         if (ov::with_cpu_x86_avx512_core_amx_fp16()) {
             rtPrecision = ov::element::f16;
         } else if (ov::with_cpu_x86_avx512_core_amx()) {
@@ -390,7 +523,9 @@ void QKVProjection::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    CPU_NODE_ASSERT(any_of(rtPrecision, ov::element::bf16, ov::element::f16), "Unexpected rtPrecision:", rtPrecision);
+    CPU_NODE_ASSERT(any_of(rtPrecision, ov::element::bf16, ov::element::f16, ov::element::f32),
+                    "Unexpected rtPrecision:",
+                    rtPrecision);
 
     if (m_config.quantized) {
         auto weightPrecision = ov::element::i8;
@@ -444,9 +579,14 @@ bool QKVProjection::isSupportedOperation([[maybe_unused]] const std::shared_ptr<
                                          [[maybe_unused]] uint64_t fcDynamicQuantizationGroupSize) noexcept {
 #if defined(OPENVINO_ARCH_X86_64)
     try {
+        if (!ov::with_cpu_x86_avx2()) {
+            errorMessage = "QKVProjection requires AVX2 at least";
+            return false;
+        }
         const auto node_qkv = ov::as_type_ptr<const QKVProjectionNode>(op);
         if (node_qkv) {
-            if (concurrency > 0) {
+            // only the AMX executor splits the cores into 3 groups, one per projection
+            if (concurrency > 0 && ov::with_cpu_x86_avx512_core_amx()) {
                 if (concurrency < 3) {
                     errorMessage = "QKVProjection needs at least 3 cores to work";
                     return false;
@@ -50,6 +50,9 @@ private:
     std::shared_ptr<ExecutorBase> m_executor;
     template <typename T>
     struct Executor;
+    // the CPUs without AMX
+    template <typename T>
+    struct AvxExecutor;
 
     QKVProjectionNode::Config m_config = {};
 };
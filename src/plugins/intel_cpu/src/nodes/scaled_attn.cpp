@@ -4,6 +4,7 @@
 
 #include "scaled_attn.h"
 
+#include <array>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
@@ -15,17 +16,21 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <tuple>
 
 #include "cpu_memory.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
+#include "kv_cache_offload.hpp"
+#include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "memory_state.h"
 #include "node.h"
 #include "nodes/common/blocked_desc_creator.h"
+#include "nodes/common/tensor_parallel.h"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -1841,7 +1846,8 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
 
 ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::Node>& op,
                                                      const GraphContext::CPtr& context)
-    : Node(op, context, SDPAShapeInferFactory(op)) {
+    : Node(op, context, SDPAShapeInferFactory(op)),
+      m_tp(context) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
@@ -2001,6 +2007,9 @@ void ScaledDotProductAttention::createPrimitive() {
     if (m_config.config.fuse_concat) {
         auto* desc = getSelectedPrimitiveDescriptor();
         CPU_NODE_ASSERT(desc, "has unidentified preferable primitive descriptor");
+        if (const auto& kv_offload = context->getKVCacheOffload()) {
+            m_kv_offload_id = kv_offload->registerCache();
+        }
     }
     auto rtPrecision = getRuntimePrecision();
     const auto keyDims = getInputShapeAtPort(1).getDims();
@@ -2126,6 +2135,50 @@ void ScaledDotProductAttention::createPrimitive() {
         const auto* src = ov::Extensions::Cpu::turboq_get_wht_signs(static_cast<int>(head_dim));
         std::copy(src, src + head_dim, m_wht_signs.ptr<float>());
     }
+
+    initTensorParallel();
+}
+
+void ScaledDotProductAttention::initTensorParallel() {
+    m_tp_kv_heads = 0;
+    // the kv cache state of a stateful node is read and written by the user as a whole (get_state/set_state), so it
+    // keeps all the heads on every rank and the node is not partitioned: only the stateless attention is split
+    if (!m_tp.enabled() || m_config.config.input_BLHxS || m_config.config.fuse_concat) {
+        return;
+    }
+    const auto& qDims = getInputShapeAtPort(0).getDims();
+    const auto& keyDims = getInputShapeAtPort(1).getDims();
+    if (qDims.size() != 4 || keyDims.size() != 4) {
+        return;
+    }
+    const auto axis = getHeadAxis();
+    const auto H = qDims[axis];
+    const auto Hk = keyDims[axis];
+    if (any_of(Shape::UNDEFINED_DIM, H, Hk) || Hk < static_cast<size_t>(m_tp.size()) || H % Hk != 0) {
+        return;
+    }
+    // a boolean mask is converted densely by the executor, it cannot be a strided view of the heads
+    const auto sdpaInputs = getOriginalInputsNumber();
+    if (sdpaInputs > 3 && any_of(getOriginalInputPrecisionAtPort(3), ov::element::boolean, ov::element::u8)) {
+        return;
+    }
+    m_tp_kv_heads = Hk;
+    std::tie(m_tp_kv_begin, m_tp_kv_end) = m_tp.part(Hk);
+}
+
+MemoryPtr ScaledDotProductAttention::sliceHeads(const MemoryPtr& mem, size_t axis, size_t heads) const {
+    if (heads == 1) {
+        // broadcast over the heads
+        return mem;
+    }
+    CPU_NODE_ASSERT(heads % m_tp_kv_heads == 0,
+                    "cannot partition ",
+                    heads,
+                    " heads by ",
+                    m_tp_kv_heads,
+                    " kv heads for tensor parallel");
+    const auto group = heads / m_tp_kv_heads;
+    return slice_memory_view(getEngine(), mem, axis, m_tp_kv_begin * group, m_tp_kv_end * group);
 }
 
 ov::Extensions::Cpu::StridedData<float> ScaledDotProductAttention::get_per_thread_scratch() const {
@@ -2139,17 +2192,48 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     auto orginSDPInputNumber = getOriginalInputsNumber() - (m_config.config.fuse_concat ? 3 : 0);
     std::vector<MemoryPtr> inputs(orginSDPInputNumber);
     auto output = getDstMemoryAtPort(0);
+    MemoryPtr full_output;
+    size_t gather_heads = 0;
     MemoryPtr presentk_input;
     MemoryPtr presentv_input;
     MemoryPtr beam_input;
     for (size_t i = 0; i < orginSDPInputNumber; i++) {
         inputs[i] = getSrcMemoryAtPort(i);
     }
+    if (m_tp_kv_heads) {
+        // q/k/v: [B, H, L, S] after permute, mask/sink/alibi: [.., H|1, L1, L0+L1], the heads of the rank are views
+        const auto axis = getHeadAxis();
+        for (size_t i = 0; i < orginSDPInputNumber; i++) {
+            const auto& dims = inputs[i]->getStaticDims();
+            if (i < 3) {
+                inputs[i] = sliceHeads(inputs[i], axis, dims[axis]);
+            } else if (i != 4 && dims.size() >= 3) {
+                inputs[i] = sliceHeads(inputs[i], dims.size() - 3, dims[dims.size() - 3]);
+            }
+        }
+        auto local_dims = output->getStaticDims();
+        const auto H = local_dims[1];
+        local_dims[1] = inputs[0]->getStaticDims()[axis];
+        auto desc = std::make_shared<CpuBlockedMemoryDesc>(output->getPrecision(), Shape(local_dims));
+        if (m_tp_output) {
+            m_tp_output->redefineDesc(desc);
+        } else {
+            m_tp_output = std::make_shared<Memory>(getEngine(), desc);
+        }
+        full_output = output;
+        output = m_tp_output;
+        gather_heads = H;
+    }
 
     PlainTensor k_scale_zp;
     PlainTensor v_scale_zp;
+    const auto& kv_offload = context->getKVCacheOffload();
     if (m_config.config.fuse_concat) {
         CPU_NODE_ASSERT(m_k_state && m_v_state, "has null input states");
+        if (kv_offload) {
+            // the cold tokens of the next attention are read while this one runs
+            kv_offload->acquire(m_kv_offload_id);
+        }
         // initialization will be also completed in this func
         gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
 
@@ -2179,6 +2263,22 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
                         m_k_quant_meta_data,
                         m_v_quant_meta_data,
                         m_wht_signs);
+    if (kv_offload && m_config.config.fuse_concat) {
+        // beam table [B, L0 + L1]
+        releaseKVCache(beam_input->getStaticDims()[1]);
+    }
+
+    if (full_output) {
+        // output [B, H, L1, SV]: concatenate the heads of all the ranks
+        const auto& dims = full_output->getStaticDims();
+        const size_t head_bytes = dims[2] * dims[3] * full_output->getPrecision().size();
+        m_tp.all_gather(output->getData(),
+                        full_output->getData(),
+                        dims[0],
+                        gather_heads,
+                        gather_heads / m_tp_kv_heads,
+                        head_bytes);
+    }
 }
 
 bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
@@ -2297,6 +2397,62 @@ static std::vector<size_t> compute_scale_zp_shape(const ov::Extensions::Cpu::Cac
     return permute_axes(bhls_to_model_shape(bhls, order), real_order);
 }
 
+namespace {
+// memory block over the file of a KV cache, the content is kept when the block grows
+class MappedFileMemoryBlock : public IMemoryBlock {
+public:
+    explicit MappedFileMemoryBlock(std::shared_ptr<MappedFile> file) : m_file(std::move(file)) {}
+
+    [[nodiscard]] void* getRawPtr() const noexcept override {
+        return m_file->data();
+    }
+    void setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) override {
+        OPENVINO_THROW("The KV cache file memory can't use an external buffer");
+    }
+    bool resize(size_t size) override {
+        return m_file->resize(size);
+    }
+    [[nodiscard]] bool hasExtBuffer() const noexcept override {
+        return false;
+    }
+
+private:
+    std::shared_ptr<MappedFile> m_file;
+};
+}  // namespace
+
+MemoryPtr ScaledDotProductAttention::allocKVCacheMemory(const MemoryDescPtr& desc, size_t capacity, size_t idx) {
+    const auto& kv_offload = context->getKVCacheOffload();
+    auto file = kv_offload ? kv_offload->allocate(capacity) : nullptr;
+    m_kv_files[idx] = {};
+    if (!file) {
+        return std::make_shared<Memory>(getEngine(), desc);
+    }
+    auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<MappedFileMemoryBlock>(file));
+    auto mem = std::make_shared<Memory>(getEngine(), desc, block);
+    m_kv_files[idx] = {mem, std::move(file)};
+    return mem;
+}
+
+void ScaledDotProductAttention::releaseKVCache(size_t tokens) {
+    const auto& kv_offload = context->getKVCacheOffload();
+    const size_t hot = kv_offload->hotTokens();
+    const size_t cold = tokens > hot ? tokens - hot : 0;
+    const std::array<MemoryPtr, 2> mems{m_k_state->internal_state_mem(), m_v_state->internal_state_mem()};
+    std::vector<KVCacheOffload::Region> regions;
+    for (size_t i = 0; i < mems.size(); i++) {
+        // the caches assigned by set_state() stay in RAM until they grow
+        if (cold == 0 || mems[i] != m_kv_files[i].mem.lock()) {
+            continue;
+        }
+        // L is the outermost dimension of the LBHS layout
+        const auto desc = mems[i]->getDescWithType<BlockedMemoryDesc>();
+        const size_t token_bytes = desc->getStrides()[0] * desc->getPrecision().bitwidth() / 8;
+        regions.push_back({m_kv_files[i].file, cold * token_bytes});
+    }
+    kv_offload->release(m_kv_offload_id, std::move(regions));
+}
+
 void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                      const MemoryPtr& mem_cur_v,
                                                      const MemoryPtr& mem_beam_idx) {
@@ -2373,9 +2529,9 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
     }
     {
         auto mem_desc_k = make_kv_cache_desc(k_kvcache_precision, B, H, (L0 + L1) * 2, S_cache, order, real_order);
-        auto new_internal_mem_k = std::make_shared<Memory>(getEngine(), mem_desc_k);
+        auto new_internal_mem_k = allocKVCacheMemory(mem_desc_k, (L0 + L1) * 2, 0);
         auto mem_desc_v = make_kv_cache_desc(v_kvcache_precision, B, H, (L0 + L1) * 2, SV_cache, order, real_order);
-        auto new_internal_mem_v = std::make_shared<Memory>(getEngine(), mem_desc_v);
+        auto new_internal_mem_v = allocKVCacheMemory(mem_desc_v, (L0 + L1) * 2, 1);
 
         PlainTensor new_pastk;
         PlainTensor new_pastv;
@@ -2797,12 +2953,10 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     }
     bool need_redefine = true;
     if (B * H * (L0 + L1) * S_cache > m_k_state->internal_state_max_size()) {
-        auto new_internal_mem_k = std::make_shared<Memory>(
-            getEngine(),
-            make_kv_cache_desc(k_kvcache_precision, B, H, (L0 + L1) * 2, S_cache, order, real_order));
-        auto new_internal_mem_v = std::make_shared<Memory>(
-            getEngine(),
-            make_kv_cache_desc(v_kvcache_precision, B, H, (L0 + L1) * 2, SV_cache, order, real_order));
+        auto mem_desc_k = make_kv_cache_desc(k_kvcache_precision, B, H, (L0 + L1) * 2, S_cache, order, real_order);
+        auto mem_desc_v = make_kv_cache_desc(v_kvcache_precision, B, H, (L0 + L1) * 2, SV_cache, order, real_order);
+        auto new_internal_mem_k = allocKVCacheMemory(mem_desc_k, (L0 + L1) * 2, 0);
+        auto new_internal_mem_v = allocKVCacheMemory(mem_desc_v, (L0 + L1) * 2, 1);
 
         PlainTensor new_pastk;
         PlainTensor new_pastv;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -16,8 +17,10 @@
 #include "kernels/scaled_attn/cache_spec.hpp"
 #include "kernels/scaled_attn/codecs/codec_kernels.hpp"
 #include "kernels/scaled_attn/mha_kv_cache_codec.hpp"
+#include "kv_cache_offload.hpp"
 #include "memory_state.h"
 #include "node.h"
+#include "nodes/common/tensor_parallel.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -89,6 +92,18 @@ private:
     // Derive per-thread scratch {base, stride} (f32 slots) from m_per_thread_head_scratch.
     // Indexed as ws[tid] to get per-thread buffer start. {nullptr, 0} when non-codec.
     ov::Extensions::Cpu::StridedData<float> get_per_thread_scratch() const;
+    // axis of the heads in q/k/v inputs, kv states and per-head inputs like alibi
+    size_t getHeadAxis() const {
+        const auto& permute_axes = m_config.config.permute_axes;
+        return permute_axes.empty() ? 1 : permute_axes[1];
+    }
+    // memory of the key (0) or value (1) cache which can hold capacity tokens, file-backed with the KV cache offload
+    MemoryPtr allocKVCacheMemory(const MemoryDescPtr& desc, size_t capacity, size_t idx);
+    // spills the cold tokens of the KV cache states after the attention
+    void releaseKVCache(size_t tokens);
+    void initTensorParallel();
+    // view of the heads of the tensor parallel rank in a q/k/v input or a per-head input
+    MemoryPtr sliceHeads(const MemoryPtr& mem, size_t axis, size_t heads) const;
 
     struct Config {
         ScaledDotProductAttentionWithKVCache::Config config;
@@ -135,6 +150,22 @@ private:
     PlainTensor m_v_quant_meta_data;
     // Random ±1 sign vector for WHT rotation.
     PlainTensor m_wht_signs;
+
+    // Tensor parallel: the rank attends with the kv heads [m_tp_kv_begin, m_tp_kv_end) only, m_tp_kv_heads is the
+    // total number of kv heads, 0 when the heads are not partitioned (e.g. the stateful nodes)
+    TensorParallelComm m_tp;
+    size_t m_tp_kv_heads = 0;
+    size_t m_tp_kv_begin = 0;
+    size_t m_tp_kv_end = 0;
+    MemoryPtr m_tp_output;
+
+    // KV cache offload: the id of the node and the files of the key and value caches allocated by the node
+    struct OffloadedCache {
+        std::weak_ptr<IMemory> mem;
+        std::shared_ptr<MappedFile> file;
+    };
+    size_t m_kv_offload_id = 0;
+    std::array<OffloadedCache, 2> m_kv_files;
 };
 
 }  // namespace ov::intel_cpu::node
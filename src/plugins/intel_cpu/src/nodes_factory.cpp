@@ -119,6 +119,7 @@
 #    include "nodes/grid_sample.hpp"
 #    include "nodes/interaction.h"
 #    include "nodes/llm_mlp.h"
+#    include "nodes/lm_head_sampling.h"
 #    include "nodes/paged_attn.h"
 #    include "nodes/qkv_proj.h"
 #    include "nodes/rms_norm.h"
@@ -256,6 +257,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(Interaction, Type::Interaction);
     INTEL_CPU_NODE(LLMMLP, Type::LLMMLP);
     INTEL_CPU_NODE(QKVProjection, Type::QKVProjection);
+    INTEL_CPU_NODE(LMHeadSampling, Type::LMHeadSampling);
     INTEL_CPU_NODE(PagedAttention, Type::PagedAttention);
     INTEL_CPU_NODE(RMSNorm, Type::RMS);
 #elif defined(OPENVINO_ARCH_ARM64)
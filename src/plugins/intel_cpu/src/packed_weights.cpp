@@ -0,0 +1,187 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "packed_weights.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+size_t align(size_t value) {
+    return (value + PackedWeights::alignment - 1) / PackedWeights::alignment * PackedWeights::alignment;
+}
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write_string(std::ostream& stream, const std::string& str) {
+    write_value(stream, static_cast<uint64_t>(str.size()));
+    stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+class BodyReader {
+public:
+    BodyReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T>
+    T read_value() {
+        OPENVINO_ASSERT(m_offset + sizeof(T) <= m_size, "[CPU] Corrupted packed weights section.");
+        T value{};
+        std::memcpy(&value, m_data + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return value;
+    }
+
+    std::string read_string() {
+        const auto size = static_cast<size_t>(read_value<uint64_t>());
+        OPENVINO_ASSERT(m_offset + size <= m_size, "[CPU] Corrupted packed weights section.");
+        std::string str(m_data + m_offset, size);
+        m_offset += size;
+        return str;
+    }
+
+private:
+    const char* m_data;
+    size_t m_size;
+    size_t m_offset = 0;
+};
+}  // namespace
+
+void PackedWeights::write(std::ostream& stream, const std::string& isa, const Records& records) {
+    // records table size is needed to compute the data offsets
+    size_t table_size = sizeof(uint64_t) + isa.size() + sizeof(uint64_t);
+    for (const auto& record : records) {
+        table_size += sizeof(uint64_t) + record.first.size() + 2 * sizeof(uint64_t);
+    }
+
+    std::vector<size_t> offsets;
+    offsets.reserve(records.size());
+    size_t body_size = align(table_size);
+    for (const auto& record : records) {
+        offsets.push_back(body_size);
+        body_size = align(body_size + record.second->getSize());
+    }
+
+    write_value(stream, magic);
+    write_value(stream, version);
+    write_value(stream, static_cast<uint64_t>(body_size));
+
+    write_string(stream, isa);
+    write_value(stream, static_cast<uint64_t>(records.size()));
+    for (size_t i = 0; i < records.size(); ++i) {
+        write_string(stream, records[i].first);
+        write_value(stream, static_cast<uint64_t>(offsets[i]));
+        write_value(stream, static_cast<uint64_t>(records[i].second->getSize()));
+    }
+
+    const std::vector<char> padding(alignment, 0);
+    size_t written = table_size;
+    for (size_t i = 0; i < records.size(); ++i) {
+        stream.write(padding.data(), static_cast<std::streamsize>(offsets[i] - written));
+        const auto size = records[i].second->getSize();
+        stream.write(static_cast<const char*>(records[i].second->getData()), static_cast<std::streamsize>(size));
+        written = offsets[i] + size;
+    }
+    stream.write(padding.data(), static_cast<std::streamsize>(body_size - written));
+}
+
+PackedWeights::Ptr PackedWeights::read(std::istream& stream, const std::string& isa) {
+    const auto start = stream.tellg();
+    uint64_t section_magic = 0;
+    stream.read(reinterpret_cast<char*>(&section_magic), sizeof(section_magic));
+    if (!stream.good() || section_magic != magic) {
+        stream.clear();
+        stream.seekg(start);
+        return nullptr;
+    }
+
+    uint32_t section_version = 0;
+    uint64_t body_size = 0;
+    stream.read(reinterpret_cast<char*>(&section_version), sizeof(section_version));
+    stream.read(reinterpret_cast<char*>(&body_size), sizeof(body_size));
+    OPENVINO_ASSERT(stream.good() && section_version == version, "[CPU] Unsupported packed weights section.");
+
+    auto body = std::make_shared<ov::AlignedBuffer>(body_size, alignment);
+    stream.read(static_cast<char*>(body->get_ptr()), static_cast<std::streamsize>(body_size));
+    OPENVINO_ASSERT(stream.good(), "[CPU] Cannot read packed weights section.");
+
+    return parse(body, isa);
+}
+
+PackedWeights::Ptr PackedWeights::read(const std::shared_ptr<ov::AlignedBuffer>& buffer,
+                                       size_t& offset,
+                                       const std::string& isa) {
+    constexpr size_t header_size = sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint64_t);
+    const auto* base = static_cast<const char*>(buffer->get_ptr());
+    const auto total_size = buffer->size();
+
+    uint64_t section_magic = 0;
+    if (offset + header_size > total_size) {
+        return nullptr;
+    }
+    std::memcpy(&section_magic, base + offset, sizeof(section_magic));
+    if (section_magic != magic) {
+        return nullptr;
+    }
+
+    uint32_t section_version = 0;
+    uint64_t body_size = 0;
+    std::memcpy(&section_version, base + offset + sizeof(uint64_t), sizeof(section_version));
+    std::memcpy(&body_size, base + offset + sizeof(uint64_t) + sizeof(uint32_t), sizeof(body_size));
+    OPENVINO_ASSERT(section_version == version && offset + header_size + body_size <= total_size,
+                    "[CPU] Unsupported packed weights section.");
+
+    auto* body_ptr = static_cast<char*>(buffer->get_ptr(offset + header_size));
+    auto body = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(body_ptr, body_size, buffer);
+    offset += header_size + body_size;
+
+    return parse(body, isa);
+}
+
+PackedWeights::Ptr PackedWeights::parse(const std::shared_ptr<ov::AlignedBuffer>& data, const std::string& isa) {
+    BodyReader reader(static_cast<const char*>(data->get_ptr()), data->size());
+    if (reader.read_string() != isa) {
+        // the weights were packed for another isa, so they have to be repacked anyway
+        return nullptr;
+    }
+
+    const auto count = static_cast<size_t>(reader.read_value<uint64_t>());
+    std::unordered_map<std::string, std::pair<size_t, size_t>> records;
+    records.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto key = reader.read_string();
+        const auto record_offset = static_cast<size_t>(reader.read_value<uint64_t>());
+        const auto record_size = static_cast<size_t>(reader.read_value<uint64_t>());
+        OPENVINO_ASSERT(record_offset + record_size <= data->size(), "[CPU] Corrupted packed weights section.");
+        records.emplace(std::move(key), std::make_pair(record_offset, record_size));
+    }
+
+    return Ptr(new PackedWeights(data, std::move(records)));
+}
+
+const void* PackedWeights::find(const std::string& key, size_t size) const {
+    auto found = m_records.find(key);
+    if (found == m_records.end() || found->second.second != size) {
+        return nullptr;
+    }
+    return m_data->get_ptr(found->second.first);
+}
+
+}  // namespace ov::intel_cpu
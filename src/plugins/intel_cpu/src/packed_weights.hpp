@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Repacked (blocked layout) weights of the compiled graph stored in the model cache blob.
+ *
+ * The section is written between the runtime requirements header and the serialized model. Each record is identified
+ * by a key, which is stable between processes (offset of the original constant data in the weights file, its type and
+ * shape and target memory descriptor hash), and its data is aligned to the 64 bytes boundary relative to the section
+ * start.
+ *
+ * The section is optional: when it is absent, the weights are repacked as usual.
+ */
+class PackedWeights {
+public:
+    using Ptr = std::shared_ptr<PackedWeights>;
+    using Records = std::vector<std::pair<std::string, MemoryCPtr>>;
+
+    static constexpr uint64_t magic = 0x4F564350555F5057ULL;  // "OVCPU_PW" in ASCII
+    static constexpr uint32_t version = 1;
+    static constexpr size_t alignment = 64;
+
+    /**
+     * @brief Writes the section with the given records and the isa the weights were packed for.
+     */
+    static void write(std::ostream& stream, const std::string& isa, const Records& records);
+
+    /**
+     * @brief Reads the section from the stream, if the stream is positioned at the section start. Otherwise, leaves
+     * the stream position unchanged and returns nullptr.
+     */
+    static Ptr read(std::istream& stream, const std::string& isa);
+
+    /**
+     * @brief Reads the section from the buffer without copying the weights data. Advances the offset past the
+     * section, if the section is found at the offset.
+     */
+    static Ptr read(const std::shared_ptr<ov::AlignedBuffer>& buffer, size_t& offset, const std::string& isa);
+
+    /**
+     * @brief Returns the data of the record or nullptr if the record is not found or its size differs.
+     */
+    [[nodiscard]] const void* find(const std::string& key, size_t size) const;
+
+    [[nodiscard]] size_t size() const {
+        return m_records.size();
+    }
+
+private:
+    PackedWeights(std::shared_ptr<ov::AlignedBuffer> data,
+                  std::unordered_map<std::string, std::pair<size_t, size_t>> records)
+        : m_data(std::move(data)),
+          m_records(std::move(records)) {}
+
+    static Ptr parse(const std::shared_ptr<ov::AlignedBuffer>& data, const std::string& isa);
+
+    std::shared_ptr<ov::AlignedBuffer> m_data;
+    // key -> {offset, size}
+    std::unordered_map<std::string, std::pair<size_t, size_t>> m_records;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stages.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+bool is_compute_op(const std::shared_ptr<ov::Node>& op) {
+    return !ov::is_type<ov::op::v0::Parameter>(op) && !ov::is_type<ov::op::v0::Constant>(op) &&
+           !ov::is_type<ov::op::v0::Result>(op);
+}
+
+void copy_node_info(const std::shared_ptr<ov::Node>& from, const std::shared_ptr<ov::Node>& to) {
+    to->set_friendly_name(from->get_friendly_name());
+    to->get_rt_info() = from->get_rt_info();
+    for (size_t i = 0; i < std::min(from->get_output_size(), to->get_output_size()); i++) {
+        to->output(i).get_tensor().set_names(from->output(i).get_names());
+        to->output(i).get_rt_info() = from->output(i).get_rt_info();
+    }
+}
+
+struct StageBuilder {
+    ov::ParameterVector parameters;
+    ov::ResultVector results;
+    std::vector<PipelineStage::Source> inputs;
+    std::vector<size_t> outputs;
+    // original model value -> stage model value
+    std::map<ov::Output<ov::Node>, ov::Output<ov::Node>> values;
+};
+
+PipelineStage whole_model_stage(const std::shared_ptr<ov::Model>& model) {
+    PipelineStage stage{model, {}, {}};
+    for (size_t i = 0; i < model->get_parameters().size(); i++) {
+        stage.inputs.push_back({PipelineStage::NO_STAGE, i});
+    }
+    for (size_t i = 0; i < model->get_results().size(); i++) {
+        stage.outputs.push_back(i);
+    }
+    return stage;
+}
+
+}  // namespace
+
+std::vector<PipelineStage> split_model_stages(const std::shared_ptr<ov::Model>& model, size_t num_stages) {
+    if (num_stages < 2 || !model->get_sinks().empty() || !model->get_variables().empty()) {
+        return {whole_model_stage(model)};
+    }
+
+    const auto ordered_ops = model->get_ordered_ops();
+
+    // the constants data is accounted to the first consumer
+    std::unordered_set<const ov::Node*> accounted_constants;
+    std::unordered_map<const ov::Node*, size_t> op_weights;
+    size_t total_weights = 0;
+    size_t compute_ops = 0;
+    for (const auto& op : ordered_ops) {
+        if (!is_compute_op(op)) {
+            continue;
+        }
+        size_t weights = 0;
+        for (const auto& input : op->input_values()) {
+            const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr());
+            if (constant && accounted_constants.insert(constant.get()).second) {
+                weights += constant->get_byte_size();
+            }
+        }
+        op_weights[op.get()] = weights;
+        total_weights += weights;
+        compute_ops++;
+    }
+    if (compute_ops < num_stages) {
+        return {whole_model_stage(model)};
+    }
+
+    // The operations are assigned in the topological order, so the stage of a producer never exceeds the stage of its
+    // consumers. The stages are balanced by the constants data if any, by the number of operations otherwise.
+    std::unordered_map<const ov::Node*, size_t> op_stage;
+    std::vector<size_t> stage_ops(num_stages, 0);
+    size_t accumulated = 0;
+    size_t op_idx = 0;
+    for (const auto& op : ordered_ops) {
+        if (!is_compute_op(op)) {
+            continue;
+        }
+        const size_t stage = total_weights > 0 ? accumulated * num_stages / total_weights
+                                               : op_idx * num_stages / compute_ops;
+        op_stage[op.get()] = std::min(stage, num_stages - 1);
+        stage_ops[op_stage[op.get()]]++;
+        accumulated += op_weights[op.get()];
+        op_idx++;
+    }
+
+    // drop the empty stages, e.g. when a single operation holds most of the constants data
+    std::vector<size_t> stage_id(num_stages, 0);
+    size_t used_stages = 0;
+    for (size_t i = 0; i < num_stages; i++) {
+        stage_id[i] = used_stages;
+        used_stages += stage_ops[i] > 0 ? 1 : 0;
+    }
+    if (used_stages < 2) {
+        return {whole_model_stage(model)};
+    }
+    for (auto& item : op_stage) {
+        item.second = stage_id[item.second];
+    }
+
+    std::unordered_map<const ov::Node*, size_t> parameter_index;
+    for (size_t i = 0; i < model->get_parameters().size(); i++) {
+        parameter_index[model->get_parameters()[i].get()] = i;
+    }
+    std::unordered_map<const ov::Node*, size_t> result_index;
+    for (size_t i = 0; i < model->get_results().size(); i++) {
+        result_index[model->get_results()[i].get()] = i;
+    }
+
+    std::vector<StageBuilder> builders(used_stages);
+    // value of the original model -> output of the producing stage, shared by all the consuming stages
+    std::map<ov::Output<ov::Node>, size_t> cut_outputs;
+    // value of the original model in the given stage: a clone of the constant, a new parameter fed by the original
+    // model input or by an output of the producing stage, or the value computed by the stage itself
+    auto get_value = [&](size_t stage, const ov::Output<ov::Node>& value) -> ov::Output<ov::Node> {
+        auto& builder = builders[stage];
+        if (const auto it = builder.values.find(value); it != builder.values.end()) {
+            return it->second;
+        }
+        const auto node = value.get_node_shared_ptr();
+        ov::Output<ov::Node> stage_value;
+        if (ov::is_type<ov::op::v0::Constant>(node)) {
+            // the clone shares the data of the original constant
+            const auto constant = node->clone_with_new_inputs({});
+            copy_node_info(node, constant);
+            stage_value = constant->output(value.get_index());
+        } else if (ov::is_type<ov::op::v0::Parameter>(node) || op_stage.at(node.get()) != stage) {
+            auto parameter =
+                std::make_shared<ov::op::v0::Parameter>(value.get_element_type(), value.get_partial_shape());
+            if (ov::is_type<ov::op::v0::Parameter>(node)) {
+                copy_node_info(node, parameter);
+                builder.inputs.push_back({PipelineStage::NO_STAGE, parameter_index.at(node.get())});
+            } else {
+                const size_t producer = op_stage.at(node.get());
+                auto it = cut_outputs.find(value);
+                if (it == cut_outputs.end()) {
+                    auto& producer_builder = builders[producer];
+                    producer_builder.results.push_back(
+                        std::make_shared<ov::op::v0::Result>(producer_builder.values.at(value)));
+                    producer_builder.outputs.push_back(PipelineStage::NO_OUTPUT);
+                    it = cut_outputs.emplace(value, producer_builder.results.size() - 1).first;
+                }
+                builder.inputs.push_back({producer, it->second});
+            }
+            builder.parameters.push_back(parameter);
+            stage_value = parameter->output(0);
+        } else {
+            OPENVINO_THROW("Value ", value, " is used by stage ", stage, " before it is computed");
+        }
+        builder.values[value] = stage_value;
+        return stage_value;
+    };
+
+    for (const auto& op : ordered_ops) {
+        if (ov::is_type<ov::op::v0::Parameter>(op) || ov::is_type<ov::op::v0::Constant>(op)) {
+            continue;
+        }
+        if (ov::is_type<ov::op::v0::Result>(op)) {
+            const auto producer = op->get_input_node_ptr(0);
+            const size_t stage = op_stage.count(producer) ? op_stage.at(producer) : 0;
+            const auto result = std::make_shared<ov::op::v0::Result>(get_value(stage, op->input_value(0)));
+            copy_node_info(op, result);
+            builders[stage].results.push_back(result);
+            builders[stage].outputs.push_back(result_index.at(op.get()));
+            continue;
+        }
+
+        const size_t stage = op_stage.at(op.get());
+        ov::OutputVector inputs;
+        inputs.reserve(op->get_input_size());
+        for (const auto& input : op->input_values()) {
+            inputs.push_back(get_value(stage, input));
+        }
+        const auto clone = op->clone_with_new_inputs(inputs);
+        copy_node_info(op, clone);
+        for (size_t i = 0; i < op->get_output_size(); i++) {
+            builders[stage].values[op->output(i)] = clone->output(i);
+        }
+    }
+
+    std::vector<PipelineStage> stages;
+    stages.reserve(used_stages);
+    for (size_t i = 0; i < used_stages; i++) {
+        auto& builder = builders[i];
+        auto stage_model = std::make_shared<ov::Model>(builder.results,
+                                                       builder.parameters,
+                                                       model->get_friendly_name() + "_stage" + std::to_string(i));
+        stage_model->get_rt_info() = model->get_rt_info();
+        stages.push_back({stage_model, std::move(builder.inputs), std::move(builder.outputs)});
+    }
+    return stages;
+}
+
+}  // namespace ov::intel_cpu
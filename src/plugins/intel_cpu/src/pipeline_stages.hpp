@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Stage of a model split for MODEL_DISTRIBUTION_POLICY=PIPELINE_PARALLEL.
+ *
+ * The stages are executed one after another, each one by the sub-stream pinned to its socket. An input of a stage
+ * is either an input of the original model or an output of one of the previous stages, an output of a stage is
+ * either an output of the original model or a tensor consumed by the next stages.
+ */
+struct PipelineStage {
+    struct Source {
+        // stage producing the tensor, NO_STAGE when the tensor is an input of the original model
+        size_t stage;
+        // index of the output of the producing stage or of the input of the original model
+        size_t index;
+    };
+
+    static constexpr size_t NO_STAGE = static_cast<size_t>(-1);
+
+    std::shared_ptr<ov::Model> model;
+    // source of each input of the stage model
+    std::vector<Source> inputs;
+    // index of the original model output for each output of the stage model, NO_OUTPUT for the cut tensors
+    std::vector<size_t> outputs;
+
+    static constexpr size_t NO_OUTPUT = static_cast<size_t>(-1);
+};
+
+/**
+ * @brief Splits the model into up to `num_stages` consecutive stages with close amounts of the constants data.
+ * Every constant is kept by the stage of its consumers only, the constants data is shared with the original model.
+ * Returns a single stage running the whole model if the model cannot be split (stateful model, too few operations).
+ */
+std::vector<PipelineStage> split_model_stages(const std::shared_ptr<ov::Model>& model, size_t num_stages);
+
+}  // namespace ov::intel_cpu
@@ -57,6 +57,7 @@
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/weightless_properties_utils.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
+#include "packed_weights.hpp"
 #include "sigstack_manager.h"
 #include "transformations/transformation_pipeline.h"
 #include "transformations/utils/utils.hpp"
@@ -556,6 +557,41 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         return decltype(ov::enable_weightless)::value_type{engConfig.enableWeightless};
     }
 
+    if (name == ov::intel_cpu::cpu_shared_runtime_cache) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shared_runtime_cache)::value_type>(engConfig.sharedRuntimeCache);
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_budget) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_budget)::value_type>(engConfig.runtimeCacheBudget);
+    }
+    if (name == ov::intel_cpu::cpu_cache_packed_weights) {
+        return static_cast<decltype(ov::intel_cpu::cpu_cache_packed_weights)::value_type>(engConfig.cachePackedWeights);
+    }
+    if (name == ov::intel_cpu::cpu_weights_cache_budget) {
+        return static_cast<decltype(ov::intel_cpu::cpu_weights_cache_budget)::value_type>(engConfig.weightsCacheBudget);
+    }
+    if (name == ov::intel_cpu::cpu_shape_buckets) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shape_buckets)::value_type>(engConfig.shapeBuckets);
+    }
+    if (name == ov::intel_cpu::cpu_shared_memory_arenas) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shared_memory_arenas)::value_type>(engConfig.sharedMemoryArenas);
+    }
+    if (name == ov::intel_cpu::memory_solver) {
+        return static_cast<decltype(ov::intel_cpu::memory_solver)::value_type>(engConfig.memorySolver);
+    }
+    if (name == ov::intel_cpu::cpu_dynamic_streams) {
+        return static_cast<decltype(ov::intel_cpu::cpu_dynamic_streams)::value_type>(engConfig.dynamicStreams);
+    }
+    if (name == ov::intel_cpu::cpu_kv_cache_offload_dir) {
+        return decltype(ov::intel_cpu::cpu_kv_cache_offload_dir)::value_type(engConfig.kvCacheOffloadDir);
+    }
+    if (name == ov::intel_cpu::cpu_kv_cache_hot_tokens) {
+        return static_cast<decltype(ov::intel_cpu::cpu_kv_cache_hot_tokens)::value_type>(engConfig.kvCacheHotTokens);
+    }
+    if (name == ov::intel_cpu::cpu_llm_fusion_without_amx) {
+        return static_cast<decltype(ov::intel_cpu::cpu_llm_fusion_without_amx)::value_type>(
+            engConfig.llmFusionWithoutAmx);
+    }
+
     return get_ro_property(name, options);
 }
 
@@ -609,7 +645,18 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::value_cache_precision.name()),
                                                    RW_property(ov::key_cache_group_size.name()),
                                                    RW_property(ov::value_cache_group_size.name()),
-                                                   RW_property(ov::enable_weightless.name())};
+                                                   RW_property(ov::enable_weightless.name()),
+                                                   RW_property(ov::intel_cpu::cpu_shared_runtime_cache.name()),
+                                                   RW_property(ov::intel_cpu::cpu_runtime_cache_budget.name()),
+                                                   RW_property(ov::intel_cpu::cpu_cache_packed_weights.name()),
+                                                   RW_property(ov::intel_cpu::cpu_weights_cache_budget.name()),
+                                                   RW_property(ov::intel_cpu::cpu_shape_buckets.name()),
+                                                   RW_property(ov::intel_cpu::cpu_shared_memory_arenas.name()),
+                                                   RW_property(ov::intel_cpu::memory_solver.name()),
+                                                   RW_property(ov::intel_cpu::cpu_dynamic_streams.name()),
+                                                   RW_property(ov::intel_cpu::cpu_kv_cache_offload_dir.name()),
+                                                   RW_property(ov::intel_cpu::cpu_kv_cache_hot_tokens.name()),
+                                                   RW_property(ov::intel_cpu::cpu_llm_fusion_without_amx.name())};
 
         std::vector<ov::PropertyName> wo_properties{WO_property(ov::weights_path.name())};
 
@@ -848,10 +895,11 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& model_str
     const auto origin_weights_path = get_origin_weights_path(config);
 
     read_header(model_stream);
+    const auto packed_weights = PackedWeights::read(model_stream, build_runtime_requirements());
 
     ModelDeserializer deserializer(model_stream, get_core(), decrypt, decrypt_from_string, origin_weights_path);
 
-    return deserialize_model(deserializer, config);
+    return deserialize_model(deserializer, config, packed_weights);
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::import_model(const ov::Tensor& model_tensor,
@@ -871,6 +919,10 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(const ov::Tensor& model
 
     validate_runtime_requirements(base_ptr, total_bytes, offset);
 
+    // the repacked weights are used directly from the blob memory
+    const auto blob_buffer = std::make_shared<ov::SharedBuffer<ov::Tensor>>(base_ptr, total_bytes, model_tensor);
+    const auto packed_weights = PackedWeights::read(blob_buffer, offset, build_runtime_requirements());
+
     auto* model_data_ptr = base_ptr + offset;
     size_t remaining_bytes = total_bytes - offset;
     std::shared_ptr<ov::AlignedBuffer> model_buffer =
@@ -878,11 +930,12 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(const ov::Tensor& model
 
     ModelDeserializer deserializer(model_buffer, get_core(), decrypt, decrypt_from_string, origin_weights_path);
 
-    return deserialize_model(deserializer, config);
+    return deserialize_model(deserializer, config, packed_weights);
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer& deserializer,
-                                                              const ov::AnyMap& config) const {
+                                                              const ov::AnyMap& config,
+                                                              const PackedWeights::Ptr& packed_weights) const {
     std::shared_ptr<ov::Model> model;
     deserializer >> model;
 
@@ -901,7 +954,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model =
+        std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache, nullptr, packed_weights);
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
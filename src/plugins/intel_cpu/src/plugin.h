@@ -18,6 +18,7 @@
 #include "openvino/runtime/iremote_context.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "packed_weights.hpp"
 #include "utils/graph_serializer/deserializer.hpp"
 
 namespace ov::intel_cpu {
@@ -66,7 +67,8 @@ public:
 
 private:
     std::shared_ptr<ov::ICompiledModel> deserialize_model(ModelDeserializer& deserializer,
-                                                          const ov::AnyMap& config) const;
+                                                          const ov::AnyMap& config,
+                                                          const PackedWeights::Ptr& packed_weights = nullptr) const;
 
     ov::Any get_ro_property(const std::string& name, const ov::AnyMap& options) const;
 
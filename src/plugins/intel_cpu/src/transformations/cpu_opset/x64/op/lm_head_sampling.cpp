@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lm_head_sampling.hpp"
+
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "transformations/itt.hpp"
+
+namespace ov::intel_cpu {
+
+void LMHeadSamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(LMHeadSamplingNode_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, get_input_size() == 2);
+
+    const auto& ishape = get_input_partial_shape(0);
+    const auto& itype = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          ishape.rank().is_static() && ishape.rank().get_length() >= 2,
+                          "input rank must be >= 2");
+    NODE_VALIDATION_CHECK(this, itype.is_real(), "input data type must be real");
+    NODE_VALIDATION_CHECK(this, m_config.temperature > 0.0F, "temperature must be positive");
+    NODE_VALIDATION_CHECK(this,
+                          m_config.sample || (m_config.top_k > 0 && m_config.top_k <= m_config.vocab_size),
+                          "top_k must be in [1, vocab_size]");
+    NODE_VALIDATION_CHECK(this,
+                          m_config.index_type == ov::element::i32 || m_config.index_type == ov::element::i64,
+                          "index type must be i32 or i64");
+
+    set_output_size(m_config.with_logits ? 3 : 2);
+
+    auto oshape = ishape;
+    oshape[oshape.size() - 1] = m_config.sample ? 1 : m_config.top_k;
+    set_output_type(0, ov::element::f32, oshape);
+    set_output_type(1, m_config.index_type, oshape);
+    if (m_config.with_logits) {
+        auto logits_shape = ishape;
+        logits_shape[logits_shape.size() - 1] = m_config.vocab_size;
+        set_output_type(2, ov::element::f32, logits_shape);
+    }
+}
+
+std::shared_ptr<Node> LMHeadSamplingNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(LMHeadSamplingNode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<LMHeadSamplingNode>(new_args, m_config);
+}
+
+bool LMHeadSamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(LMHeadSamplingNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("sample", m_config.sample);
+    visitor.on_attribute("hidden_size", m_config.hidden_size);
+    visitor.on_attribute("vocab_size", m_config.vocab_size);
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("top_p", m_config.top_p);
+    visitor.on_attribute("temperature", m_config.temperature);
+    visitor.on_attribute("global_seed", m_config.global_seed);
+    visitor.on_attribute("op_seed", m_config.op_seed);
+    visitor.on_attribute("with_logits", m_config.with_logits);
+    visitor.on_attribute("index_type", m_config.index_type);
+    visitor.finish_structure();
+    return true;
+}
+
+}  // namespace ov::intel_cpu
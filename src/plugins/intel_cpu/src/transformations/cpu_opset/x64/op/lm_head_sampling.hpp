@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+
+// LM head MatMul followed by the selection of the next tokens, the [..., vocab_size] logits are only an output
+// when the model consumes them besides the selection
+class LMHeadSamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("LMHeadSampling", "cpu_plugin_opset");
+
+    LMHeadSamplingNode() = default;
+
+    struct Config {
+        // false: top_k logits & their indices (TopK, greedy is top_k = 1)
+        // true: one token drawn from softmax(logits / temperature) (Multinomial), restricted to the top_k
+        // candidates and then to the top_p nucleus of them when those are set
+        bool sample;
+        int hidden_size;
+        int vocab_size;
+        int top_k;
+        float top_p;
+        float temperature;
+        uint64_t global_seed;
+        uint64_t op_seed;
+        bool with_logits;
+        ov::element::Type index_type;
+    };
+
+    // args:
+    //      0: input [..., hidden_size]
+    //      1: weights [vocab_size, hidden_size]
+    // outputs:
+    //      0: values [..., N], logits / temperature of the selected tokens
+    //      1: indices [..., N], N is top_k for TopK and 1 for sampling
+    //      2: logits [..., vocab_size], with_logits only
+    LMHeadSamplingNode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
+        validate_and_infer_types();
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config{};
+};
+
+}  // namespace ov::intel_cpu
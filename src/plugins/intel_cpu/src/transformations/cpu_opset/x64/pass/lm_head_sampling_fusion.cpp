@@ -0,0 +1,242 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lm_head_sampling_fusion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "nodes/kernels/x64/lm_head_sampling.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/x64/op/lm_head_sampling.hpp"
+
+using namespace ov::pass;
+using namespace ov::pass::pattern;
+
+namespace {
+
+// [batch, hidden] or [batch, 1, ..., 1, hidden]: every sequence contributes a single row
+bool is_row_per_sequence(const ov::PartialShape& shape) {
+    for (size_t i = 1; i + 1 < shape.size(); i++) {
+        if (shape[i].is_dynamic() || shape[i].get_length() != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The fused kernel is made for the memory bound token generation, the prompt processing is left to the
+// FullyConnected. So the LM head is only fused when its rows are known to be few: either statically, or because
+// every sequence contributes its last token only.
+bool is_decode_sized(const ov::Output<ov::Node>& input) {
+    const auto& shape = input.get_partial_shape();
+    if (shape.rank().is_dynamic()) {
+        return false;
+    }
+    int64_t rows = 1;
+    bool static_rows = true;
+    for (size_t i = 0; i + 1 < shape.size(); i++) {
+        if (shape[i].is_dynamic()) {
+            static_rows = false;
+            break;
+        }
+        rows *= shape[i].get_length();
+    }
+    if (static_rows) {
+        return rows <= ov::intel_cpu::LM_HEAD_BLK_M_SIZE;
+    }
+    if (!is_row_per_sequence(shape)) {
+        return false;
+    }
+    // [batch * seq_len, hidden] flattened from the hidden states of the whole prompt has a row per token
+    const auto producer = input.get_node_shared_ptr();
+    if (shape.size() == 2 && ov::is_type_any_of<ov::op::v1::Reshape, ov::op::v0::Squeeze>(producer)) {
+        const auto& src_shape = producer->get_input_partial_shape(0);
+        return src_shape.rank().is_static() && is_row_per_sequence(src_shape);
+    }
+    return true;
+}
+
+}  // namespace
+
+ov::intel_cpu::LMHeadSamplingFusion::LMHeadSamplingFusion() {
+    MATCHER_SCOPE(LMHeadSamplingFusion);
+
+    using ov::op::v0::Constant;
+    using ov::op::v0::Convert;
+    using ov::op::v0::MatMul;
+    using ov::op::v1::Divide;
+    using ov::op::v1::Multiply;
+    using ov::op::v13::Multinomial;
+    using ov::op::v5::LogSoftmax;
+
+    auto input = any_input(rank_more_than(1));
+    auto weight_f16 = wrap_type<Constant>(type_matches(element::f16) && rank_equals(2));  // [vocab, hidden]
+    auto weight = wrap_type<Convert>({weight_f16}, {{"destination_type", "f32"}});
+    auto lm_head = wrap_type<MatMul>({input, weight | weight_f16}, {{"transpose_a", false}, {"transpose_b", true}});
+
+    auto scale = wrap_type<Constant>(type_matches(element::f32));
+    auto temperature_mul = wrap_type<Multiply>({lm_head, scale}, consumers_count(1));
+    auto temperature_div = wrap_type<Divide>({lm_head, scale}, consumers_count(1));
+    auto logits = lm_head | temperature_mul | temperature_div;
+
+    auto topk = wrap_type<ov::op::util::TopKBase>({logits, wrap_type<Constant>()});
+    auto softmax = wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax>({logits}, consumers_count(1));
+    auto log_softmax = wrap_type<LogSoftmax>({logits}, consumers_count(1));
+    auto multinomial = wrap_type<Multinomial>({softmax | log_softmax, wrap_type<Constant>()});
+
+    auto result = topk | multinomial;
+
+    matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto root = m.get_match_root();
+
+        const auto& logits_out = pattern_map.at(lm_head);
+        const auto rank = logits_out.get_partial_shape().rank().get_length();
+        const auto& w_shape = pattern_map.at(weight_f16).get_shape();
+        if (!is_decode_sized(pattern_map.at(input))) {
+            return false;
+        }
+
+        LMHeadSamplingNode::Config config{};
+        config.vocab_size = static_cast<int>(w_shape[0]);
+        config.hidden_size = static_cast<int>(w_shape[1]);
+        config.top_p = 1.0F;
+        config.temperature = 1.0F;
+
+        // the selection must run over the vocabulary axis
+        auto is_last_axis = [rank](int64_t axis) {
+            return axis == rank - 1 || axis == -1;
+        };
+
+        if (pattern_map.count(scale) > 0) {
+            const auto scale_const = ov::as_type_ptr<Constant>(pattern_map.at(scale).get_node_shared_ptr());
+            if (shape_size(scale_const->get_shape()) != 1) {
+                return false;
+            }
+            const auto value = scale_const->cast_vector<float>()[0];
+            if (!(value > 0.0F)) {
+                return false;
+            }
+            config.temperature = pattern_map.count(temperature_mul) > 0 ? 1.0F / value : value;
+        }
+
+        if (pattern_map.count(topk) > 0) {
+            const auto topk_node = ov::as_type_ptr<ov::op::util::TopKBase>(pattern_map.at(topk).get_node_shared_ptr());
+            const auto k_const = ov::as_type_ptr<Constant>(topk_node->get_input_node_shared_ptr(1));
+            const auto k = k_const->cast_vector<int64_t>()[0];
+            if (topk_node->get_mode() != ov::op::TopKMode::MAX || !is_last_axis(topk_node->get_axis())) {
+                return false;
+            }
+            if (k > 1 && topk_node->get_sort_type() != ov::op::TopKSortType::SORT_VALUES) {
+                return false;
+            }
+            if (k < 1 || k > config.vocab_size) {
+                return false;
+            }
+            config.sample = false;
+            config.top_k = static_cast<int>(k);
+            config.index_type = topk_node->get_index_element_type();
+        } else {
+            const auto multinomial_node =
+                ov::as_type_ptr<Multinomial>(pattern_map.at(multinomial).get_node_shared_ptr());
+            const auto num_samples = ov::as_type_ptr<Constant>(multinomial_node->get_input_node_shared_ptr(1));
+            if (shape_size(num_samples->get_shape()) != 1 || num_samples->cast_vector<int64_t>()[0] != 1) {
+                return false;
+            }
+            // Multinomial exponentiates log probabilities, so it must see the matching normalization
+            const bool is_log_softmax = pattern_map.count(log_softmax) > 0;
+            if (multinomial_node->get_log_probs() != is_log_softmax || rank != 2) {
+                return false;
+            }
+            int64_t axis = 0;
+            if (is_log_softmax) {
+                axis = ov::as_type_ptr<LogSoftmax>(pattern_map.at(log_softmax).get_node_shared_ptr())->get_axis();
+            } else if (const auto softmax_v8 =
+                           ov::as_type_ptr<ov::op::v8::Softmax>(pattern_map.at(softmax).get_node_shared_ptr())) {
+                axis = softmax_v8->get_axis();
+            } else {
+                axis = static_cast<int64_t>(
+                    ov::as_type_ptr<ov::op::v1::Softmax>(pattern_map.at(softmax).get_node_shared_ptr())->get_axis());
+            }
+            if (!is_last_axis(axis)) {
+                return false;
+            }
+            config.sample = true;
+            config.top_k = 0;
+            config.global_seed = multinomial_node->get_global_seed();
+            config.op_seed = multinomial_node->get_op_seed();
+            config.index_type = multinomial_node->get_convert_type();
+        }
+
+        // the MatMul output stays available to its other consumers as the logits output
+        const auto logits_targets = logits_out.get_target_inputs();
+        config.with_logits = logits_targets.size() > 1;
+
+        OutputVector new_args{pattern_map.at(input), pattern_map.at(weight_f16)};
+        auto new_node = std::make_shared<LMHeadSamplingNode>(new_args, config);
+        new_node->set_friendly_name(root->get_friendly_name());
+
+        NodeVector fused_nodes{pattern_map.at(lm_head).get_node_shared_ptr(), root};
+        for (const auto& label : {temperature_mul, temperature_div, softmax, log_softmax}) {
+            if (pattern_map.count(label) > 0) {
+                fused_nodes.push_back(pattern_map.at(label).get_node_shared_ptr());
+            }
+        }
+        ov::copy_runtime_info(fused_nodes, new_node);
+
+        // callback is for plugin implementation to check if it can be supported
+        if (!transformation_callback(new_node)) {
+            return false;
+        }
+
+        if (config.with_logits) {
+            for (auto& target : logits_targets) {
+                const auto* consumer = target.get_node();
+                if (std::none_of(fused_nodes.begin(), fused_nodes.end(), [&](const std::shared_ptr<Node>& n) {
+                        return n.get() == consumer;
+                    })) {
+                    target.replace_source_output(new_node->output(2));
+                }
+            }
+        }
+        if (config.sample) {
+            root->output(0).replace(new_node->output(1));
+        } else {
+            root->output(0).replace(new_node->output(0));
+            root->output(1).replace(new_node->output(1));
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(result, matcher_name);
+    this->register_matcher(m, callback);
+}
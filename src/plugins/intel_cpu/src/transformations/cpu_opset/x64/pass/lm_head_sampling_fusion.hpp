@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+// Fuses the f16 LM head MatMul with the selection of the next tokens which follows it:
+//   MatMul -> [Multiply|Divide by temperature] -> TopK(max)                     => top-k / greedy
+//   MatMul -> [Multiply|Divide by temperature] -> Softmax|LogSoftmax -> Multinomial(1 sample) => sampling
+// Other consumers of the MatMul read the logits output of the fused node. Only the decode sized LM heads are fused:
+// at most LM_HEAD_BLK_M_SIZE rows, or one row per sequence like after the last token slicing.
+class LMHeadSamplingFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("LMHeadSamplingFusion");
+    LMHeadSamplingFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -195,6 +195,7 @@
 #    include "low_precision/fuse_convert.hpp"
 #    include "low_precision/weightable_layer_transformation.hpp"
 #    include "nodes/llm_mlp.h"
+#    include "nodes/lm_head_sampling.h"
 #    include "nodes/qkv_proj.h"
 #    include "nodes/rms_norm.h"
 #    include "onednn/dnnl.h"
@@ -212,6 +213,7 @@
 #    include "transformations/cpu_opset/common/pass/convert_fq_rnn_to_quantized_rnn.hpp"
 #    include "transformations/cpu_opset/common/pass/decompose_rms_norm.hpp"
 #    include "transformations/cpu_opset/x64/pass/convert_to_interaction.hpp"
+#    include "transformations/cpu_opset/x64/pass/lm_head_sampling_fusion.hpp"
 #    include "transformations/cpu_opset/x64/pass/mlp_fusion.hpp"
 #    include "transformations/cpu_opset/x64/pass/qkv_proj_fusion.hpp"
 #    include "transformations/op_conversions/group_normalization_decomposition.hpp"
@@ -1143,13 +1145,18 @@ void Transformations::PostLpt() {
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
 
 #if defined(OPENVINO_ARCH_X86_64)
-    // MLP & QKV fusion optimizations is focused on throughput, only enabled on AMX-bf16 & LLM serving use cases.
+    // MLP & QKV fusion optimizations use AMX-bf16/fp16 kernels when available. The CPUs without AMX may run them with
+    // AVX-512/AVX2 kernels which read the f16/i8 weights once per token, on request only, since the prompt
+    // processing and the int4 weights are better served by the FullyConnected nodes.
     auto can_use_amx_bf16_int8 = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx) &&
                                  (config.inferencePrecision == element::bf16);
     auto can_use_amx_fp16 = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx_fp16) &&
                             (config.inferencePrecision == element::f16);
+    auto can_use_avx = config.llmFusionWithoutAmx &&
+                       !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx) &&
+                       dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2);
 
-    if (can_use_amx_bf16_int8 || can_use_amx_fp16) {
+    if (can_use_amx_bf16_int8 || can_use_amx_fp16 || can_use_avx) {
         const auto fcDynamicQuantizationGroupSize = config.fcDynamicQuantizationGroupSize;
         CPU_REGISTER_PASS_X64(postLPTPassManager, MLPFusion);
         CPU_SET_CALLBACK_X64(
@@ -1188,6 +1195,19 @@ void Transformations::PostLpt() {
             },
             QKVProjFusionPass2);
     }
+
+    // LM head followed by TopK or Multinomial selects the next tokens from the logits tiles while they are in cache,
+    // so the [batch, vocab] logits are not written and scanned again
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        CPU_REGISTER_PASS_X64(postLPTPassManager, LMHeadSamplingFusion);
+        CPU_SET_CALLBACK_X64(
+            postLPTPassManager,
+            [](const_node_ptr& node) -> bool {
+                std::string errorMsg;
+                return node::LMHeadSampling::isSupportedOperation(node, errorMsg);
+            },
+            LMHeadSamplingFusion);
+    }
 #endif  // OPENVINO_ARCH_X86_64
 
     // gamma-less fusion keeps the variance in f32 for bf16, which has no ConvertPrecision markup; under
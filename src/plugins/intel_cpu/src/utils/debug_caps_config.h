@@ -50,6 +50,7 @@ public:
     std::unordered_map<FILTER, std::string> blobDumpFilters;
     bool summaryPerf = false;
     std::string memoryStatisticsDumpPath;
+    std::string memoryRegionsDumpDir;
 
     struct TransformationFilter {
         enum Type : uint8_t { PreLpt = 0, Lpt, PostLpt, Snippets, Specific, NumOfTypes };
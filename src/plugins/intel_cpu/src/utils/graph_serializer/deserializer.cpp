@@ -181,20 +181,26 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     }
 
     // XML content
-    auto xml_buff = std::make_shared<std::string>();
+    // Only the encrypted XML is copied, the plain one is used directly from the blob memory as the weights are.
+    std::shared_ptr<ov::AlignedBuffer> model_buf;
     if (m_cache_decrypt) {
+        std::shared_ptr<std::string> xml_buff;
         if (m_decript_from_string) {
-            xml_buff->assign(buffer_base + hdr.model_offset, hdr.model_size);
-            *xml_buff = m_cache_decrypt.m_decrypt_str(*xml_buff);
+            xml_buff = std::make_shared<std::string>(
+                m_cache_decrypt.m_decrypt_str(std::string(buffer_base + hdr.model_offset, hdr.model_size)));
         } else {
-            xml_buff->reserve(hdr.model_size + 1);
-            m_cache_decrypt.m_decrypt_char((*xml_buff).data(), buffer_base + hdr.model_offset, hdr.model_size);
+            xml_buff = std::make_shared<std::string>(hdr.model_size, '\0');
+            m_cache_decrypt.m_decrypt_char(xml_buff->data(), buffer_base + hdr.model_offset, hdr.model_size);
         }
+        model_buf = std::make_shared<ov::SharedBuffer<std::shared_ptr<std::string>>>(xml_buff->data(),
+                                                                                      xml_buff->size(),
+                                                                                      xml_buff);
     } else {
-        xml_buff->assign(buffer_base + hdr.model_offset, hdr.model_size);
+        model_buf =
+            std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(buffer_base + hdr.model_offset,
+                                                                                   hdr.model_size,
+                                                                                   model_buffer);
     }
-    std::shared_ptr<ov::AlignedBuffer> model_buf =
-        std::make_shared<ov::SharedBuffer<std::shared_ptr<std::string>>>((*xml_buff).data(), hdr.model_size, xml_buff);
 
     model = create_ov_model(model_buf, weights_buf, m_origin_weights_buf);
 
@@ -98,6 +98,35 @@ static void dumpStatisticsCSV(std::ofstream& os,
     }
 }
 
+// one file per memory control unit, the format is consumed by the memory solver replay benchmark
+static void dumpMemoryRegions(const std::string& dump_dir,
+                              const std::string& network_name,
+                              std::deque<CompiledModel::GraphGuard>& graphs) {
+    std::filesystem::create_directories(dump_dir);
+    size_t graph_idx = 0;
+    for (auto&& graph : graphs) {
+        CompiledModel::GraphGuard::Lock graph_lock{graph};
+        auto ctx = graph_lock._graph.getGraphContext();
+        if (!ctx) {
+            continue;
+        }
+        for (auto&& [id, regions] : ctx->getAuxiliaryNetworkMemoryControl()->dumpRegions()) {
+            const auto file_path = std::filesystem::path(dump_dir) /
+                                   (network_name + "_" + std::to_string(graph_idx) + "_" + id + ".csv");
+            std::ofstream os(file_path);
+            if (!os.is_open()) {
+                OPENVINO_THROW("Cannot open file for writing: ", file_path);
+            }
+            os << "id;start;finish;size;type;alloc_type\n";
+            for (auto&& region : regions) {
+                os << region.id << ";" << region.start << ";" << region.finish << ";" << region.size << ";"
+                   << static_cast<int>(region.type) << ";" << static_cast<int>(region.alloc_type) << "\n";
+            }
+        }
+        graph_idx++;
+    }
+}
+
 void dumpMemoryStats(const DebugCapsConfig& conf,
                      const std::string& network_name,
                      std::deque<CompiledModel::GraphGuard>& graphs,
@@ -106,6 +135,10 @@ void dumpMemoryStats(const DebugCapsConfig& conf,
         return;
     }
 
+    if (!conf.memoryRegionsDumpDir.empty()) {
+        dumpMemoryRegions(conf.memoryRegionsDumpDir, network_name, graphs);
+    }
+
     if (conf.memoryStatisticsDumpPath.empty()) {
         return;
     }
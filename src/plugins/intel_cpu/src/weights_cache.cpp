@@ -4,22 +4,61 @@
 
 #include "weights_cache.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
-#ifdef CPU_DEBUG_CAPS
-#    include <vector>
-#endif
+#include <vector>
 
 #include "cpu_memory.h"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "packed_weights.hpp"
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
 
 namespace ov::intel_cpu {
 
+namespace {
+/**
+ * Releases the physical pages of the memory range keeping the virtual address range valid.
+ * The released pages are zero filled on the next access.
+ * @return released size in bytes
+ */
+size_t releasePages(void* data, size_t size) {
+#if defined(__linux__)
+    const auto pagesize = static_cast<uintptr_t>(getpagesize());
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + pagesize - 1) & ~(pagesize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) & ~(pagesize - 1);
+    if (end <= begin) {
+        return 0;
+    }
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED) != 0) {
+        return 0;
+    }
+    return end - begin;
+#else
+    // there is no portable way to release the pages, so the weights stay resident
+    (void)data;
+    (void)size;
+    return 0;
+#endif
+}
+}  // namespace
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -93,6 +132,199 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
+void WeightsSharing::pruneSources() {
+    for (auto it = sourceNames.begin(); it != sourceNames.end();) {
+        it = it->second.memory.expired() ? sourceNames.erase(it) : std::next(it);
+    }
+    for (auto it = sourceData.begin(); it != sourceData.end();) {
+        it = sourceNames.count(it->second) == 0 ? sourceData.erase(it) : std::next(it);
+    }
+    prunedSourcesSize = sourceNames.size();
+}
+
+void WeightsSharing::registerSource(const MemoryCPtr& memory, const std::string& name) {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    // amortized, so registering the sources of a model stays linear in their number
+    if (sourceNames.size() >= 2 * std::max<size_t>(prunedSourcesSize, 64)) {
+        pruneSources();
+    }
+    const void* data = memory->getData();
+    // the data of the released memories may be reused by other weights
+    sourceNames[data] = {memory, name};
+    auto [found, inserted] = sourceData.emplace(name, data);
+    if (!inserted && found->second != data) {
+        const auto other = sourceNames.find(found->second);
+        if (other != sourceNames.end() && !other->second.memory.expired() && other->second.name == name) {
+            ambiguousSources.insert(name);
+        }
+        found->second = data;
+    }
+}
+
+std::string WeightsSharing::getSourceName(const void* data) {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    auto found = sourceNames.find(data);
+    if (found == sourceNames.end()) {
+        return {};
+    }
+    if (found->second.memory.expired()) {
+        sourceNames.erase(found);
+        return {};
+    }
+    return found->second.name;
+}
+
+void WeightsSharing::setPackedWeights(PackedWeights::Ptr weights) {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    packedWeights = std::move(weights);
+}
+
+bool WeightsSharing::hasPackedWeights() const {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    return packedWeights != nullptr;
+}
+
+const void* WeightsSharing::findPacked(const std::string& key, size_t size) const {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    return packedWeights ? packedWeights->find(key, size) : nullptr;
+}
+
+void WeightsSharing::addPacked(const std::string& source, const std::string& key, const MemoryCPtr& memory) {
+    std::lock_guard<std::mutex> lock(packedGuard);
+    packed[key] = {memory, source};
+}
+
+PackedWeights::Records WeightsSharing::getPacked() const {
+    PackedWeights::Records records;
+    std::lock_guard<std::mutex> lock(packedGuard);
+    for (const auto& item : packed) {
+        if (ambiguousSources.count(item.second.source) != 0) {
+            continue;
+        }
+        if (auto memory = item.second.memory.lock()) {
+            records.emplace_back(item.first, memory);
+        }
+    }
+    return records;
+}
+
+void WeightsSharing::setEvictionBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(evictionGuard);
+    budget = bytes;
+}
+
+void WeightsSharing::registerEvictable(const MemoryPtr& memory, std::function<void(const IMemory&)> restore) {
+    std::lock_guard<std::mutex> lock(evictionGuard);
+    packs++;
+    if (0 == budget) {
+        return;
+    }
+    evictable.push_back({memory, std::move(restore), true});
+}
+
+std::shared_ptr<void> WeightsSharing::use() {
+    {
+        std::lock_guard<std::mutex> lock(evictionGuard);
+        users++;
+        for (auto& item : evictable) {
+            if (item.resident) {
+                continue;
+            }
+            if (auto memory = item.memory.lock()) {
+                item.restore(*memory);
+                repacks++;
+            }
+            item.resident = true;
+        }
+    }
+
+    auto self = shared_from_this();
+    return {nullptr, [self](void*) {
+                std::lock_guard<std::mutex> lock(self->evictionGuard);
+                if (0 == --self->users && self->budget > 0) {
+                    self->evictOverBudget();
+                }
+            }};
+}
+
+void WeightsSharing::evictOverBudget() {
+    evictable.erase(std::remove_if(evictable.begin(),
+                                   evictable.end(),
+                                   [](const EvictableMemory& item) {
+                                       return item.memory.expired();
+                                   }),
+                    evictable.end());
+    size_t resident = 0;
+    for (const auto& item : evictable) {
+        auto memory = item.memory.lock();
+        if (item.resident && memory) {
+            resident += memory->getSize();
+        }
+    }
+    if (resident <= budget) {
+        return;
+    }
+
+    size_t released = 0;
+    // the weights packed last are released first, so the same weights stay resident from one inference to another
+    for (auto it = evictable.rbegin(); it != evictable.rend() && resident > budget; ++it) {
+        auto memory = it->memory.lock();
+        if (!it->resident || !memory) {
+            continue;
+        }
+        released += releasePages(memory->getData(), memory->getSize());
+        resident -= memory->getSize();
+        it->resident = false;
+    }
+    if (released > 0) {
+        evictions++;
+    }
+}
+
+size_t WeightsSharing::evict() {
+    std::lock_guard<std::mutex> lock(evictionGuard);
+    if (users > 0) {
+        return 0;
+    }
+
+    size_t released = 0;
+    evictable.erase(std::remove_if(evictable.begin(),
+                                   evictable.end(),
+                                   [](const EvictableMemory& item) {
+                                       return item.memory.expired();
+                                   }),
+                    evictable.end());
+    for (auto& item : evictable) {
+        auto memory = item.memory.lock();
+        if (!item.resident || !memory) {
+            continue;
+        }
+        released += releasePages(memory->getData(), memory->getSize());
+        item.resident = false;
+    }
+    if (released > 0) {
+        evictions++;
+    }
+    return released;
+}
+
+std::map<std::string, uint64_t> WeightsSharing::getEvictionStatistics() const {
+    std::lock_guard<std::mutex> lock(evictionGuard);
+    uint64_t residentBytes = 0;
+    uint64_t evictableBytes = 0;
+    for (const auto& item : evictable) {
+        if (auto memory = item.memory.lock()) {
+            evictableBytes += memory->getSize();
+            residentBytes += item.resident ? memory->getSize() : 0;
+        }
+    }
+    return {{"resident_bytes", residentBytes},
+            {"evictable_bytes", evictableBytes},
+            {"packs", packs},
+            {"repacks", repacks},
+            {"evictions", evictions}};
+}
+
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
@@ -112,6 +344,44 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+void SocketsWeights::setPackedWeights(const PackedWeights::Ptr& weights) {
+    for (auto& item : _cache_map) {
+        item.second->setPackedWeights(weights);
+    }
+}
+
+bool SocketsWeights::hasPackedWeights() const {
+    return std::any_of(_cache_map.begin(), _cache_map.end(), [](const auto& item) {
+        return item.second->hasPackedWeights();
+    });
+}
+
+void SocketsWeights::setEvictionBudget(size_t bytes) {
+    for (auto& item : _cache_map) {
+        item.second->setEvictionBudget(bytes);
+    }
+}
+
+std::map<std::string, uint64_t> SocketsWeights::getEvictionStatistics() const {
+    std::map<std::string, uint64_t> statistics;
+    for (const auto& item : _cache_map) {
+        for (const auto& counter : item.second->getEvictionStatistics()) {
+            statistics[counter.first] += counter.second;
+        }
+    }
+    return statistics;
+}
+
+PackedWeights::Records SocketsWeights::getPacked() const {
+    for (const auto& item : _cache_map) {
+        auto records = item.second->getPacked();
+        if (!records.empty()) {
+            return records;
+        }
+    }
+    return {};
+}
+
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
     Statistics retVal = {0, 0};
@@ -6,16 +6,19 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "cpu_memory.h"
+#include "packed_weights.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -30,7 +33,7 @@ namespace ov::intel_cpu {
  *
  * Is a thread safe
  */
-class WeightsSharing {
+class WeightsSharing : public std::enable_shared_from_this<WeightsSharing> {
     struct MemoryInfo {
         using Ptr = std::shared_ptr<MemoryInfo>;
 
@@ -73,6 +76,54 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Registers the identity of the original constant the memory belongs to (e.g. the offset of its data in the
+     * weights file). The identity is used to build the keys of the repacked weights which are stable between
+     * processes, so the repacked weights can be stored in the model cache. The records of the released memories are
+     * pruned lazily. The identity registered for several alive memories is ambiguous, so the repacked weights of such
+     * sources are not stored.
+     */
+    void registerSource(const MemoryCPtr& memory, const std::string& name);
+    [[nodiscard]] std::string getSourceName(const void* data);
+
+    /**
+     * Sets the repacked weights loaded from the model cache
+     */
+    void setPackedWeights(PackedWeights::Ptr weights);
+    [[nodiscard]] bool hasPackedWeights() const;
+    /**
+     * Returns the repacked weights data loaded from the model cache or nullptr if there is no such record
+     */
+    [[nodiscard]] const void* findPacked(const std::string& key, size_t size) const;
+    /**
+     * Remembers the repacked weights of the source to be stored in the model cache on export
+     */
+    void addPacked(const std::string& source, const std::string& key, const MemoryCPtr& memory);
+    [[nodiscard]] PackedWeights::Records getPacked() const;
+
+    /**
+     * Weights eviction under the weights cache budget of the compiled model.
+     * When the cache goes idle and the resident size of its evictable (repacked) weights exceeds the budget, the
+     * physical memory of the weights is released until the rest fits the budget (zero disables the eviction). The
+     * virtual address range is kept, so the memory objects remain valid and the data is restored in place on the next
+     * use.
+     */
+    void setEvictionBudget(size_t bytes);
+    /**
+     * Registers the memory that may be evicted. The restore callback must fill the given memory with the same data.
+     */
+    void registerEvictable(const MemoryPtr& memory, std::function<void(const IMemory&)> restore);
+    /**
+     * Restores the evicted weights and protects the weights from eviction while the returned guard is alive
+     */
+    [[nodiscard]] std::shared_ptr<void> use();
+    /**
+     * Releases the physical memory of the evictable weights, if the cache is not in use
+     * @return released size in bytes
+     */
+    size_t evict();
+    [[nodiscard]] std::map<std::string, uint64_t> getEvictionStatistics() const;
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -80,6 +131,44 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+
+private:
+    // separate guard, since the packed weights are accessed from the create callback of findOrCreate
+    mutable std::mutex packedGuard;
+    struct Source {
+        std::weak_ptr<const IMemory> memory;
+        std::string name;
+    };
+    void pruneSources();
+
+    std::unordered_map<const void*, Source> sourceNames;
+    // the number of the sources after the last pruning, the released sources are pruned when it is doubled
+    size_t prunedSourcesSize = 0;
+    std::unordered_map<std::string, const void*> sourceData;
+    std::unordered_set<std::string> ambiguousSources;
+    PackedWeights::Ptr packedWeights;
+    struct Packed {
+        std::weak_ptr<const IMemory> memory;
+        std::string source;
+    };
+    std::map<std::string, Packed> packed;
+
+    struct EvictableMemory {
+        std::weak_ptr<IMemory> memory;
+        std::function<void(const IMemory&)> restore;
+        bool resident = true;
+    };
+
+    // evicts the weights over the budget, evictionGuard must be held
+    void evictOverBudget();
+
+    mutable std::mutex evictionGuard;
+    size_t budget = 0;
+    std::vector<EvictableMemory> evictable;
+    size_t users = 0;
+    uint64_t packs = 0;
+    uint64_t repacks = 0;
+    uint64_t evictions = 0;
 };
 
 /**
@@ -94,6 +183,13 @@ public:
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    void setPackedWeights(const PackedWeights::Ptr& weights);
+    [[nodiscard]] bool hasPackedWeights() const;
+    [[nodiscard]] PackedWeights::Records getPacked() const;
+
+    void setEvictionBudget(size_t bytes);
+    [[nodiscard]] std::map<std::string, uint64_t> getEvictionStatistics() const;
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
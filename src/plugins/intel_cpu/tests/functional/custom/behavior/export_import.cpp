@@ -2,6 +2,8 @@
 // SPDX-License-corer: Apache-2.0
 //
 
+#include <cstring>
+
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "common_test_utils/test_common.hpp"
@@ -94,6 +96,39 @@ TEST_P(ExportOptimalNumStreams, OptimalNumStreams) {
     }
 }
 
+// The blob imported from memory is used in place, so the results must match the ones of the stream import
+TEST(ExportImportTest, smoke_ImportFromTensor) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ov::Core core;
+    auto compiled_model = core.compile_model(MakeMatMulModel(), "CPU");
+
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    const auto blob_str = exported_model.str();
+
+    ov::Tensor blob(ov::element::u8, ov::Shape{blob_str.size()});
+    std::memcpy(blob.data(), blob_str.data(), blob_str.size());
+    auto imported_from_tensor = core.import_model(blob, "CPU");
+    auto imported_from_stream = core.import_model(exported_model, "CPU");
+
+    ov::Tensor input(ov::element::f32, ov::Shape{1, 4096});
+    auto* input_data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); ++i) {
+        input_data[i] = static_cast<float>(i % 17) / 17.0f;
+    }
+
+    auto infer = [&](ov::CompiledModel& model) {
+        auto request = model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+    const auto expected = infer(imported_from_stream);
+    const auto actual = infer(imported_from_tensor);
+    ASSERT_EQ(expected.get_byte_size(), actual.get_byte_size());
+    EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size()));
+}
+
 const std::vector<ov::AnyMap> testing_property_for_streams = {{ov::num_streams(1)}, {ov::num_streams(2)}};
 
 const std::vector<ov::AnyMap> testing_property_for_threads = {{ov::inference_num_threads(1)},
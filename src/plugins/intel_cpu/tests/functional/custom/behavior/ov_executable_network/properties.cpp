@@ -55,7 +55,24 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::value_cache_precision.name()),
         RO_property(ov::key_cache_group_size.name()),
         RO_property(ov::value_cache_group_size.name()),
-        RO_property(ov::runtime_requirements.name())
+        RO_property(ov::runtime_requirements.name()),
+        RO_property(ov::intel_cpu::cpu_shared_runtime_cache.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_budget.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_cache_packed_weights.name()),
+        RO_property(ov::intel_cpu::cpu_weights_cache_budget.name()),
+        RO_property(ov::intel_cpu::cpu_weights_cache_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_shape_buckets.name()),
+        RO_property(ov::intel_cpu::cpu_shape_buckets_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_shared_memory_arenas.name()),
+        RO_property(ov::intel_cpu::memory_solver.name()),
+        RO_property(ov::intel_cpu::cpu_memory_arenas_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_dynamic_streams.name()),
+        RO_property(ov::intel_cpu::cpu_dynamic_streams_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_kv_cache_offload_dir.name()),
+        RO_property(ov::intel_cpu::cpu_kv_cache_hot_tokens.name()),
+        RO_property(ov::intel_cpu::cpu_kv_cache_offload_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_llm_fusion_without_amx.name())
     };
 
     ov::Core ie;
@@ -543,4 +560,83 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuModelDistributionPolicyTensorParallel) {
     ASSERT_EQ(enable_tensor_parallel, true);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuModelDistributionPolicyPipelineParallel) {
+    ov::Core core;
+    std::shared_ptr<ov::Model> model = ov::test::utils::make_matmul_bias();
+    std::set<ov::hint::ModelDistributionPolicy> setModels = {ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
+    ov::AnyMap config = {{ov::hint::model_distribution_policy.name(), setModels},
+                         {ov::intel_cpu::enable_tensor_parallel.name(), true},
+                         {ov::num_streams.name(), 1},
+                         {ov::inference_num_threads.name(), 1}};
+
+    core.set_property(deviceName, config);
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+
+    std::set<ov::hint::ModelDistributionPolicy> model_distribution_policy_value = {};
+    OV_ASSERT_NO_THROW(model_distribution_policy_value = compiledModel.get_property(ov::hint::model_distribution_policy));
+    ASSERT_EQ(model_distribution_policy_value, setModels);
+
+    auto input = ov::test::utils::create_and_fill_tensor(model->input().get_element_type(), model->input().get_shape());
+    const std::set<ov::hint::ModelDistributionPolicy> noPolicy = {};
+    auto referenceModel = core.compile_model(model, deviceName, ov::hint::model_distribution_policy(noPolicy));
+    auto reference = referenceModel.create_infer_request();
+    reference.set_input_tensor(input);
+    reference.infer();
+    auto request = compiledModel.create_infer_request();
+    request.set_input_tensor(input);
+    OV_ASSERT_NO_THROW(request.infer());
+    ov::test::utils::compare(reference.get_output_tensor(), request.get_output_tensor());
+
+    // only the stages have graphs, the properties and the runtime model come from them
+    ASSERT_EQ(compiledModel.get_property(ov::model_name), model->get_name());
+    OV_ASSERT_NO_THROW(compiledModel.get_property(ov::intel_cpu::cpu_runtime_cache_statistics));
+    std::shared_ptr<const ov::Model> runtimeModel;
+    OV_ASSERT_NO_THROW(runtimeModel = compiledModel.get_runtime_model());
+    ASSERT_FALSE(runtimeModel->get_results().empty());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuDynamicStreamsSyncAndAsyncInfer) {
+    ov::Core core;
+    std::shared_ptr<ov::Model> model = ov::test::utils::make_matmul_bias();
+    auto input = ov::test::utils::create_and_fill_tensor(model->input().get_element_type(), model->input().get_shape());
+    auto reference = core.compile_model(model, deviceName, ov::num_streams(1)).create_infer_request();
+    reference.set_input_tensor(input);
+    reference.infer();
+
+    // more narrow streams than wide ones on any machine
+    ov::CompiledModel compiledModel = core.compile_model(model,
+                                                         deviceName,
+                                                         ov::num_streams(4),
+                                                         ov::inference_num_threads(4),
+                                                         ov::intel_cpu::cpu_dynamic_streams(true));
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::cpu_dynamic_streams));
+
+    auto request = compiledModel.create_infer_request();
+    request.set_input_tensor(input);
+    OV_ASSERT_NO_THROW(request.infer());
+    ov::test::utils::compare(reference.get_output_tensor(), request.get_output_tensor());
+
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < 8; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_input_tensor(input);
+    }
+    for (size_t iteration = 0; iteration < 4; iteration++) {
+        for (auto& async_request : requests) {
+            async_request.start_async();
+        }
+        // the synchronous inferences run concurrently with the asynchronous ones
+        OV_ASSERT_NO_THROW(request.infer());
+        for (auto& async_request : requests) {
+            OV_ASSERT_NO_THROW(async_request.wait());
+            ov::test::utils::compare(reference.get_output_tensor(), async_request.get_output_tensor());
+        }
+        ov::test::utils::compare(reference.get_output_tensor(), request.get_output_tensor());
+    }
+
+    const auto statistics = compiledModel.get_property(ov::intel_cpu::cpu_dynamic_streams_statistics);
+    ASSERT_EQ(statistics.at("wide_inferences") + statistics.at("narrow_inferences"), 1 + 4 * (requests.size() + 1));
+    ASSERT_GT(statistics.at("wide_inferences"), 0U);
+}
+
 }  // namespace
@@ -70,6 +70,17 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::key_cache_group_size.name()),
         RW_property(ov::value_cache_group_size.name()),
         RW_property(ov::enable_weightless.name()),
+        RW_property(ov::intel_cpu::cpu_shared_runtime_cache.name()),
+        RW_property(ov::intel_cpu::cpu_runtime_cache_budget.name()),
+        RW_property(ov::intel_cpu::cpu_cache_packed_weights.name()),
+        RW_property(ov::intel_cpu::cpu_weights_cache_budget.name()),
+        RW_property(ov::intel_cpu::cpu_shape_buckets.name()),
+        RW_property(ov::intel_cpu::cpu_shared_memory_arenas.name()),
+        RW_property(ov::intel_cpu::memory_solver.name()),
+        RW_property(ov::intel_cpu::cpu_dynamic_streams.name()),
+        RW_property(ov::intel_cpu::cpu_kv_cache_offload_dir.name()),
+        RW_property(ov::intel_cpu::cpu_kv_cache_hot_tokens.name()),
+        RW_property(ov::intel_cpu::cpu_llm_fusion_without_amx.name()),
     };
 
     ov::Core ie;
@@ -132,6 +143,12 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginSetConfigModelDistributionPolicy) {
     OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::hint::model_distribution_policy));
     ASSERT_EQ(model_policy, value);
 
+    model_policy = {ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
+
+    OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::hint::model_distribution_policy(model_policy)));
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::hint::model_distribution_policy));
+    ASSERT_EQ(model_policy, value);
+
     model_policy = {};
 
     OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::hint::model_distribution_policy(model_policy)));
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "custom/subgraph_tests/src/classes/concat_sdp.hpp"
+#include "internal_properties.hpp"
+
+namespace ov {
+namespace test {
+namespace {
+
+// The cold tokens of the KV caches are kept in the files: the outputs and the states must match the run with the
+// caches in RAM, including the states read after the cache grew and after set_state().
+class ConcatSDPKVCacheOffloadTest : public ConcatSDPTest {
+protected:
+    void run_with_states(const ov::AnyMap& config,
+                         std::vector<std::vector<ov::Tensor>>& outputs,
+                         std::vector<std::vector<ov::Tensor>>& states) {
+        compiledModel = core->compile_model(function, targetDevice, config);
+        auto req = compiledModel.create_infer_request();
+        m_iter = 0;
+        m_accum_L_q = 0;
+        auto copy = [](const ov::Tensor& src) {
+            ov::Tensor dst{src.get_element_type(), src.get_shape()};
+            src.copy_to(dst);
+            return dst;
+        };
+        auto infer = [&](const std::vector<ov::Shape>& shapes) {
+            generate_inputs(shapes);
+            for (const auto& port : compiledModel.inputs()) {
+                const auto& name = port.get_node()->get_friendly_name();
+                for (const auto& [node, tensor] : inputs) {
+                    if (node->get_friendly_name() == name) {
+                        req.set_tensor(port, tensor);
+                        break;
+                    }
+                }
+            }
+            req.infer();
+            outputs.emplace_back();
+            for (const auto& port : compiledModel.outputs()) {
+                outputs.back().push_back(copy(req.get_tensor(port)));
+            }
+            states.emplace_back();
+            for (auto&& state : req.query_state()) {
+                states.back().push_back(copy(state.get_state()));
+            }
+        };
+        for (const auto& shapes : targetStaticShapes) {
+            infer(shapes);
+        }
+        // rewinds to the states of the first step, the caches assigned by set_state() grow again
+        const auto first_states = states.front();
+        auto variables = req.query_state();
+        ASSERT_EQ(variables.size(), first_states.size());
+        for (size_t i = 0; i < variables.size(); i++) {
+            variables[i].set_state(first_states[i]);
+        }
+        for (const auto& shapes : targetStaticShapes) {
+            infer(shapes);
+        }
+    }
+
+    void run() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED();
+        std::vector<std::vector<ov::Tensor>> expected, expected_states;
+        std::vector<std::vector<ov::Tensor>> actual, actual_states;
+        run_with_states(configuration, expected, expected_states);
+
+        auto offload_config = configuration;
+        offload_config[ov::intel_cpu::cpu_kv_cache_offload_dir.name()] = ::testing::TempDir();
+        offload_config[ov::intel_cpu::cpu_kv_cache_hot_tokens.name()] = 4;
+        run_with_states(offload_config, actual, actual_states);
+
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < actual.size(); i++) {
+            compare(expected[i], actual[i]);
+            ASSERT_EQ(expected_states[i].size(), actual_states[i].size());
+            for (size_t j = 0; j < actual_states[i].size(); j++) {
+                ASSERT_EQ(expected_states[i][j].get_shape(), actual_states[i][j].get_shape());
+                ov::test::utils::compare(expected_states[i][j], actual_states[i][j], 0.0F, 0.0F);
+            }
+        }
+#if defined(__linux__)
+        // the cold tokens were really written to the files
+        const auto statistics =
+            compiledModel.get_property(ov::intel_cpu::cpu_kv_cache_offload_statistics.name())
+                .as<std::map<std::string, uint64_t>>();
+        ASSERT_GT(statistics.at("spills"), 0U);
+        ASSERT_GT(statistics.at("spilled_bytes"), 0U);
+#endif
+    }
+};
+
+TEST_P(ConcatSDPKVCacheOffloadTest, CompareWithRam) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    run();
+}
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {
+        {{1, 8, -1, 64}, {{1, 8, 10, 64}, {1, 8, 1, 64}, {1, 8, 1, 64}, {1, 8, 20, 64}, {1, 8, 1, 64}}},
+        {{1, 8, -1, 64}, {{1, 8, 0, 64}, {1, 8, 10, 64}, {1, 8, 11, 64}, {1, 8, 12, 64}, {1, 8, 32, 64}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPKVCacheOffload,
+                         ConcatSDPKVCacheOffloadTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::AnyMap{}, ov::AnyMap{{"KV_CACHE_PRECISION", "u8"}}),
+                                            ::testing::Values(false),
+                                            ::testing::Values<int64_t>(8),
+                                            ::testing::Values<int64_t>(8, 2)),
+                         ConcatSDPTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
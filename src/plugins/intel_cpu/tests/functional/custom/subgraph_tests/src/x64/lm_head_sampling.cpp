@@ -0,0 +1,175 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "transformations/rt_info/decompression.hpp"
+
+namespace ov {
+namespace test {
+
+struct LMHeadSamplingParams {
+    ov::test::InputShape inputShape;
+    size_t vocab_size;
+    // "TopK" or "Multinomial"
+    std::string selection;
+    int64_t top_k;
+    // "None", "Multiply" or "Divide"
+    std::string temperature_op;
+    float temperature;
+    bool with_logits;
+    ov::element::Type index_type;
+};
+
+class LMHeadSamplingTest : public testing::WithParamInterface<LMHeadSamplingParams>,
+                           public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LMHeadSamplingParams>& obj) {
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({obj.param.inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : obj.param.inputShape.second) {
+            result << ov::test::utils::vec2str(shape);
+            result << "_";
+        }
+        result << "vocab_size=" << obj.param.vocab_size << "_";
+        result << "selection=" << obj.param.selection << "_";
+        result << "top_k=" << obj.param.top_k << "_";
+        result << "temperature_op=" << obj.param.temperature_op << "_";
+        result << "with_logits=" << obj.param.with_logits << "_";
+        result << "index_type=" << obj.param.index_type << "_";
+        result << obj.index;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        auto& param = this->GetParam();
+
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        // the logits are accumulated in a different order than by the reference MatMul
+        abs_threshold = 1e-3;
+
+        init_input_shapes({param.inputShape});
+
+        auto src = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        const auto hidden_size = static_cast<size_t>(inputDynamicShapes[0].rbegin()->get_length());
+
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -0.5;
+        in_data.range = 1;
+        in_data.resolution = 1024;
+        auto tensor_f16 = ov::test::utils::create_and_fill_tensor(ov::element::f16,
+                                                                  ov::Shape{param.vocab_size, hidden_size},
+                                                                  in_data);
+        auto weight_f16 = std::make_shared<ov::op::v0::Constant>(tensor_f16);
+        auto weight_f32 = std::make_shared<ov::op::v0::Convert>(weight_f16, ov::element::f32);
+        mark_as_decompression(weight_f32);
+        auto lm_head = std::make_shared<ov::op::v0::MatMul>(src, weight_f32, false, true);
+
+        ov::Output<ov::Node> logits = lm_head;
+        if (param.temperature_op == "Multiply") {
+            auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {1.0F / param.temperature});
+            logits = std::make_shared<ov::op::v1::Multiply>(lm_head, scale);
+        } else if (param.temperature_op == "Divide") {
+            auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {param.temperature});
+            logits = std::make_shared<ov::op::v1::Divide>(lm_head, scale);
+        }
+
+        ov::OutputVector outputs;
+        if (param.selection == "TopK") {
+            auto k = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {param.top_k});
+            auto topk = std::make_shared<ov::op::v11::TopK>(logits,
+                                                            k,
+                                                            -1,
+                                                            ov::op::TopKMode::MAX,
+                                                            ov::op::TopKSortType::SORT_VALUES,
+                                                            param.index_type);
+            outputs = {topk->output(0), topk->output(1)};
+        } else {
+            auto probs = std::make_shared<ov::op::v8::Softmax>(logits, -1);
+            auto num_samples = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {1});
+            auto multinomial = std::make_shared<ov::op::v13::Multinomial>(probs,
+                                                                          num_samples,
+                                                                          param.index_type,
+                                                                          false,
+                                                                          false,
+                                                                          42,
+                                                                          7);
+            outputs = {multinomial};
+        }
+        if (param.with_logits) {
+            // the logits consumed besides the selection are the logits output of the fused node
+            outputs.push_back(lm_head);
+        }
+
+        function = std::make_shared<ov::Model>(outputs, ov::ParameterVector{src});
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& param = function->get_parameters()[0];
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 1024;
+        inputs.insert({param,
+                       ov::test::utils::create_and_fill_tensor(ov::element::f32, targetInputStaticShapes[0], in_data)});
+    }
+
+    void check_results() {
+        auto exec_model = compiledModel.get_runtime_model();
+        int fused_node_found = 0;
+        for (const auto& n : exec_model->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type == "LMHeadSampling")
+                fused_node_found++;
+        }
+        ASSERT_EQ(fused_node_found, 1);
+    }
+};
+
+TEST_P(LMHeadSamplingTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx2())
+        GTEST_SKIP();
+    run();
+    check_results();
+}
+
+namespace {
+
+static ov::test::InputShape ishape{ov::PartialShape{-1, 256}, {ov::Shape{1, 256}, ov::Shape{5, 256}}};
+
+const std::vector<LMHeadSamplingParams> lm_head_sampling_params = {
+    // greedy and top-k
+    {ishape, 1000, "TopK", 1, "None", 1.0F, false, ov::element::i32},
+    {ishape, 1000, "TopK", 1, "None", 1.0F, true, ov::element::i64},
+    {ishape, 1000, "TopK", 8, "Multiply", 0.7F, false, ov::element::i64},
+    {ishape, 1000, "TopK", 8, "Divide", 1.5F, true, ov::element::i32},
+    // the tiny temperature makes the distribution one-hot, so the sample is the same whatever the random numbers
+    {ishape, 1000, "Multinomial", 1, "Divide", 1e-4F, false, ov::element::i32},
+    {ishape, 1000, "Multinomial", 1, "Multiply", 1e-4F, true, ov::element::i64},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LMHeadSampling,
+                         LMHeadSamplingTest,
+                         ::testing::ValuesIn(lm_head_sampling_params),
+                         LMHeadSamplingTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
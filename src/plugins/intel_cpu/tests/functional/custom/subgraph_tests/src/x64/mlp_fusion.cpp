@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/gelu.hpp"
 #include "openvino/op/matmul.hpp"
@@ -26,6 +27,7 @@ struct LLMMLPFusionParams {
     std::string act_type;
     bool use_dynamic_quant;
     bool use_swapped_outputs;  // true = create pattern with swapped VariadicSplit outputs (should still fuse)
+    bool use_tensor_parallel = false;
 };
 
 class LLMMLPFusionTest : public testing::WithParamInterface<LLMMLPFusionParams>, public ov::test::SubgraphBaseTest {
@@ -43,6 +45,7 @@ public:
         result << "act_type=" << obj.param.act_type << "_";
         result << "use_dynamic_quant=" << obj.param.use_dynamic_quant << "_";
         result << "use_swapped_outputs=" << obj.param.use_swapped_outputs << "_";
+        result << "use_tensor_parallel=" << obj.param.use_tensor_parallel << "_";
         result << obj.index;
         return result.str();
     }
@@ -54,6 +57,12 @@ protected:
         auto& param = this->GetParam();
 
         configuration[ov::hint::inference_precision.name()] = "bf16";
+        configuration[ov::intel_cpu::cpu_llm_fusion_without_amx.name()] = "true";
+        if (param.use_tensor_parallel) {
+            configuration[ov::hint::model_distribution_policy.name()] = "TENSOR_PARALLEL";
+            configuration[ov::intel_cpu::enable_tensor_parallel.name()] = "true";
+            configuration[ov::num_streams.name()] = "1";
+        }
 
         init_input_shapes({param.inputShape});
 
@@ -178,7 +187,8 @@ protected:
 };
 
 TEST_P(LLMMLPFusionTest, CompareWithRefs) {
-    if (!ov::with_cpu_x86_avx512_core_amx_bf16())
+    // the CPUs without AMX run the fused node with the AVX-512/AVX2 kernels, which are enabled by the test config
+    if (!ov::with_cpu_x86_avx2())
         GTEST_SKIP();
     run();
     check_results();
@@ -205,6 +215,19 @@ INSTANTIATE_TEST_SUITE_P(smoke_LLMMLPFusion,
                          ::testing::ValuesIn(mlp_params),
                          LLMMLPFusionTest::getTestCaseName);
 
+// intermediate channels are partitioned between the sub-streams: one per socket, or 2 sub-streams on a single socket
+// as enable_tensor_parallel forces them with a single stream, so the all-reduce runs on any machine
+const std::vector<LLMMLPFusionParams> mlp_tensor_parallel_params = {
+    {ishape, 4096 / 4, 11008 / 4, "Swish", false, false, true},
+    {ishape, 4096 / 4, 11008 / 4, "Swish", true, false, true},
+    {ishape, 4096 / 4, 11008 / 4, "Gelu", false, true, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LLMMLPFusion_TensorParallel,
+                         LLMMLPFusionTest,
+                         ::testing::ValuesIn(mlp_tensor_parallel_params),
+                         LLMMLPFusionTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
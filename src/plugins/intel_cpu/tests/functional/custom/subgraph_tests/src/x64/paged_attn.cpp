@@ -66,6 +66,23 @@ INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnSharedKVCache,
                                             ::testing::Values(true)),   // addSharedReader
                          PagedAttnTestBase::getTestCaseName);
 
+// The heads are partitioned between 2 sub-streams even on a single socket, every rank writes its heads to the caches
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest_TensorParallel,
+                         PagedAttnVSSDPATest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),        // extendBlockIndices
+                                            ::testing::Values(false),        // enableXattn
+                                            ::testing::Values(true, false),  // sinkInput
+                                            ::testing::Values(0),            // slidingWindow
+                                            ::testing::Values(ov::AnyMap{
+                                                {ov::intel_cpu::enable_sage_attn.name(), false},
+                                                {ov::hint::model_distribution_policy.name(), "TENSOR_PARALLEL"},
+                                                {ov::intel_cpu::enable_tensor_parallel.name(), true},
+                                                {ov::num_streams.name(), 1}}),
+                                            ::testing::Values(false)),  // addSharedReader
+                         PagedAttnTestBase::getTestCaseName);
+
 const std::vector<InputShapes> inputShapes = {  // greedy search
     {
         // L1, B, H, S
@@ -0,0 +1,194 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "custom/subgraph_tests/src/classes/concat_sdp.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace test {
+namespace {
+
+// With a single stream on a single socket, enable_tensor_parallel splits the stream into 2 sub-streams, so the
+// partitioning of the heads between the ranks runs on any machine.
+ov::AnyMap tensor_parallel_config(ov::AnyMap config) {
+    config[ov::hint::model_distribution_policy.name()] = "TENSOR_PARALLEL";
+    config[ov::intel_cpu::enable_tensor_parallel.name()] = true;
+    config[ov::num_streams.name()] = 1;
+    return config;
+}
+
+using SDPATensorParallelParams = std::tuple<ElementType, std::vector<InputShape>>;
+
+// The heads of a non-stateful SDPA are partitioned between the ranks and gathered back
+class SDPATensorParallelTest : public testing::WithParamInterface<SDPATensorParallelParams>,
+                               virtual public ov::test::SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SDPATensorParallelParams>& obj) {
+        const auto& [inType, inputShapes] = obj.param;
+        std::ostringstream result;
+        result << "IS=";
+        for (const auto& shape : inputShapes) {
+            result << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : inputShapes) {
+            for (const auto& itr : shape.second) {
+                result << ov::test::utils::vec2str(itr);
+            }
+            result << "_";
+        }
+        result << "Prc=" << inType;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& [inType, inputShapes] = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        init_input_shapes(inputShapes);
+
+        ov::ParameterVector params;
+        for (const auto& name : {"q", "k", "v"}) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(inType, inputDynamicShapes[params.size()]));
+            params.back()->set_friendly_name(name);
+        }
+        auto sdp = std::make_shared<ov::op::v13::ScaledDotProductAttention>(params[0], params[1], params[2], true);
+        sdp->set_friendly_name("mha");
+        function = std::make_shared<ov::Model>(ov::OutputVector{sdp}, params, "SDPATensorParallel");
+    }
+
+    std::vector<ov::Tensor> run_test(const ov::AnyMap& config) {
+        configuration = config;
+        compile_model();
+        inferRequest = compiledModel.create_infer_request();
+        std::vector<ov::Tensor> outputs;
+        for (const auto& shapes : targetStaticShapes) {
+            generate_inputs(shapes);
+            for (const auto& input : inputs) {
+                inferRequest.set_tensor(input.first, input.second);
+            }
+            inferRequest.infer();
+            const auto output = inferRequest.get_output_tensor(0);
+            ov::Tensor copy{output.get_element_type(), output.get_shape()};
+            output.copy_to(copy);
+            outputs.push_back(copy);
+        }
+        return outputs;
+    }
+};
+
+TEST_P(SDPATensorParallelTest, CompareWithSingleStream) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto expected = run_test(configuration);
+    const auto actual = run_test(tensor_parallel_config(configuration));
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        ov::test::utils::compare(expected[i], actual[i], 1e-5F, 1e-5F);
+    }
+}
+
+// The stateful SDPA keeps all the heads of its KV cache on every rank: the outputs and the states must match the
+// single stream run, including the states read after the cache grew.
+class ConcatSDPTensorParallelTest : public ConcatSDPTest {
+protected:
+    void run_with_states(const ov::AnyMap& config,
+                         std::vector<std::vector<ov::Tensor>>& outputs,
+                         std::vector<std::vector<ov::Tensor>>& states) {
+        compiledModel = core->compile_model(function, targetDevice, config);
+        auto req = compiledModel.create_infer_request();
+        m_iter = 0;
+        m_accum_L_q = 0;
+        auto copy = [](const ov::Tensor& src) {
+            ov::Tensor dst{src.get_element_type(), src.get_shape()};
+            src.copy_to(dst);
+            return dst;
+        };
+        for (const auto& shapes : targetStaticShapes) {
+            generate_inputs(shapes);
+            for (const auto& port : compiledModel.inputs()) {
+                const auto& name = port.get_node()->get_friendly_name();
+                for (const auto& [node, tensor] : inputs) {
+                    if (node->get_friendly_name() == name) {
+                        req.set_tensor(port, tensor);
+                        break;
+                    }
+                }
+            }
+            req.infer();
+            outputs.emplace_back();
+            for (const auto& port : compiledModel.outputs()) {
+                outputs.back().push_back(copy(req.get_tensor(port)));
+            }
+            states.emplace_back();
+            for (auto&& state : req.query_state()) {
+                states.back().push_back(copy(state.get_state()));
+            }
+        }
+    }
+
+    void run() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED();
+        std::vector<std::vector<ov::Tensor>> expected, expected_states;
+        std::vector<std::vector<ov::Tensor>> actual, actual_states;
+        run_with_states(configuration, expected, expected_states);
+        run_with_states(tensor_parallel_config(configuration), actual, actual_states);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < actual.size(); i++) {
+            compare(expected[i], actual[i]);
+            ASSERT_EQ(expected_states[i].size(), actual_states[i].size());
+            for (size_t j = 0; j < actual_states[i].size(); j++) {
+                ASSERT_EQ(expected_states[i][j].get_shape(), actual_states[i][j].get_shape());
+                ov::test::utils::compare(expected_states[i][j], actual_states[i][j], 0.0F, 0.0F);
+            }
+        }
+    }
+};
+
+TEST_P(ConcatSDPTensorParallelTest, CompareWithSingleStream) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    run();
+}
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {
+        // q
+        {{-1, 8, -1, 64}, {{1, 8, 10, 64}, {2, 8, 33, 64}}},
+        // k
+        {{-1, 8, -1, 64}, {{1, 8, 10, 64}, {2, 8, 33, 64}}},
+        // v
+        {{-1, 8, -1, 64}, {{1, 8, 10, 64}, {2, 8, 33, 64}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPATensorParallel,
+                         SDPATensorParallelTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32), ::testing::ValuesIn(inputShapes)),
+                         SDPATensorParallelTest::getTestCaseName);
+
+const std::vector<std::vector<InputShape>> statefulInputShapes = {
+    {
+        {{1, 8, -1, 64}, {{1, 8, 10, 64}, {1, 8, 1, 64}, {1, 8, 1, 64}, {1, 8, 20, 64}, {1, 8, 1, 64}}},
+        {{1, 8, -1, 64}, {{1, 8, 0, 64}, {1, 8, 10, 64}, {1, 8, 11, 64}, {1, 8, 12, 64}, {1, 8, 32, 64}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTensorParallel,
+                         ConcatSDPTensorParallelTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(statefulInputShapes),
+                                            ::testing::Values(ov::AnyMap{}, ov::AnyMap{{"KV_CACHE_PRECISION", "u8"}}),
+                                            ::testing::Values(false),
+                                            ::testing::Values<int64_t>(8),
+                                            ::testing::Values<int64_t>(8, 2)),
+                         ConcatSDPTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
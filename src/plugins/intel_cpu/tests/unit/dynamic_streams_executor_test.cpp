@@ -0,0 +1,200 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "dynamic_streams_executor.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// keeps the tasks until they are executed explicitly, so the inferences stay in flight
+struct DeferredExecutor : public ov::threading::IStreamsExecutor {
+    explicit DeferredExecutor(int stream_id = 0) : stream_id(stream_id) {}
+    void run(ov::threading::Task task) override {
+        if (immediate) {
+            task();
+        } else {
+            tasks.push_back(std::move(task));
+        }
+    }
+    void run_with_priority(ov::threading::Task task, const ov::threading::TaskPriority& priority) override {
+        priorities.push_back(priority.level);
+        run(std::move(task));
+    }
+    void execute(ov::threading::Task task) override {
+        executed++;
+        task();
+    }
+    int get_stream_id() override {
+        return stream_id;
+    }
+    int get_streams_num() override {
+        return 4;
+    }
+    int get_numa_node_id() override {
+        return stream_id;
+    }
+    int get_socket_id() override {
+        return stream_id;
+    }
+    std::vector<int> get_rank() override {
+        return {};
+    }
+    void cpu_reset() override {}
+    void execute_all() {
+        auto pending = std::move(tasks);
+        tasks.clear();
+        for (auto& task : pending) {
+            task();
+        }
+    }
+    void execute_last() {
+        auto task = std::move(tasks.back());
+        tasks.pop_back();
+        task();
+    }
+    const int stream_id;
+    bool immediate = false;
+    std::vector<ov::threading::Task> tasks;
+    std::vector<int> priorities;
+    int executed = 0;
+};
+
+class DynamicStreamsExecutorTest : public ::testing::Test {
+protected:
+    std::shared_ptr<DeferredExecutor> m_narrow = std::make_shared<DeferredExecutor>(0);
+    std::shared_ptr<DeferredExecutor> m_wide = std::make_shared<DeferredExecutor>(1);
+    // 2 wide streams, 4 low load inferences to regroup the cores back into the wide streams
+    std::shared_ptr<DynamicStreamsExecutor> m_executor =
+        std::make_shared<DynamicStreamsExecutor>(m_narrow, m_wide, 2, 4);
+};
+}  // namespace
+
+TEST_F(DynamicStreamsExecutorTest, LowLoadUsesWideStreams) {
+    bool wide_stream = false;
+    m_executor->run([&] {
+        wide_stream = m_executor->runs_wide_stream();
+    });
+    m_executor->run([] {});
+    ASSERT_EQ(m_wide->tasks.size(), 2U);
+    ASSERT_TRUE(m_narrow->tasks.empty());
+    m_wide->execute_all();
+    ASSERT_TRUE(wide_stream);
+    ASSERT_FALSE(m_executor->runs_wide_stream());
+}
+
+TEST_F(DynamicStreamsExecutorTest, FailedInferencesAreNotInFlight) {
+    for (int i = 0; i < 2; i++) {
+        m_executor->run([] {
+            OPENVINO_THROW("inference failed");
+        });
+    }
+    ASSERT_THROW(m_wide->execute_last(), ov::Exception);
+    ASSERT_THROW(m_wide->execute_last(), ov::Exception);
+    ASSERT_FALSE(m_executor->runs_wide_stream());
+    // no inference is in flight, so the next one is not queued on the narrow streams
+    m_executor->run([] {});
+    ASSERT_EQ(m_wide->tasks.size(), 1U);
+    ASSERT_TRUE(m_narrow->tasks.empty());
+}
+
+TEST_F(DynamicStreamsExecutorTest, QueuedInferencesSwitchToNarrowStreamsWithoutDraining) {
+    m_executor->run([] {});
+    m_executor->run([] {});
+    bool wide_stream = true;
+    m_executor->run([&] {
+        wide_stream = m_executor->runs_wide_stream();
+    });
+    // the inferences in flight stay on the wide streams
+    ASSERT_EQ(m_wide->tasks.size(), 2U);
+    ASSERT_EQ(m_narrow->tasks.size(), 1U);
+    m_narrow->execute_all();
+    ASSERT_FALSE(wide_stream);
+    m_wide->execute_all();
+
+    const auto statistics = m_executor->get_statistics();
+    ASSERT_EQ(statistics.at("wide_inferences"), 2U);
+    ASSERT_EQ(statistics.at("narrow_inferences"), 1U);
+    ASSERT_EQ(statistics.at("switches"), 1U);
+}
+
+TEST_F(DynamicStreamsExecutorTest, SwitchBackToWideStreamsAfterSustainedLowLoad) {
+    for (int i = 0; i < 3; i++) {
+        m_executor->run([] {});
+    }
+    m_wide->execute_all();
+    m_narrow->execute_all();
+    // 3 low load inferences are not enough to regroup the cores
+    for (int i = 0; i < 3; i++) {
+        m_executor->run([] {});
+        m_narrow->execute_all();
+    }
+    ASSERT_TRUE(m_wide->tasks.empty());
+    m_executor->run([] {});
+    ASSERT_EQ(m_wide->tasks.size(), 1U);
+    m_wide->execute_all();
+    ASSERT_EQ(m_executor->get_statistics().at("switches"), 2U);
+}
+
+TEST_F(DynamicStreamsExecutorTest, NoSwitchToWideStreamsWhileNarrowStreamsRun) {
+    for (int i = 0; i < 3; i++) {
+        m_executor->run([] {});
+    }
+    m_wide->execute_all();
+    // the load is low, but the narrow inference in flight keeps the cores busy
+    for (int i = 0; i < 4; i++) {
+        m_executor->run([] {});
+        m_narrow->execute_last();
+    }
+    ASSERT_TRUE(m_wide->tasks.empty());
+    m_narrow->execute_all();
+    m_executor->run([] {});
+    ASSERT_EQ(m_wide->tasks.size(), 1U);
+    m_wide->execute_all();
+}
+
+TEST_F(DynamicStreamsExecutorTest, ForwardsPriorityAndStreamQueries) {
+    int stream_id = -1;
+    int numa_node_id = -1;
+    m_executor->run_with_priority(
+        [&] {
+            stream_id = m_executor->get_stream_id();
+            numa_node_id = m_executor->get_numa_node_id();
+        },
+        {5});
+    ASSERT_EQ(m_wide->priorities, std::vector<int>{5});
+    m_wide->execute_all();
+    ASSERT_EQ(stream_id, 1);
+    ASSERT_EQ(numa_node_id, 1);
+    ASSERT_EQ(m_executor->get_stream_id(), 0);
+    ASSERT_EQ(m_executor->get_streams_num(), 4);
+}
+
+TEST_F(DynamicStreamsExecutorTest, ExecuteRunsOnTheSelectedStreams) {
+    bool wide_stream = false;
+    m_executor->execute([&] {
+        wide_stream = m_executor->runs_wide_stream();
+    });
+    ASSERT_TRUE(wide_stream);
+    ASSERT_EQ(m_wide->executed, 1);
+    ASSERT_EQ(m_narrow->executed, 0);
+    ASSERT_EQ(m_executor->get_statistics().at("wide_inferences"), 1U);
+}
+
+TEST_F(DynamicStreamsExecutorTest, RunWideAndWaitUsesWideStreams) {
+    m_wide->immediate = true;
+    bool wide_stream = false;
+    m_executor->run_wide_and_wait({[&] {
+        wide_stream = m_executor->runs_wide_stream();
+    }});
+    ASSERT_TRUE(wide_stream);
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/x64/fc_weights_decompression.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "openvino/core/type/element_iterator.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float8_e4m3.hpp"
+#include "openvino/core/type/float8_e5m2.hpp"
+
+using namespace ov::Extensions::Cpu::XARCH;
+
+namespace {
+
+void check_dot(const std::vector<float>& decompressed) {
+    const size_t K = decompressed.size();
+    std::vector<float> src(K);
+    double expected_dot = 0.0;
+    for (size_t k = 0; k < K; k++) {
+        src[k] = static_cast<float>(k % 7) - 3.0F;
+        expected_dot += src[k] * decompressed[k];
+    }
+
+    const float dot = fc_dot(src.data(), decompressed.data(), K);
+    EXPECT_NEAR(dot, expected_dot, 1e-4 * std::fabs(expected_dot) + 1e-3);
+}
+
+template <ov::element::Type_t ET>
+void check_split_bit_fc(size_t K, size_t group_size, bool per_group_zp) {
+    const ov::element::Type type(ET);
+    const int max_value = (1 << type.bitwidth()) - 1;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<int> q(K);
+    std::vector<uint8_t> weights(K * type.bitwidth() / 8);
+    auto it = ov::element::iterator<ET>(static_cast<int8_t*>(static_cast<void*>(weights.data())));
+    for (size_t i = 0; i < K; i++, ++it) {
+        q[i] = dist(gen);
+        *it = static_cast<int8_t>(q[i]);
+    }
+
+    std::vector<uint8_t> packed(weights.size());
+    fc_pack_split_bit(weights.data(), type, K, packed.data());
+
+    const size_t groups = K / group_size;
+    std::vector<float> scales(groups);
+    std::vector<float> zero_points(per_group_zp ? groups : 1);
+    for (size_t g = 0; g < groups; g++) {
+        scales[g] = 0.25F * static_cast<float>(g + 1);
+    }
+    for (size_t g = 0; g < zero_points.size(); g++) {
+        zero_points[g] = static_cast<float>((g + max_value / 2) % (max_value + 1));
+    }
+
+    std::vector<float> decompressed(K);
+    fc_decompress_split_bit(packed.data(),
+                            type,
+                            K,
+                            group_size,
+                            scales.data(),
+                            zero_points.data(),
+                            per_group_zp ? 1 : 0,
+                            decompressed.data());
+
+    for (size_t k = 0; k < K; k++) {
+        const size_t g = k / group_size;
+        const float zp = zero_points[per_group_zp ? g : 0];
+        const float expected = (static_cast<float>(q[k]) - zp) * scales[g];
+        ASSERT_FLOAT_EQ(decompressed[k], expected) << "k = " << k;
+    }
+    check_dot(decompressed);
+}
+
+template <typename T>
+void check_lut_fc(size_t K, size_t group_size) {
+    std::vector<float> lut(256);
+    for (size_t code = 0; code < lut.size(); code++) {
+        lut[code] = static_cast<float>(T::from_bits(static_cast<uint8_t>(code)));
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> weights(K);
+    for (auto& w : weights) {
+        // NaN and infinity codes never appear in the real weights
+        do {
+            w = static_cast<uint8_t>(dist(gen));
+        } while (!std::isfinite(lut[w]));
+    }
+
+    // powers of two, as the f8e8m0 block scales of the MX formats
+    const size_t groups = K / group_size;
+    std::vector<float> scales(groups);
+    for (size_t g = 0; g < groups; g++) {
+        scales[g] = std::ldexp(1.0F, static_cast<int>(g % 5) - 2);
+    }
+
+    std::vector<float> decompressed(K);
+    fc_decompress_lut(weights.data(), lut.data(), K, group_size, scales.data(), decompressed.data());
+
+    for (size_t k = 0; k < K; k++) {
+        const float expected = lut[weights[k]] * scales[k / group_size];
+        ASSERT_FLOAT_EQ(decompressed[k], expected) << "k = " << k;
+    }
+    check_dot(decompressed);
+}
+
+// the tails of M and N which do not fill the micro tile are computed by the dot products
+void check_gemm(size_t M, size_t N, size_t K) {
+    std::vector<float> a(M * K);
+    std::vector<float> b(N * K);
+    for (size_t i = 0; i < a.size(); i++) {
+        a[i] = static_cast<float>(i % 11) - 5.0F;
+    }
+    for (size_t i = 0; i < b.size(); i++) {
+        b[i] = 0.125F * static_cast<float>(i % 13) - 0.75F;
+    }
+
+    const size_t ldc = N + 3;
+    std::vector<float> c(M * ldc, -1.0F);
+    fc_gemm(a.data(), b.data(), M, N, K, c.data(), ldc);
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            double expected = 0.0;
+            for (size_t k = 0; k < K; k++) {
+                expected += a[m * K + k] * b[n * K + k];
+            }
+            ASSERT_NEAR(c[m * ldc + n], expected, 1e-4 * std::fabs(expected) + 1e-3) << "m = " << m << ", n = " << n;
+        }
+        for (size_t n = N; n < ldc; n++) {
+            ASSERT_EQ(c[m * ldc + n], -1.0F);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(FCWeightsDecompressionTest, U6PerGroupZeroPoints) {
+    check_split_bit_fc<ov::element::u6>(256, 32, true);
+}
+
+TEST(FCWeightsDecompressionTest, U6PerTensorZeroPoint) {
+    check_split_bit_fc<ov::element::u6>(512, 16, false);
+}
+
+TEST(FCWeightsDecompressionTest, U3PerTensorZeroPoint) {
+    check_split_bit_fc<ov::element::u3>(256, 16, false);
+}
+
+TEST(FCWeightsDecompressionTest, U3PerGroupZeroPoints) {
+    check_split_bit_fc<ov::element::u3>(192, 64, true);
+}
+
+TEST(FCWeightsDecompressionTest, F8E4M3PerChannelScale) {
+    check_lut_fc<ov::float8_e4m3>(256, 256);
+}
+
+TEST(FCWeightsDecompressionTest, F8E4M3BlockScales) {
+    check_lut_fc<ov::float8_e4m3>(512, 32);
+}
+
+TEST(FCWeightsDecompressionTest, F8E5M2BlockScales) {
+    check_lut_fc<ov::float8_e5m2>(192, 16);
+}
+
+TEST(FCWeightsDecompressionTest, GemmFullTiles) {
+    check_gemm(16, 16, 256);
+}
+
+TEST(FCWeightsDecompressionTest, GemmTails) {
+    check_gemm(13, 7, 192);
+}
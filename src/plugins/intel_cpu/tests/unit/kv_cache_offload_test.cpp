@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_offload.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+void fill(const MappedFile& file, size_t bytes, uint8_t seed) {
+    auto* data = static_cast<uint8_t*>(file.data());
+    for (size_t i = 0; i < bytes; i++) {
+        data[i] = static_cast<uint8_t>(i * 31 + seed);
+    }
+}
+
+bool check(const MappedFile& file, size_t bytes, uint8_t seed) {
+    const auto* data = static_cast<const uint8_t*>(file.data());
+    for (size_t i = 0; i < bytes; i++) {
+        if (data[i] != static_cast<uint8_t>(i * 31 + seed)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+class KVCacheOffloadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!KVCacheOffload::isSupported()) {
+            GTEST_SKIP();
+        }
+    }
+
+    const std::string m_dir = ::testing::TempDir();
+};
+
+}  // namespace
+
+TEST_F(KVCacheOffloadTest, MappedFileKeepsContent) {
+    MappedFile file(m_dir);
+    ASSERT_TRUE(file.resize(100000));
+    ASSERT_GE(file.size(), 100000U);
+    EXPECT_FALSE(file.resize(1000));
+    fill(file, 100000, 7);
+
+    // the content survives the growth of the mapping
+    ASSERT_TRUE(file.resize(1000000));
+    EXPECT_TRUE(check(file, 100000, 7));
+
+    // and the round trip through the file
+    EXPECT_EQ(file.spill(2 * file.size()) % 4096, 0U);
+    EXPECT_TRUE(check(file, 100000, 7));
+    EXPECT_GT(file.prefetch(100000), 0U);
+    EXPECT_TRUE(check(file, 100000, 7));
+}
+
+TEST_F(KVCacheOffloadTest, HotCachesStayInRam) {
+    KVCacheOffload offload(m_dir, 1024);
+    EXPECT_EQ(offload.allocate(1024), nullptr);
+    EXPECT_NE(offload.allocate(1025), nullptr);
+}
+
+TEST_F(KVCacheOffloadTest, SpillAndPrefetchFollowTheExecutionOrder) {
+    KVCacheOffload offload(m_dir, 16);
+    const size_t first = offload.registerCache();
+    const size_t second = offload.registerCache();
+    ASSERT_EQ(first, 0U);
+    ASSERT_EQ(second, 1U);
+
+    const size_t bytes = 1 << 20;
+    auto key = offload.allocate(64);
+    auto value = offload.allocate(64);
+    key->resize(bytes);
+    value->resize(bytes);
+    fill(*key, bytes, 1);
+    fill(*value, bytes, 2);
+
+    // nothing to read ahead before the caches were released once
+    offload.acquire(first);
+    offload.release(first, {{key, bytes}, {value, bytes / 2}});
+    offload.wait();
+    auto stats = offload.getStatistics();
+    EXPECT_EQ(stats["spills"], 1U);
+    EXPECT_EQ(stats["spilled_bytes"], bytes + bytes / 2);
+    EXPECT_EQ(stats["prefetches"], 0U);
+
+    // the caches of the first node are read while the last one runs
+    offload.acquire(second);
+    offload.wait();
+    stats = offload.getStatistics();
+    EXPECT_EQ(stats["prefetches"], 1U);
+    EXPECT_EQ(stats["prefetched_bytes"], bytes + bytes / 2);
+    EXPECT_TRUE(check(*key, bytes, 1));
+    EXPECT_TRUE(check(*value, bytes, 2));
+
+    // the node without the cold tokens is neither spilled nor prefetched
+    offload.release(second, {});
+    offload.acquire(first);
+    offload.wait();
+    EXPECT_EQ(offload.getStatistics()["spills"], 1U);
+    EXPECT_EQ(offload.getStatistics()["prefetches"], 1U);
+}
+
+TEST_F(KVCacheOffloadTest, GrowthDuringSpillAndPrefetch) {
+    KVCacheOffload offload(m_dir, 16);
+    const size_t id = offload.registerCache();
+    auto file = offload.allocate(64);
+    size_t bytes = 1 << 16;
+    file->resize(bytes);
+    fill(*file, bytes, 3);
+    // the cache grows while the background thread still works on the previous mapping
+    for (int i = 0; i < 8; i++) {
+        offload.release(id, {{file, bytes}});
+        offload.acquire(id);
+        file->resize(2 * bytes);
+        fill(*file, 2 * bytes, 3);
+        bytes *= 2;
+    }
+    offload.wait();
+    EXPECT_TRUE(check(*file, bytes, 3));
+}
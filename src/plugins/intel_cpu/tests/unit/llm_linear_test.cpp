@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/x64/llm_linear.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "openvino/core/type/float16.hpp"
+
+using namespace ov::Extensions::Cpu::XARCH;
+
+namespace {
+
+template <typename T>
+std::vector<T> random_values(size_t count, int low, int high, float step) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(low, high);
+    std::vector<T> values(count);
+    for (auto& v : values) {
+        v = static_cast<T>(static_cast<float>(dist(gen)) * step);
+    }
+    return values;
+}
+
+void check_linear_f16(int M, int N, int K) {
+    const int src_stride = K + 3;
+    const int wei_stride = K + 5;
+    const int dst_stride = N + 1;
+    const auto src = random_values<float>(M * src_stride, -8, 8, 0.125F);
+    const auto wei = random_values<ov::float16>(N * wei_stride, -16, 16, 0.0625F);
+    std::vector<float> dst(M * dst_stride, -1.0F);
+
+    llm_linear_f32_f16(src.data(), src_stride, wei.data(), wei_stride, dst.data(), dst_stride, M, N, K);
+
+    for (int m = 0; m < M; m++) {
+        for (int n = 0; n < N; n++) {
+            // the values are exact in f32, so only the order of the summation differs
+            double expected = 0.0;
+            for (int k = 0; k < K; k++) {
+                expected += src[m * src_stride + k] * static_cast<float>(wei[n * wei_stride + k]);
+            }
+            ASSERT_FLOAT_EQ(dst[m * dst_stride + n], static_cast<float>(expected)) << "m = " << m << ", n = " << n;
+        }
+    }
+}
+
+void check_linear_i8(int M, int N, int K) {
+    const auto src = random_values<int8_t>(M * K, -128, 127, 1.0F);
+    const auto wei = random_values<int8_t>(N * K, -127, 127, 1.0F);
+    std::vector<int32_t> dst(M * N);
+
+    llm_linear_i8_i8(src.data(), K, wei.data(), K, dst.data(), N, M, N, K);
+
+    for (int m = 0; m < M; m++) {
+        for (int n = 0; n < N; n++) {
+            int32_t expected = 0;
+            for (int k = 0; k < K; k++) {
+                expected += static_cast<int32_t>(src[m * K + k]) * wei[n * K + k];
+            }
+            ASSERT_EQ(dst[m * N + n], expected) << "m = " << m << ", n = " << n;
+        }
+    }
+}
+
+void check_act_mul(bool gelu) {
+    const int N = 77;
+    std::vector<float> gate(N);
+    std::vector<float> up(N);
+    for (int n = 0; n < N; n++) {
+        gate[n] = static_cast<float>(n - N / 2) * 0.25F;
+        up[n] = 1.0F + static_cast<float>(n % 5) * 0.5F;
+    }
+    std::vector<float> dst(N);
+
+    llm_mlp_act_mul(gate.data(), up.data(), dst.data(), N, gelu);
+
+    for (int n = 0; n < N; n++) {
+        const double x = gate[n];
+        const double act = gelu ? 0.5 * x * (1.0 + std::tanh(std::sqrt(2.0 / M_PI) * (x + 0.044715 * x * x * x)))
+                                : x / (1.0 + std::exp(-x));
+        const double expected = act * up[n];
+        EXPECT_NEAR(dst[n], expected, 1e-5 * std::fabs(expected) + 1e-6) << "x = " << x;
+    }
+}
+
+}  // namespace
+
+TEST(LLMLinearKernelTest, F16Decode) {
+    check_linear_f16(1, 37, 256);
+}
+
+TEST(LLMLinearKernelTest, F16Prefill) {
+    check_linear_f16(7, 64, 1000);
+}
+
+TEST(LLMLinearKernelTest, F16KTail) {
+    check_linear_f16(5, 13, 21);
+}
+
+TEST(LLMLinearKernelTest, I8Decode) {
+    check_linear_i8(1, 35, 512);
+}
+
+TEST(LLMLinearKernelTest, I8Prefill) {
+    check_linear_i8(9, 70, 333);
+}
+
+TEST(LLMLinearKernelTest, SiluMul) {
+    check_act_mul(false);
+}
+
+TEST(LLMLinearKernelTest, GeluMul) {
+    check_act_mul(true);
+}
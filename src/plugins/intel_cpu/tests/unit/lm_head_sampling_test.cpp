@@ -0,0 +1,209 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/x64/lm_head_sampling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "openvino/core/type/float16.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+struct LMHeadCase {
+    int M = 3;
+    int vocab = 1000;  // not a multiple of the vocabulary tile
+    int hidden = 64;
+    std::vector<float> src;
+    std::vector<ov::float16> weight;
+
+    explicit LMHeadCase(int rows = 3) : M(rows) {
+        std::mt19937 gen(7);
+        std::uniform_int_distribution<int> dist(-8, 8);
+        src.resize(M * hidden);
+        weight.resize(vocab * hidden);
+        // the logits are exact in f32
+        for (auto& v : src) {
+            v = static_cast<float>(dist(gen)) * 0.125F;
+        }
+        for (auto& v : weight) {
+            v = static_cast<ov::float16>(static_cast<float>(dist(gen)) * 0.0625F);
+        }
+    }
+
+    std::vector<float> logits(int m, float temperature) const {
+        std::vector<float> out(vocab);
+        for (int n = 0; n < vocab; n++) {
+            float sum = 0.0F;
+            for (int k = 0; k < hidden; k++) {
+                sum += src[m * hidden + k] * static_cast<float>(weight[n * hidden + k]);
+            }
+            out[n] = sum / temperature;
+        }
+        return out;
+    }
+
+    // tokens sorted like TopK: larger logit first, smaller index first on ties
+    std::vector<int> sorted(const std::vector<float>& l) const {
+        std::vector<int> order(vocab);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return l[a] > l[b];
+        });
+        return order;
+    }
+
+    // inverse CDF of softmax(l) restricted to the first count tokens of order
+    static int draw(const std::vector<float>& l, const std::vector<int>& order, size_t count, float random) {
+        const double max = *std::max_element(l.begin(), l.end());
+        double total = 0.0;
+        for (size_t i = 0; i < count; i++) {
+            total += std::exp(l[order[i]] - max);
+        }
+        double cdf = 0.0;
+        for (size_t i = 0; i < count; i++) {
+            cdf += std::exp(l[order[i]] - max);
+            if (cdf >= random * total) {
+                return order[i];
+            }
+        }
+        return order[count - 1];
+    }
+
+    LMHeadSampler sampler(const LMHeadSampler::Params& params) const {
+        return {weight.data(), hidden, vocab, hidden, params};
+    }
+};
+
+}  // namespace
+
+TEST(LMHeadSamplingTest, TopK) {
+    LMHeadCase test(2 * LM_HEAD_BLK_M_SIZE + 5);  // the rows span several blocks
+    LMHeadSampler::Params params;
+    params.top_k = 5;
+    auto sampler = test.sampler(params);
+
+    std::vector<float> values(test.M * params.top_k);
+    std::vector<int32_t> indices(test.M * params.top_k);
+    std::vector<float> logits(test.M * test.vocab);
+    sampler.run(test.src.data(),
+                test.hidden,
+                test.M,
+                nullptr,
+                values.data(),
+                indices.data(),
+                logits.data(),
+                test.vocab);
+
+    for (int m = 0; m < test.M; m++) {
+        const auto expected = test.logits(m, 1.0F);
+        const auto order = test.sorted(expected);
+        for (int i = 0; i < params.top_k; i++) {
+            ASSERT_EQ(indices[m * params.top_k + i], order[i]) << "m = " << m << ", i = " << i;
+            ASSERT_FLOAT_EQ(values[m * params.top_k + i], expected[order[i]]);
+        }
+        for (int n = 0; n < test.vocab; n++) {
+            ASSERT_FLOAT_EQ(logits[m * test.vocab + n], expected[n]);
+        }
+    }
+}
+
+TEST(LMHeadSamplingTest, GreedyTies) {
+    LMHeadCase test;
+    // the same row at both ends of the vocabulary, so the greedy token has a twin
+    const auto expected = test.logits(0, 1.0F);
+    const int best = test.sorted(expected)[0];
+    const int twin = test.vocab - 1;
+    if (best == twin) {
+        GTEST_SKIP();
+    }
+    std::copy_n(test.weight.begin() + best * test.hidden, test.hidden, test.weight.begin() + twin * test.hidden);
+    auto sampler = test.sampler({});
+
+    float value = 0.0F;
+    int32_t index = -1;
+    sampler.run(test.src.data(), test.hidden, 1, nullptr, &value, &index, nullptr, 0);
+    EXPECT_EQ(index, std::min(best, twin));
+    EXPECT_FLOAT_EQ(value, expected[best]);
+}
+
+TEST(LMHeadSamplingTest, SampleFromVocabulary) {
+    LMHeadCase test;
+    LMHeadSampler::Params params;
+    params.sample = true;
+    params.top_k = 0;
+    params.temperature = 2.0F;
+    auto sampler = test.sampler(params);
+
+    for (float random : {0.0F, 0.13F, 0.5F, 0.77F, 0.999F}) {
+        const std::vector<float> randoms(test.M, random);
+        std::vector<float> values(test.M);
+        std::vector<int32_t> indices(test.M);
+        sampler.run(test.src.data(), test.hidden, test.M, randoms.data(), values.data(), indices.data(), nullptr, 0);
+        for (int m = 0; m < test.M; m++) {
+            // the cumulative distribution in vocabulary order, like Multinomial
+            const auto l = test.logits(m, params.temperature);
+            std::vector<int> order(test.vocab);
+            std::iota(order.begin(), order.end(), 0);
+            const int expected = LMHeadCase::draw(l, order, order.size(), random);
+            EXPECT_EQ(indices[m], expected) << "m = " << m << ", random = " << random;
+            EXPECT_FLOAT_EQ(values[m], l[indices[m]]);
+        }
+    }
+}
+
+TEST(LMHeadSamplingTest, SampleTopKTopP) {
+    LMHeadCase test;
+    for (const auto& [top_k, top_p] : std::vector<std::pair<int, float>>{{4, 1.0F}, {0, 0.3F}, {8, 0.6F}}) {
+        LMHeadSampler::Params params;
+        params.sample = true;
+        params.top_k = top_k;
+        params.top_p = top_p;
+        params.temperature = 0.5F;
+        auto sampler = test.sampler(params);
+
+        for (float random : {0.05F, 0.5F, 0.95F}) {
+            const std::vector<float> randoms(test.M, random);
+            std::vector<float> values(test.M);
+            std::vector<int32_t> indices(test.M);
+            sampler.run(test.src.data(),
+                        test.hidden,
+                        test.M,
+                        randoms.data(),
+                        values.data(),
+                        indices.data(),
+                        nullptr,
+                        0);
+            for (int m = 0; m < test.M; m++) {
+                const auto l = test.logits(m, params.temperature);
+                const auto order = test.sorted(l);
+                // the nucleus is measured with the probabilities over the whole vocabulary
+                const double max = l[order[0]];
+                double total = 0.0;
+                for (float v : l) {
+                    total += std::exp(v - max);
+                }
+                size_t count = top_k > 0 ? top_k : LM_HEAD_MAX_CANDIDATES;
+                double mass = 0.0;
+                for (size_t i = 0; i < count && top_p < 1.0F; i++) {
+                    mass += std::exp(l[order[i]] - max) / total;
+                    if (mass >= top_p) {
+                        count = i + 1;
+                        break;
+                    }
+                }
+                EXPECT_EQ(indices[m], LMHeadCase::draw(l, order, count, random))
+                    << "top_k = " << top_k << ", top_p = " << top_p << ", m = " << m << ", random = " << random;
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "memory_control.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryBlockPtr dynamicBlock(NetworkMemoryControl& control) {
+    auto unit = control.createMemoryControlUnit("test");
+    const MemoryRegion region{0,
+                              2,
+                              -1,  // undefined size
+                              0,
+                              MemoryRegion::RegionType::VARIABLE,
+                              MemoryRegion::AllocType::POD};
+    unit->insert({region}, {});
+    return unit->solve().at(region.id);
+}
+
+MemoryControl::Ptr staticUnit(NetworkMemoryControl& control) {
+    auto unit = control.createMemoryControlUnit("test");
+    const MemoryRegion region{0,
+                              2,
+                              1024,
+                              0,
+                              MemoryRegion::RegionType::VARIABLE,
+                              MemoryRegion::AllocType::POD};
+    unit->insert({region}, {});
+    return unit;
+}
+}  // namespace
+
+TEST(MemoryControlTest, ShapeBuckets) {
+    NetworkMemoryControl control(true);
+    auto block = dynamicBlock(control);
+
+    ASSERT_TRUE(block->resize(5000));
+    auto* data = block->getRawPtr();
+    // same bucket
+    ASSERT_FALSE(block->resize(5100));
+    ASSERT_FALSE(block->resize(4500));
+    ASSERT_FALSE(block->resize(4500));
+    ASSERT_EQ(block->getRawPtr(), data);
+    // next bucket
+    ASSERT_TRUE(block->resize(5200));
+
+    auto statistics = control.getShapeBucketsStatistics();
+    ASSERT_EQ(statistics["block_reallocations"], 2U);
+    ASSERT_EQ(statistics["block_reuses"], 2U);
+}
+
+TEST(MemoryControlTest, NoShapeBuckets) {
+    NetworkMemoryControl control;
+    auto block = dynamicBlock(control);
+
+    ASSERT_TRUE(block->resize(5000));
+    ASSERT_TRUE(block->resize(5100));
+
+    auto statistics = control.getShapeBucketsStatistics();
+    ASSERT_EQ(statistics["block_reallocations"], 0U);
+    ASSERT_EQ(statistics["block_reuses"], 0U);
+}
+
+TEST(MemoryControlTest, ArenaPoolReuse) {
+    auto pool = std::make_shared<MemoryArenaPool>();
+
+    auto arena = pool->acquire(1000);
+    auto* data = arena->getRawPtr();
+    ASSERT_NE(data, nullptr);
+    arena.reset();
+
+    arena = pool->acquire(500);
+    ASSERT_EQ(arena->getRawPtr(), data);
+    auto other = pool->acquire(500);
+    ASSERT_NE(other->getRawPtr(), data);
+
+    auto statistics = pool->getStatistics();
+    ASSERT_EQ(statistics["arenas"], 2U);
+    ASSERT_EQ(statistics["borrows"], 3U);
+}
+
+TEST(MemoryControlTest, SharedArenas) {
+    auto pool = std::make_shared<MemoryArenaPool>();
+    NetworkMemoryControl first(false, pool);
+    NetworkMemoryControl second(false, pool);
+    auto firstUnit = staticUnit(first);
+    auto secondUnit = staticUnit(second);
+    auto firstBlock = firstUnit->solve().at(0);
+    auto secondBlock = secondUnit->solve().at(0);
+
+    firstUnit->allocateMemory();
+    auto* data = firstBlock->getRawPtr();
+    ASSERT_NE(data, nullptr);
+    first.releaseArenas();
+    ASSERT_FALSE(firstUnit->allocated());
+
+    // the idle graph memory is borrowed by another one
+    secondUnit->allocateMemory();
+    ASSERT_EQ(secondBlock->getRawPtr(), data);
+    second.releaseArenas();
+    ASSERT_EQ(pool->getStatistics()["arenas"], 1U);
+}
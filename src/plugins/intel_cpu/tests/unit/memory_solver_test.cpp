@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "best_fit_memory_solver.hpp"
+#include "openvino/runtime/memory_solver.hpp"
+
+using namespace ov::intel_cpu;
+using Box = ov::MemorySolver::Box;
+
+namespace {
+std::vector<Box> randomBoxes(size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> startDist(0, 100);
+    std::uniform_int_distribution<int> lifeDist(0, 20);
+    std::uniform_int_distribution<int64_t> sizeDist(1, 1000);
+    std::vector<Box> boxes;
+    for (size_t i = 0; i < count; ++i) {
+        const int start = startDist(gen);
+        boxes.push_back({start, start + lifeDist(gen), sizeDist(gen), static_cast<int64_t>(i)});
+    }
+    return boxes;
+}
+
+// max sum of the sizes of the boxes alive at the same time
+int64_t lowerBound(const std::vector<Box>& boxes) {
+    std::map<int, int64_t> delta;
+    for (const auto& box : boxes) {
+        delta[box.start] += box.size;
+        delta[box.finish + 1] -= box.size;
+    }
+    int64_t current = 0;
+    int64_t maxSize = 0;
+    for (const auto& item : delta) {
+        current += item.second;
+        maxSize = std::max(maxSize, current);
+    }
+    return maxSize;
+}
+
+void checkNoOverlap(const std::vector<Box>& boxes, const BestFitMemorySolver& solver, int64_t totalSize) {
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const auto& l = boxes[i];
+        const auto lOffset = solver.get_offset(l.id);
+        ASSERT_LE(lOffset + l.size, totalSize);
+        for (size_t j = i + 1; j < boxes.size(); ++j) {
+            const auto& r = boxes[j];
+            const auto rOffset = solver.get_offset(r.id);
+            const bool timeOverlap = l.start <= r.finish && r.start <= l.finish;
+            const bool memOverlap = lOffset < rOffset + r.size && rOffset < lOffset + l.size;
+            ASSERT_FALSE(timeOverlap && memOverlap) << "boxes " << l.id << " and " << r.id << " overlap";
+        }
+    }
+}
+}  // namespace
+
+TEST(MemorySolverTest, BestFitNoOverlap) {
+    for (unsigned seed = 0; seed < 10; ++seed) {
+        const auto boxes = randomBoxes(200, seed);
+        BestFitMemorySolver solver(boxes);
+        const auto totalSize = solver.solve();
+        ASSERT_GE(totalSize, lowerBound(boxes));
+        checkNoOverlap(boxes, solver, totalSize);
+    }
+}
+
+TEST(MemorySolverTest, BestFitReusesGaps) {
+    // the small box fits the gap left by the first one
+    const std::vector<Box> boxes{{0, 1, 10, 0}, {1, 4, 10, 1}, {2, 3, 5, 2}, {5, -1, 20, 3}};
+    BestFitMemorySolver solver(boxes);
+    ASSERT_EQ(solver.solve(), 20);
+    ASSERT_EQ(solver.get_offset(2), solver.get_offset(0));
+}
+
+TEST(MemorySolverTest, BestFitFallsBackToGreedyOnTimeLimit) {
+    const auto boxes = randomBoxes(100, 42);
+    BestFitMemorySolver solver(boxes, std::chrono::microseconds(0));
+    const auto totalSize = solver.solve();
+    ASSERT_EQ(solver.triedOrders(), 0U);
+    ov::MemorySolver greedy(boxes);
+    ASSERT_EQ(totalSize, greedy.solve());
+    checkNoOverlap(boxes, solver, totalSize);
+}
+
+TEST(MemorySolverTest, BestFitNotWorseThanGreedy) {
+    for (unsigned seed = 0; seed < 10; ++seed) {
+        const auto boxes = randomBoxes(300, seed);
+        ov::MemorySolver greedy(boxes);
+        BestFitMemorySolver bestFit(boxes, std::chrono::seconds(10));
+        ASSERT_LE(bestFit.solve(), greedy.solve());
+    }
+}
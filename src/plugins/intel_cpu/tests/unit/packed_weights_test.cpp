@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "packed_weights.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryPtr makeMemory(const dnnl::engine& eng, const Shape& shape, float value) {
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, shape);
+    auto memory = std::make_shared<Memory>(eng, desc);
+    auto* data = memory->getDataAs<float>();
+    for (size_t i = 0; i < shape.getElementsCount(); ++i) {
+        data[i] = value + static_cast<float>(i);
+    }
+    return memory;
+}
+
+void checkRecord(const PackedWeights& weights, const std::string& key, const MemoryCPtr& expected) {
+    const auto* data = weights.find(key, expected->getSize());
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(std::memcmp(data, expected->getData(), expected->getSize()), 0);
+}
+}  // namespace
+
+TEST(PackedWeightsTest, StreamRoundTrip) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto first = makeMemory(eng, Shape{3, 5}, 1.0F);
+    auto second = makeMemory(eng, Shape{7}, 100.0F);
+
+    std::stringstream stream;
+    PackedWeights::write(stream, "isa", {{"first", first}, {"second", second}});
+    stream << "tail";
+
+    auto weights = PackedWeights::read(stream, "isa");
+    ASSERT_NE(weights, nullptr);
+    ASSERT_EQ(weights->size(), 2U);
+    checkRecord(*weights, "first", first);
+    checkRecord(*weights, "second", second);
+    ASSERT_EQ(weights->find("first", second->getSize()), nullptr);
+    ASSERT_EQ(weights->find("third", first->getSize()), nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(weights->find("second", second->getSize())) % PackedWeights::alignment, 0U);
+
+    std::string tail;
+    stream >> tail;
+    ASSERT_EQ(tail, "tail");
+}
+
+TEST(PackedWeightsTest, BufferRoundTrip) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto first = makeMemory(eng, Shape{3, 5}, 1.0F);
+
+    std::stringstream stream;
+    PackedWeights::write(stream, "isa", {{"first", first}});
+    const auto blob = stream.str();
+    auto buffer = std::make_shared<ov::AlignedBuffer>(blob.size());
+    std::memcpy(buffer->get_ptr(), blob.data(), blob.size());
+
+    size_t offset = 0;
+    auto weights = PackedWeights::read(buffer, offset, "isa");
+    ASSERT_NE(weights, nullptr);
+    ASSERT_EQ(offset, blob.size());
+    checkRecord(*weights, "first", first);
+}
+
+TEST(PackedWeightsTest, NoSectionOrOtherIsa) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+
+    std::stringstream plain("no packed weights section here");
+    ASSERT_EQ(PackedWeights::read(plain, "isa"), nullptr);
+    ASSERT_EQ(plain.tellg(), 0);
+
+    std::stringstream stream;
+    PackedWeights::write(stream, "other_isa", {{"first", makeMemory(eng, Shape{4}, 0.0F)}});
+    const auto sectionSize = stream.str().size();
+    ASSERT_EQ(PackedWeights::read(stream, "isa"), nullptr);
+    ASSERT_EQ(static_cast<size_t>(stream.tellg()), sectionSize);
+}
+
+TEST(PackedWeightsTest, WeightsSharingRecords) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto source = makeMemory(eng, Shape{4}, 0.0F);
+    auto packed = makeMemory(eng, Shape{4}, 10.0F);
+
+    WeightsSharing cache;
+    ASSERT_TRUE(cache.getSourceName(source->getData()).empty());
+    cache.registerSource(source, "weights");
+    ASSERT_EQ(cache.getSourceName(source->getData()), "weights");
+
+    cache.addPacked("weights", "weights_1", packed);
+    auto records = cache.getPacked();
+    ASSERT_EQ(records.size(), 1U);
+    ASSERT_EQ(records.front().first, "weights_1");
+
+    packed.reset();
+    records.clear();
+    ASSERT_TRUE(cache.getPacked().empty());
+}
+
+TEST(PackedWeightsTest, ReleasedSourcesAreForgotten) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto source = makeMemory(eng, Shape{4}, 0.0F);
+    const void* data = source->getData();
+
+    WeightsSharing cache;
+    cache.registerSource(source, "weights");
+    source.reset();
+    // the data may be reused by other weights
+    ASSERT_TRUE(cache.getSourceName(data).empty());
+
+    auto other = makeMemory(eng, Shape{4}, 1.0F);
+    cache.registerSource(other, "other");
+    ASSERT_EQ(cache.getSourceName(other->getData()), "other");
+}
+
+TEST(PackedWeightsTest, AmbiguousSourcesAreNotStored) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto first = makeMemory(eng, Shape{4}, 0.0F);
+    auto second = makeMemory(eng, Shape{4}, 1.0F);
+    auto unique = makeMemory(eng, Shape{4}, 2.0F);
+    auto packed = makeMemory(eng, Shape{4}, 10.0F);
+    auto uniquePacked = makeMemory(eng, Shape{4}, 20.0F);
+
+    WeightsSharing cache;
+    cache.registerSource(first, "weights");
+    // the same memory registered again is not ambiguous
+    cache.registerSource(first, "weights");
+    cache.registerSource(unique, "unique");
+    cache.addPacked("weights", "weights_1", packed);
+    cache.addPacked("unique", "unique_1", uniquePacked);
+    ASSERT_EQ(cache.getPacked().size(), 2U);
+
+    // two different constants with the same identity may not share a stored record
+    cache.registerSource(second, "weights");
+    const auto records = cache.getPacked();
+    ASSERT_EQ(records.size(), 1U);
+    ASSERT_EQ(records.front().first, "unique_1");
+}
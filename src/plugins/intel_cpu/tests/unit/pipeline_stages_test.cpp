@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "pipeline_stages.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Model> makeTwoMatMulsModel() {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 16});
+    auto first_weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{16, 16}, {1.0F});
+    first_weights->set_friendly_name("first_weights");
+    auto first = std::make_shared<ov::op::v0::MatMul>(input, first_weights);
+    auto relu = std::make_shared<ov::op::v0::Relu>(first);
+    auto second_weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{16, 16}, {2.0F});
+    second_weights->set_friendly_name("second_weights");
+    auto second = std::make_shared<ov::op::v0::MatMul>(relu, second_weights);
+    auto relu_result = std::make_shared<ov::op::v0::Result>(relu);
+    auto result = std::make_shared<ov::op::v0::Result>(second);
+    return std::make_shared<ov::Model>(ov::ResultVector{result, relu_result}, ov::ParameterVector{input});
+}
+
+std::map<std::string, const void*> constantsData(const std::shared_ptr<ov::Model>& model) {
+    std::map<std::string, const void*> data;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            data[constant->get_friendly_name()] = constant->get_data_ptr();
+        }
+    }
+    return data;
+}
+}  // namespace
+
+TEST(PipelineStagesTest, SplitByConstantsData) {
+    const auto model = makeTwoMatMulsModel();
+    const auto stages = split_model_stages(model, 2);
+    ASSERT_EQ(stages.size(), 2U);
+
+    // the first MatMul, its output is cut
+    ASSERT_EQ(stages[0].inputs.size(), 1U);
+    ASSERT_EQ(stages[0].inputs[0].stage, PipelineStage::NO_STAGE);
+    ASSERT_EQ(stages[0].inputs[0].index, 0U);
+    ASSERT_EQ(stages[0].outputs, std::vector<size_t>{PipelineStage::NO_OUTPUT});
+
+    // Relu and the second MatMul, both produce the outputs of the model
+    ASSERT_EQ(stages[1].inputs.size(), 1U);
+    ASSERT_EQ(stages[1].inputs[0].stage, 0U);
+    ASSERT_EQ(stages[1].inputs[0].index, 0U);
+    auto outputs = stages[1].outputs;
+    std::sort(outputs.begin(), outputs.end());
+    ASSERT_EQ(outputs, (std::vector<size_t>{0, 1}));
+
+    // each stage keeps the constant of its MatMul, the data is not copied
+    const auto first_data = constantsData(stages[0].model);
+    const auto second_data = constantsData(stages[1].model);
+    const auto original_data = constantsData(model);
+    ASSERT_EQ(first_data.size(), 1U);
+    ASSERT_EQ(second_data.size(), 1U);
+    ASSERT_EQ(first_data.at("first_weights"), original_data.at("first_weights"));
+    ASSERT_EQ(second_data.at("second_weights"), original_data.at("second_weights"));
+}
+
+TEST(PipelineStagesTest, StatefulModelIsNotSplit) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 16});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{2, 16}, ov::element::f32, "state"});
+    auto read_value = std::make_shared<ov::op::v6::ReadValue>(input, variable);
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{16, 16}, {1.0F});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(read_value, weights);
+    auto relu = std::make_shared<ov::op::v0::Relu>(matmul);
+    auto assign = std::make_shared<ov::op::v6::Assign>(relu, variable);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                             ov::SinkVector{assign},
+                                             ov::ParameterVector{input});
+
+    const auto stages = split_model_stages(model, 2);
+    ASSERT_EQ(stages.size(), 1U);
+    ASSERT_EQ(stages[0].model, model);
+    ASSERT_EQ(stages[0].outputs, std::vector<size_t>{0});
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -24,8 +26,31 @@ struct IntKey {
 
     int data;
 };
+
+// immutable value which may be used by several streams at a time
+struct SharedValue {
+    int data;
+};
+
+// value accounted against the byte budget of the cache
+struct SizedValue {
+    size_t bytes;
+};
 } // namespace
 
+template <>
+struct ov::intel_cpu::SharedCacheValue<std::shared_ptr<const SharedValue>> : std::true_type {};
+
+template <>
+struct ov::intel_cpu::SharedCacheValue<std::shared_ptr<const SizedValue>> : std::true_type {};
+
+template <>
+struct ov::intel_cpu::CacheValueBytes<std::shared_ptr<const SizedValue>> {
+    static size_t get(const std::shared_ptr<const SizedValue>& value) {
+        return value->bytes;
+    }
+};
+
 TEST(LruCacheTests, Evict) {
     constexpr size_t capacity = 10;
     LruCache<IntKey, int> cache(capacity);
@@ -85,6 +110,20 @@ TEST(LruCacheTests, LruPolicy) {
     }
 }
 
+TEST(LruCacheTests, Pop) {
+    LruCache<IntKey, int> cache(10);
+    for (int i = 1; i < 4; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.get({1}), 1);
+
+    const auto record = cache.pop();
+    ASSERT_EQ(record.first.data, 2);
+    ASSERT_EQ(record.second, 2);
+    ASSERT_EQ(cache.size(), 2U);
+    ASSERT_EQ(cache.get({2}), int());
+}
+
 TEST(LruCacheTests, Empty) {
     constexpr size_t capacity = 0;
     constexpr int attempts = 10;
@@ -380,3 +419,152 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, ConcurrentMissBuildsOnce) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 16;
+    constexpr size_t numThreads = 16;
+    constexpr size_t numShards = 4;
+
+    std::atomic<int> numBuilds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        numBuilds++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return std::make_shared<int>(key.data);
+    };
+
+    MultiCache cache(capacity, numShards);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    ASSERT_EQ(numBuilds.load(), capacity);
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics["misses"], static_cast<uint64_t>(capacity));
+    ASSERT_EQ(statistics["hits"] + statistics["deduplicated"], static_cast<uint64_t>(capacity * (numThreads - 1)));
+    ASSERT_EQ(statistics["evictions"], 0U);
+}
+
+TEST(MultiCacheTests, Shared) {
+    auto cache = MultiCache::getShared("MultiCacheTests.Shared", 10, 4);
+    ASSERT_EQ(cache, MultiCache::getShared("MultiCacheTests.Shared", 10, 4));
+    ASSERT_NE(cache, MultiCache::getShared("MultiCacheTests.Shared.Other", 10, 4));
+
+    std::weak_ptr<MultiCache> weakCache = cache;
+    cache.reset();
+    ASSERT_TRUE(weakCache.expired());
+}
+
+TEST(MultiCacheTests, ShardsDoNotExceedCapacity) {
+    constexpr int capacity = 10;
+    MultiCache cache(capacity, 4);
+    auto intBuilder = [](const IntKey& key) {
+        return key.data + 1;
+    };
+    for (int i = 0; i < 100; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    // the records still cached are hits
+    int hits = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (cache.getOrCreate(IntKey{i}, intBuilder).second == CacheEntryBase::LookUpStatus::Hit) {
+            hits++;
+        }
+    }
+    ASSERT_LE(hits, capacity);
+}
+
+TEST(MultiCacheTests, SharedOnlyImmutableValues) {
+    auto shared = std::make_shared<MultiCache>(10, 4);
+    MultiCache firstStream(10, shared);
+    MultiCache secondStream(10, shared);
+
+    auto sharedBuilder = [](const IntKey& key) {
+        return std::make_shared<const SharedValue>(SharedValue{key.data});
+    };
+    auto first = firstStream.getOrCreate(IntKey{1}, sharedBuilder);
+    auto second = secondStream.getOrCreate(IntKey{1}, sharedBuilder);
+    ASSERT_EQ(first.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(second.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(first.first, second.first);
+
+    // e.g. an executor with scratch memory
+    auto mutableBuilder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+    auto firstMutable = firstStream.getOrCreate(IntKey{1}, mutableBuilder);
+    auto secondMutable = secondStream.getOrCreate(IntKey{1}, mutableBuilder);
+    ASSERT_EQ(secondMutable.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(firstMutable.first, secondMutable.first);
+    ASSERT_EQ(firstStream.getOrCreate(IntKey{1}, mutableBuilder).first, firstMutable.first);
+
+    // the lookup counters are common
+    auto statistics = shared->getStatistics();
+    ASSERT_EQ(statistics["misses"], 3U);
+    ASSERT_EQ(statistics["hits"], 2U);
+}
+
+TEST(MultiCacheTests, BudgetEvictsLeastRecentlyUsed) {
+    constexpr size_t budget = 1000;
+    MultiCache cache(100, 1, budget);
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<const SizedValue>(SizedValue{static_cast<size_t>(key.data) * 100});
+    };
+
+    for (int i = 1; i <= 4; ++i) {
+        cache.getOrCreate(IntKey{i}, builder);
+    }
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics["bytes"], 1000U);
+    ASSERT_EQ(statistics["evictions"], 0U);
+
+    // the least recently used records are evicted until the budget is met
+    ASSERT_EQ(cache.getOrCreate(IntKey{1}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    cache.getOrCreate(IntKey{5}, builder);
+    statistics = cache.getStatistics();
+    ASSERT_EQ(statistics["bytes"], 1000U);
+    ASSERT_EQ(statistics["evictions"], 2U);
+    ASSERT_EQ(cache.getOrCreate(IntKey{1}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(cache.getOrCreate(IntKey{4}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+
+    // the record larger than the budget is still cached
+    cache.getOrCreate(IntKey{20}, builder);
+    ASSERT_EQ(cache.getOrCreate(IntKey{20}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(cache.getStatistics()["bytes"], 2000U);
+}
+
+TEST(MultiCacheTests, SharedStatisticsAreProcessWide) {
+    auto shared = std::make_shared<MultiCache>(10, 4, 1000);
+    MultiCache firstModel(10, shared);
+    MultiCache secondModel(10, shared);
+    ASSERT_EQ(MultiCache(10).getStatistics()["process_wide"], 0U);
+
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<const SizedValue>(SizedValue{static_cast<size_t>(key.data)});
+    };
+    firstModel.getOrCreate(IntKey{100}, builder);
+    secondModel.getOrCreate(IntKey{100}, builder);
+
+    // both models report the counters of all the users of the shared cache
+    for (const auto* cache : {&firstModel, &secondModel}) {
+        auto statistics = cache->getStatistics();
+        ASSERT_EQ(statistics["process_wide"], 1U);
+        ASSERT_EQ(statistics["misses"], 1U);
+        ASSERT_EQ(statistics["hits"], 1U);
+        ASSERT_EQ(statistics["bytes"], 100U);
+    }
+}
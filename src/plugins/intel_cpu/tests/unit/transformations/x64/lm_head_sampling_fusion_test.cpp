@@ -0,0 +1,276 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "transformations/cpu_opset/x64/op/lm_head_sampling.hpp"
+#include "transformations/cpu_opset/x64/pass/lm_head_sampling_fusion.hpp"
+
+using namespace testing;
+using namespace ov::op;
+using namespace ov;
+
+namespace {
+
+constexpr size_t hidden_size = 64;
+constexpr size_t vocab_size = 128;
+
+std::shared_ptr<v0::Parameter> make_input() {
+    return std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, static_cast<int64_t>(hidden_size)});
+}
+
+std::shared_ptr<v0::Constant> make_weights() {
+    return v0::Constant::create(element::f16, Shape{vocab_size, hidden_size}, {0.5F});
+}
+
+std::shared_ptr<v0::MatMul> make_lm_head(const Output<Node>& input, const std::shared_ptr<v0::Constant>& weights) {
+    return std::make_shared<v0::MatMul>(input, std::make_shared<v0::Convert>(weights, element::f32), false, true);
+}
+
+intel_cpu::LMHeadSamplingNode::Config make_config(bool sample,
+                                                  int top_k,
+                                                  float temperature,
+                                                  bool with_logits,
+                                                  element::Type index_type) {
+    return {sample,
+            static_cast<int>(hidden_size),
+            static_cast<int>(vocab_size),
+            top_k,
+            1.0F,
+            temperature,
+            sample ? uint64_t{7} : uint64_t{0},
+            sample ? uint64_t{11} : uint64_t{0},
+            with_logits,
+            index_type};
+}
+
+class LMHeadSamplingFusionTest : public TransformationTestsF {
+protected:
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        disable_rt_info_check();
+        disable_result_friendly_names_check();
+        manager.register_pass<intel_cpu::LMHeadSamplingFusion>();
+        manager.get_pass_config()->set_callback<intel_cpu::LMHeadSamplingFusion>(
+            [](const std::shared_ptr<const ov::Node>&) -> bool {
+                return true;
+            });
+    }
+};
+
+}  // namespace
+
+TEST_F(LMHeadSamplingFusionTest, TopKWithTemperatureMultiply) {
+    {
+        auto input = make_input();
+        auto logits = std::make_shared<v1::Multiply>(make_lm_head(input, make_weights()),
+                                                     v0::Constant::create(element::f32, Shape{}, {0.5F}));
+        auto topk = std::make_shared<v11::TopK>(logits,
+                                                v0::Constant::create(element::i64, Shape{}, {4}),
+                                                -1,
+                                                TopKMode::MAX,
+                                                TopKSortType::SORT_VALUES,
+                                                element::i32);
+        model = std::make_shared<Model>(OutputVector{topk->output(0), topk->output(1)}, ParameterVector{input});
+    }
+    {
+        auto input = make_input();
+        auto fused = std::make_shared<intel_cpu::LMHeadSamplingNode>(
+            OutputVector{input, make_weights()},
+            make_config(false, 4, 2.0F, false, element::i32));
+        model_ref = std::make_shared<Model>(OutputVector{fused->output(0), fused->output(1)}, ParameterVector{input});
+    }
+}
+
+TEST_F(LMHeadSamplingFusionTest, MultinomialWithTemperatureDivide) {
+    {
+        auto input = make_input();
+        auto logits = std::make_shared<v1::Divide>(make_lm_head(input, make_weights()),
+                                                   v0::Constant::create(element::f32, Shape{1}, {0.25F}));
+        auto probs = std::make_shared<v8::Softmax>(logits, 1);
+        auto multinomial = std::make_shared<v13::Multinomial>(probs,
+                                                              v0::Constant::create(element::i64, Shape{1}, {1}),
+                                                              element::i32,
+                                                              false,
+                                                              false,
+                                                              7,
+                                                              11);
+        model = std::make_shared<Model>(OutputVector{multinomial}, ParameterVector{input});
+    }
+    {
+        auto input = make_input();
+        auto fused = std::make_shared<intel_cpu::LMHeadSamplingNode>(
+            OutputVector{input, make_weights()},
+            make_config(true, 0, 0.25F, false, element::i32));
+        model_ref = std::make_shared<Model>(OutputVector{fused->output(1)}, ParameterVector{input});
+    }
+}
+
+TEST_F(LMHeadSamplingFusionTest, MultinomialLogSoftmaxWithLogProbs) {
+    {
+        auto input = make_input();
+        auto log_probs = std::make_shared<v5::LogSoftmax>(make_lm_head(input, make_weights()), -1);
+        auto multinomial = std::make_shared<v13::Multinomial>(log_probs,
+                                                              v0::Constant::create(element::i32, Shape{}, {1}),
+                                                              element::i64,
+                                                              false,
+                                                              true,
+                                                              7,
+                                                              11);
+        model = std::make_shared<Model>(OutputVector{multinomial}, ParameterVector{input});
+    }
+    {
+        auto input = make_input();
+        auto fused = std::make_shared<intel_cpu::LMHeadSamplingNode>(
+            OutputVector{input, make_weights()},
+            make_config(true, 0, 1.0F, false, element::i64));
+        model_ref = std::make_shared<Model>(OutputVector{fused->output(1)}, ParameterVector{input});
+    }
+}
+
+TEST_F(LMHeadSamplingFusionTest, GreedyWithI64IndicesAndLogits) {
+    {
+        auto input = make_input();
+        auto lm_head = make_lm_head(input, make_weights());
+        auto topk = std::make_shared<v11::TopK>(lm_head,
+                                                v0::Constant::create(element::i32, Shape{}, {1}),
+                                                1,
+                                                TopKMode::MAX,
+                                                TopKSortType::NONE,
+                                                element::i64);
+        // the logits consumed besides the selection are taken from the fused node
+        auto logits = std::make_shared<v1::Multiply>(lm_head, v0::Constant::create(element::f32, Shape{}, {2.0F}));
+        model = std::make_shared<Model>(OutputVector{topk->output(0), topk->output(1), logits},
+                                        ParameterVector{input});
+    }
+    {
+        auto input = make_input();
+        auto fused = std::make_shared<intel_cpu::LMHeadSamplingNode>(OutputVector{input, make_weights()},
+                                                                     make_config(false, 1, 1.0F, true, element::i64));
+        auto logits =
+            std::make_shared<v1::Multiply>(fused->output(2), v0::Constant::create(element::f32, Shape{}, {2.0F}));
+        model_ref = std::make_shared<Model>(OutputVector{fused->output(0), fused->output(1), logits},
+                                            ParameterVector{input});
+    }
+}
+
+TEST_F(LMHeadSamplingFusionTest, GreedyOverLastTokens) {
+    const PartialShape last_tokens{-1, 1, static_cast<int64_t>(hidden_size)};
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, last_tokens);
+        auto topk = std::make_shared<v11::TopK>(make_lm_head(input, make_weights()),
+                                                v0::Constant::create(element::i64, Shape{}, {1}),
+                                                -1,
+                                                TopKMode::MAX,
+                                                TopKSortType::SORT_VALUES,
+                                                element::i32);
+        model = std::make_shared<Model>(OutputVector{topk->output(0), topk->output(1)}, ParameterVector{input});
+    }
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, last_tokens);
+        auto fused = std::make_shared<intel_cpu::LMHeadSamplingNode>(OutputVector{input, make_weights()},
+                                                                     make_config(false, 1, 1.0F, false, element::i32));
+        model_ref = std::make_shared<Model>(OutputVector{fused->output(0), fused->output(1)}, ParameterVector{input});
+    }
+}
+
+TEST_F(LMHeadSamplingFusionTest, GreedyOverPromptIsNotFused) {
+    auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int64_t>(hidden_size)});
+    auto topk = std::make_shared<v11::TopK>(make_lm_head(input, make_weights()),
+                                            v0::Constant::create(element::i64, Shape{}, {1}),
+                                            -1,
+                                            TopKMode::MAX,
+                                            TopKSortType::SORT_VALUES,
+                                            element::i32);
+    model = std::make_shared<Model>(OutputVector{topk->output(0), topk->output(1)}, ParameterVector{input});
+}
+
+TEST_F(LMHeadSamplingFusionTest, GreedyOverManyStaticRowsIsNotFused) {
+    auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{32, static_cast<int64_t>(hidden_size)});
+    auto topk = std::make_shared<v11::TopK>(make_lm_head(input, make_weights()),
+                                            v0::Constant::create(element::i64, Shape{}, {1}),
+                                            -1,
+                                            TopKMode::MAX,
+                                            TopKSortType::SORT_VALUES,
+                                            element::i32);
+    model = std::make_shared<Model>(OutputVector{topk->output(0), topk->output(1)}, ParameterVector{input});
+}
+
+TEST_F(LMHeadSamplingFusionTest, MultinomialOverFlattenedPromptIsNotFused) {
+    // [batch * seq_len, hidden] has a row per token of the prompt
+    auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int64_t>(hidden_size)});
+    auto rows = std::make_shared<v1::Reshape>(
+        input,
+        v0::Constant::create(element::i64, Shape{2}, {int64_t{-1}, static_cast<int64_t>(hidden_size)}),
+        false);
+    auto probs = std::make_shared<v8::Softmax>(make_lm_head(rows, make_weights()), -1);
+    auto multinomial = std::make_shared<v13::Multinomial>(probs,
+                                                          v0::Constant::create(element::i64, Shape{}, {1}),
+                                                          element::i32,
+                                                          false,
+                                                          false);
+    model = std::make_shared<Model>(OutputVector{multinomial}, ParameterVector{input});
+}
+
+TEST_F(LMHeadSamplingFusionTest, TopKOverNonLastAxisIsNotFused) {
+    auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{2, 3, static_cast<int64_t>(hidden_size)});
+    auto topk = std::make_shared<v11::TopK>(make_lm_head(input, make_weights()),
+                                            v0::Constant::create(element::i64, Shape{}, {1}),
+                                            1,
+                                            TopKMode::MAX,
+                                            TopKSortType::SORT_VALUES,
+                                            element::i32);
+    model = std::make_shared<Model>(OutputVector{topk->output(0), topk->output(1)}, ParameterVector{input});
+}
+
+TEST_F(LMHeadSamplingFusionTest, SoftmaxOverNonLastAxisIsNotFused) {
+    auto input = make_input();
+    auto probs = std::make_shared<v8::Softmax>(make_lm_head(input, make_weights()), 0);
+    auto multinomial = std::make_shared<v13::Multinomial>(probs,
+                                                          v0::Constant::create(element::i64, Shape{}, {1}),
+                                                          element::i32,
+                                                          false,
+                                                          false);
+    model = std::make_shared<Model>(OutputVector{multinomial}, ParameterVector{input});
+}
+
+TEST_F(LMHeadSamplingFusionTest, LogProbsMismatchIsNotFused) {
+    // Multinomial exponentiates the softmax probabilities as if they were log probabilities
+    auto input = make_input();
+    auto probs = std::make_shared<v8::Softmax>(make_lm_head(input, make_weights()), -1);
+    auto multinomial = std::make_shared<v13::Multinomial>(probs,
+                                                          v0::Constant::create(element::i64, Shape{}, {1}),
+                                                          element::i32,
+                                                          false,
+                                                          true);
+    model = std::make_shared<Model>(OutputVector{multinomial}, ParameterVector{input});
+}
+
+TEST_F(LMHeadSamplingFusionTest, LogSoftmaxWithoutLogProbsIsNotFused) {
+    auto input = make_input();
+    auto log_probs = std::make_shared<v5::LogSoftmax>(make_lm_head(input, make_weights()), 1);
+    auto multinomial = std::make_shared<v13::Multinomial>(log_probs,
+                                                          v0::Constant::create(element::i64, Shape{}, {1}),
+                                                          element::i32,
+                                                          false,
+                                                          false);
+    model = std::make_shared<Model>(OutputVector{multinomial}, ParameterVector{input});
+}
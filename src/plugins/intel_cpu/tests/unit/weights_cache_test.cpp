@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+void fillWeights(const IMemory& memory) {
+    auto* data = memory.getDataAs<float>();
+    const auto count = memory.getSize() / sizeof(float);
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = static_cast<float>(i % 251) + 1.0F;
+    }
+}
+
+bool checkWeights(const IMemory& memory) {
+    const auto* data = memory.getDataAs<float>();
+    const auto count = memory.getSize() / sizeof(float);
+    for (size_t i = 0; i < count; ++i) {
+        if (data[i] != static_cast<float>(i % 251) + 1.0F) {
+            return false;
+        }
+    }
+    return true;
+}
+
+MemoryPtr makeWeights(const dnnl::engine& eng) {
+    // several pages, so at least some of them are released on eviction
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{64, 1024});
+    auto memory = std::make_shared<Memory>(eng, desc);
+    fillWeights(*memory);
+    return memory;
+}
+}  // namespace
+
+TEST(WeightsCacheTest, EvictAndRestore) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto cache = std::make_shared<WeightsSharing>();
+    cache->setEvictionBudget(1);
+
+    auto weights = makeWeights(eng);
+    cache->registerEvictable(weights, fillWeights);
+
+    {
+        const auto guard = cache->use();
+        // the weights in use are never evicted
+        ASSERT_EQ(cache->evict(), 0U);
+        ASSERT_TRUE(checkWeights(*weights));
+    }
+
+    // the weights over the budget are evicted once the cache is idle
+    auto statistics = cache->getEvictionStatistics();
+    ASSERT_EQ(statistics["resident_bytes"], 0U);
+#if defined(__linux__)
+    ASSERT_EQ(statistics["evictions"], 1U);
+#endif
+
+    {
+        const auto guard = cache->use();
+        ASSERT_TRUE(checkWeights(*weights));
+        ASSERT_EQ(cache->getEvictionStatistics()["resident_bytes"], weights->getSize());
+    }
+
+    statistics = cache->getEvictionStatistics();
+    ASSERT_EQ(statistics["packs"], 1U);
+    ASSERT_EQ(statistics["repacks"], 1U);
+}
+
+TEST(WeightsCacheTest, EvictionDisabled) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto cache = std::make_shared<WeightsSharing>();
+
+    auto weights = makeWeights(eng);
+    cache->registerEvictable(weights, fillWeights);
+
+    ASSERT_EQ(cache->evict(), 0U);
+    ASSERT_TRUE(checkWeights(*weights));
+    auto statistics = cache->getEvictionStatistics();
+    ASSERT_EQ(statistics["packs"], 1U);
+    ASSERT_EQ(statistics["evictable_bytes"], 0U);
+}
+
+TEST(WeightsCacheTest, BudgetAppliesToOwnWeights) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto first = makeWeights(eng);
+    auto second = makeWeights(eng);
+    auto third = makeWeights(eng);
+    auto other = makeWeights(eng);
+    const auto size = first->getSize();
+
+    auto cache = std::make_shared<WeightsSharing>();
+    cache->setEvictionBudget(2 * size);
+    for (const auto& weights : {first, second, third}) {
+        cache->registerEvictable(weights, fillWeights);
+    }
+    auto other_cache = std::make_shared<WeightsSharing>();
+    other_cache->setEvictionBudget(1);
+    other_cache->registerEvictable(other, fillWeights);
+
+    const auto other_guard = other_cache->use();
+    {
+        const auto guard = cache->use();
+    }
+
+    // only the weights over the budget of the idle cache are evicted, the caches do not evict each other
+    ASSERT_EQ(cache->getEvictionStatistics()["resident_bytes"], 2 * size);
+    ASSERT_EQ(other_cache->getEvictionStatistics()["resident_bytes"], size);
+    ASSERT_TRUE(checkWeights(*first));
+    ASSERT_TRUE(checkWeights(*second));
+    ASSERT_TRUE(checkWeights(*other));
+
+    {
+        const auto guard = cache->use();
+        ASSERT_TRUE(checkWeights(*third));
+    }
+    ASSERT_EQ(cache->getEvictionStatistics()["repacks"], 1U);
+}